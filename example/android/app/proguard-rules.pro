@@ -15,3 +15,8 @@
 #-keepclassmembers class fqcn.of.javascript.interface.for.webview {
 #   public *;
 #}
+
+# Called from native code by the Djinni support library.
+-keep class com.dropbox.djinni.BulkCollections { *; }
+-keep class com.dropbox.djinni.NativeBuffers { *; }
+-keep class com.dropbox.djinni.NativeFutureHandler { *; }
@@ -3,7 +3,7 @@
 
 package com.dropbox.textsort;
 
-import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.AtomicLongFieldUpdater;
 import javax.annotation.CheckForNull;
 import javax.annotation.Nonnull;
 
@@ -15,8 +15,10 @@ public abstract class SortItems {
 
     private static final class CppProxy extends SortItems
     {
-        private final long nativeRef;
-        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+        private static final AtomicLongFieldUpdater<CppProxy> NATIVE_REF =
+            AtomicLongFieldUpdater.newUpdater(CppProxy.class, "nativeRef");
+        // Zero once destroyed.
+        private volatile long nativeRef;
 
         private CppProxy(long nativeRef)
         {
@@ -27,8 +29,8 @@ public abstract class SortItems {
         private native void nativeDestroy(long nativeRef);
         public void destroy()
         {
-            boolean destroyed = this.destroyed.getAndSet(true);
-            if (!destroyed) nativeDestroy(this.nativeRef);
+            long nativeRef = NATIVE_REF.getAndSet(this, 0);
+            if (nativeRef != 0) nativeDestroy(nativeRef);
         }
         protected void finalize() throws java.lang.Throwable
         {
@@ -39,7 +41,7 @@ public abstract class SortItems {
         @Override
         public void sort(SortOrder order, ItemList items)
         {
-            assert !this.destroyed.get() : "trying to use a destroyed object";
+            assert this.nativeRef != 0 : "trying to use a destroyed object";
             native_sort(this.nativeRef, order, items);
         }
         private native void native_sort(long _nativeRef, SortOrder order, ItemList items);
@@ -8,4 +8,7 @@ import javax.annotation.Nonnull;
 
 public abstract class TextboxListener {
     public abstract void update(@Nonnull ItemList items);
+
+    // Caches System.identityHashCode(this) for the native proxy cache.
+    private int djinniIdentityHash;
 }
@@ -11,7 +11,10 @@ NativeItemList::NativeItemList() = default;
 NativeItemList::~NativeItemList() = default;
 
 auto NativeItemList::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeItemList>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeItemList>::get());
+}
+
+auto NativeItemList::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeItemList& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::List<::djinni::String>::fromCpp(jniEnv, c.items)))};
     ::djinni::jniExceptionCheck(jniEnv);
@@ -19,9 +22,12 @@ auto NativeItemList::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::Loca
 }
 
 auto NativeItemList::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 2);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeItemList>::get());
+}
+
+auto NativeItemList::toCpp(JNIEnv* jniEnv, JniType j, const NativeItemList& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeItemList>::get();
     return {::djinni::List<::djinni::String>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mItems))};
 }
 
@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeItemList final {
+class NativeItemList final : public ::djinni::JniRecord<NativeItemList> {
 public:
     using CppType = ::textsort::ItemList;
     using JniType = jobject;
 
     using Boxed = NativeItemList;
 
+    static constexpr jint kLocalRefsPerRecord = 2;
+
     ~NativeItemList();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeItemList& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeItemList& data);
 
 private:
     NativeItemList();
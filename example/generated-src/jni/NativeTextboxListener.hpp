@@ -40,6 +40,7 @@ private:
     };
 
     const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/textsort/TextboxListener") };
+    const jfieldID field_djinniIdentityHash { ::djinni::jniGetFieldID(clazz.get(), "djinniIdentityHash", "I") };
     const jmethodID method_update { ::djinni::jniGetMethodID(clazz.get(), "update", "(Lcom/dropbox/textsort/ItemList;)V") };
 };
 
@@ -55,6 +55,7 @@ fi
     --java-package $java_package \
     --java-nullable-annotation "javax.annotation.CheckForNull" \
     --java-nonnull-annotation "javax.annotation.Nonnull" \
+    --java-compact-cpp-proxy true \
     --ident-java-field mFooBar \
     \
     --cpp-out "$temp_out/cpp" \
@@ -133,6 +133,12 @@ class CppGenerator(spec: Spec) extends Generator(spec) {
     r.fields.foreach(f => refs.find(f.ty))
     r.consts.foreach(c => refs.find(c.ty))
     refs.hpp.add("#include <utility>") // Add for std::move
+    val flat = r.derivingTypes.contains(DerivingType.Flat)
+    if (flat) {
+      refs.hpp.add("#include " + q(spec.cppBaseLibIncludePrefix + "djinni_flat.hpp"))
+      refs.hpp.add("#include <cstdint>")
+      refs.hpp.add("#include <vector>")
+    }
 
     val self = marshal.typename(ident, r)
     val (cppName, cppFinal) = if (r.ext.cpp) (ident.name + "_base", "") else (ident.name, " final")
@@ -198,9 +204,66 @@ class CppGenerator(spec: Spec) extends Generator(spec) {
       }
     }
 
-    writeHppFile(cppName, origin, refs.hpp, refs.hppFwds, writeCppPrototype)
+    val flatView = idCpp.ty(cppName + "_view")
+    val flatBuilder = idCpp.ty(cppName + "_builder")
+    val (flatFields, flatSize) = flatLayout(r.fields)
+
+    def writeFlatPrototype(w: IndentWriter) {
+      w.wl
+      w.wl(s"/** Reads a $actualSelf in place from a flat snapshot, see djinni_flat.hpp. */")
+      w.w(s"class $flatView final").bracedSemi {
+        w.wlOutdent("public:")
+        w.wl(s"static constexpr uint64_t kSize = $flatSize;")
+        w.wl(s"static constexpr uint64_t kLayoutHash = ${"0x%016xULL".format(flatLayoutHash(ident.name, r))};")
+        w.wl
+        w.wl(s"// Throws std::invalid_argument unless data was written by $flatBuilder::build().")
+        w.w(s"static $flatView root(const void * data, size_t size)").braced {
+          w.wl("const ::djinni::FlatData flatData(data, size);")
+          w.wl(s"return $flatView(flatData, flatData.root(kLayoutHash, kSize));")
+        }
+        w.wl
+        w.wl(s"$flatView(const ::djinni::FlatData& data, uint64_t at)")
+        w.wl(": m_data(data)")
+        w.wl(", m_at(at)")
+        w.braced {
+          w.wl("m_data.bytes(m_at, kSize);")
+        }
+        for ((f, at) <- flatFields) {
+          w.wl
+          writeDoc(w, f.doc)
+          val helper = flatHelper(f.ty.resolved)
+          w.wl(s"$helper::View ${idCpp.field(f.ident)}() const { return $helper::view(m_data, m_at + $at); }")
+        }
+        w.wl
+        w.wl(s"$actualSelf toCpp() const;")
+        w.wl
+        w.wlOutdent("private:")
+        w.wl("::djinni::FlatData m_data;")
+        w.wl("uint64_t m_at;")
+      }
+      w.wl
+      w.wl(s"/** Writes $actualSelf records in the layout read by $flatView. */")
+      w.w(s"struct $flatBuilder final").bracedSemi {
+        w.wl(s"using CppType = $actualSelf;")
+        w.wl(s"using View = $flatView;")
+        w.wl
+        w.wl(s"// A whole snapshot with value as its root record.")
+        w.wl(s"static std::vector<uint8_t> build(const $actualSelf& value);")
+        w.wl
+        w.wl(s"// Fills in the record block at the given offset, which holds View::kSize bytes.")
+        w.wl(s"static void write(::djinni::FlatBuilder& builder, uint64_t at, const $actualSelf& value);")
+      }
+    }
+
+    writeHppFile(cppName, origin, refs.hpp, refs.hppFwds, w => {
+      writeCppPrototype(w)
+      if (flat) {
+        writeFlatPrototype(w)
+      }
+    })
 
-    if (r.consts.nonEmpty || r.derivingTypes.nonEmpty) {
+    // Serialize is implemented by the JNI layer and needs nothing in the C++ record itself
+    if (r.consts.nonEmpty || r.derivingTypes.exists(_ != DerivingType.Serialize)) {
       writeCppFile(cppName, origin, refs.cpp, w => {
         generateCppConstants(w, r.consts, actualSelf)
 
@@ -247,11 +310,95 @@ class CppGenerator(spec: Spec) extends Generator(spec) {
             w.wl("return !(lhs < rhs);")
           }
         }
+        if (flat) {
+          w.wl
+          w.w(s"$actualSelf $flatView::toCpp() const").braced {
+            if (r.fields.nonEmpty) {
+              writeAlignedCall(w, "return {", r.fields, "}", f => s"${flatHelper(f.ty.resolved)}::toCpp(${idCpp.field(f.ident)}())")
+              w.wl(";")
+            } else {
+              w.wl("return {};")
+            }
+          }
+          w.wl
+          w.w(s"std::vector<uint8_t> $flatBuilder::build(const $actualSelf& value)").braced {
+            w.wl("::djinni::FlatBuilder builder;")
+            w.wl(s"const uint64_t at = builder.allocate($flatView::kSize);")
+            w.wl("write(builder, at, value);")
+            w.wl(s"return builder.finish($flatView::kLayoutHash, at);")
+          }
+          w.wl
+          w.w(s"void $flatBuilder::write(::djinni::FlatBuilder& builder, uint64_t at, const $actualSelf& value)").braced {
+            for ((f, at) <- flatFields) {
+              w.wl(s"${flatHelper(f.ty.resolved)}::write(builder, at + $at, value.${idCpp.field(f.ident)});")
+            }
+          }
+        }
       })
     }
 
   }
 
+  // Offset of each field in a flat record block and the size of the block, see djinni_flat.hpp.
+  // Each slot is aligned to its own size.
+  def flatLayout(fields: Seq[Field]): (Seq[(Field, Int)], Int) = {
+    var end = 0
+    val placed = fields.map(f => {
+      val slot = flatSlot(f.ty.resolved)
+      val at = (end + slot - 1) / slot * slot
+      end = at + slot
+      (f, at)
+    })
+    (placed, (end + 7) / 8 * 8)
+  }
+
+  def flatSlot(tm: MExpr): Int = tm.base match {
+    case p: MPrimitive => p.idlName match {
+      case "bool" | "i8" => 1
+      case "i16" => 2
+      case "i32" | "f32" => 4
+      case _ => 8
+    }
+    case d: MDef if d.defType == DEnum => 4
+    case _ => 8
+  }
+
+  def flatHelper(tm: MExpr): String = tm.base match {
+    case p: MPrimitive => "::djinni::Flat" + (if (p.idlName == "bool") "Bool" else p.idlName.toUpperCase)
+    case MString => "::djinni::FlatString"
+    case MBinary => "::djinni::FlatBinary"
+    case MDate => "::djinni::FlatDate"
+    case MOptional => s"::djinni::FlatOptional<${spec.cppOptionalTemplate}, ${flatHelper(tm.args.head)}>"
+    case MList | MArray => s"::djinni::FlatList<${flatHelper(tm.args.head)}>"
+    case MSet => s"::djinni::FlatSet<${flatHelper(tm.args.head)}>"
+    case MMap => s"::djinni::FlatMap<${flatHelper(tm.args.head)}, ${flatHelper(tm.args(1))}>"
+    case d: MDef => d.defType match {
+      case DEnum => s"::djinni::FlatEnum<${idCpp.enumType(d.name)}>"
+      case DRecord => s"::djinni::FlatRecord<${idCpp.ty(d.name + "_builder")}>"
+      case DInterface => throw new AssertionError("interfaces have no flat layout")
+    }
+    case _ => throw new AssertionError("type has no flat layout")
+  }
+
+  // FNV-1a of the field names and types of a record and everything it contains, so that a
+  // snapshot is never read with a different layout than it was written with.
+  def flatLayoutHash(name: String, r: Record): Long = {
+    def signature(tm: MExpr): String = {
+      val base = tm.base match {
+        case o: MOpaque => o.idlName
+        case d: MDef => d.defType match {
+          case DRecord => recordSignature(d.name, d.body.asInstanceOf[Record])
+          case _ => d.name
+        }
+        case _ => throw new AssertionError("type has no flat layout")
+      }
+      if (tm.args.isEmpty) base else base + tm.args.map(signature).mkString("<", ",", ">")
+    }
+    def recordSignature(name: String, r: Record): String =
+      name + r.fields.map(f => f.ident.name + ":" + signature(f.ty.resolved)).mkString("{", ";", "}")
+    recordSignature(name, r).getBytes("UTF-8").foldLeft(0xcbf29ce484222325L)((h, b) => (h ^ (b & 0xff)) * 0x100000001b3L)
+  }
+
   override def generateInterface(origin: String, ident: Ident, doc: Doc, typeParams: Seq[TypeParam], i: Interface) {
     val refs = new CppRefs(ident.name)
     i.methods.map(m => {
@@ -40,8 +40,10 @@ class CppMarshal(spec: Spec) extends Marshal(spec) {
     case MString => List(ImportRef("<string>"))
     case MDate => List(ImportRef("<chrono>"))
     case MBinary => List(ImportRef("<vector>"), ImportRef("<cstdint>"))
+    case MBuffer => List(ImportRef(q(spec.cppBaseLibIncludePrefix + "djinni_shared_buffer.hpp")))
+    case MFuture => List(ImportRef(q(spec.cppBaseLibIncludePrefix + "djinni_future.hpp")))
     case MOptional => List(ImportRef(spec.cppOptionalHeader))
-    case MList => List(ImportRef("<vector>"))
+    case MList | MArray => List(ImportRef("<vector>"))
     case MSet => List(ImportRef("<unordered_set>"))
     case MMap => List(ImportRef("<unordered_map>"))
     case d: MDef => d.defType match {
@@ -76,8 +78,10 @@ class CppMarshal(spec: Spec) extends Marshal(spec) {
       case MString => "std::string"
       case MDate => "std::chrono::system_clock::time_point"
       case MBinary => "std::vector<uint8_t>"
+      case MBuffer => "::djinni::SharedBuffer"
+      case MFuture => "::djinni::SharedFuture"
       case MOptional => spec.cppOptionalTemplate
-      case MList => "std::vector"
+      case MList | MArray => "std::vector"
       case MSet => "std::unordered_set"
       case MMap => "std::unordered_map"
       case d: MDef =>
@@ -432,7 +432,7 @@ class CxGenerator(spec: Spec) extends Generator(spec) {
       case MBinary => "std::vector<uint8_t>"
       case MOptional => spec.cppOptionalTemplate
       // case MAsync => "rc::rest::FutureHandle"
-      case MList => "std::vector"
+      case MList | MArray => "std::vector"
       case MSet => "std::unordered_set"
       case MMap => "std::unordered_map"
       case d: MDef =>
@@ -67,9 +67,11 @@ class CxMarshal(spec: Spec) extends Marshal(spec) {
       }
       case MOptional => "Optional"
       case MBinary => "Binary"
+      case MBuffer => "Buffer"
+      case MFuture => "Future"
       case MDate => "Date"
       case MString => "String"
-      case MList => "List"
+      case MList | MArray => "List"
       case MSet => "Set"
       case MMap => "Map"
       case d: MDef => throw new AssertionError("unreachable")
@@ -85,7 +87,7 @@ class CxMarshal(spec: Spec) extends Marshal(spec) {
         assert(tm.args.size == 1)
         val argHelperClass = ownClass(tm.args.head)
         s"<${spec.cppOptionalTemplate}, $argHelperClass>" //TODO THIS IS VERY WRONG!
-      case MList | MSet =>
+      case MList | MArray | MSet =>
         assert(tm.args.size == 1)
         f
       case MMap =>
@@ -122,9 +124,11 @@ class CxMarshal(spec: Spec) extends Marshal(spec) {
     }
     case MOptional => "Optional"
     case MBinary => "Binary"
+    case MBuffer => "Buffer"
+    case MFuture => "Future"
     case MDate => "Date"
     case MString => "String"
-    case MList => "List"
+    case MList | MArray => "List"
     case MSet => "Set"
     case MMap => "Map"
     case d: MDef => throw new AssertionError("unreachable")
@@ -139,7 +143,7 @@ private def helperTemplates(tm: MExpr): String = {
       assert(tm.args.size == 1)
       val argHelperClass = helperClass(tm.args.head)
       s"<${spec.cppOptionalTemplate}, $argHelperClass>"
-    case MList | MSet =>
+    case MList | MArray | MSet =>
       assert(tm.args.size == 1)
       f
     case MMap =>
@@ -154,7 +158,7 @@ def references(m: Meta, exclude: String): Seq[SymbolReference] = m match {
     case "i8" | "i16" | "i32" | "i64" => List()
     case _ => List()
  }
-  case MString | MDate | MBinary | MOptional | MList | MSet | MMap  => List()
+  case MString | MDate | MBinary | MBuffer | MFuture | MOptional | MList | MArray | MSet | MMap  => List()
   case d: MDef => d.defType match {
     case DEnum | DRecord =>
       if (d.name != exclude) {
@@ -189,7 +193,7 @@ def convertReferences(m: Meta, exclude: String): Seq[SymbolReference] = m match
     case "i8" | "i16" | "i32" | "i64" => List()
     case _ => List()
   }
-  case MString | MDate | MBinary | MOptional | MList | MSet | MMap  => List()
+  case MString | MDate | MBinary | MBuffer | MFuture | MOptional | MList | MArray | MSet | MMap  => List()
   case d: MDef => d.defType match {
     case DEnum => List() //no headers to import for enums
     case DRecord => //DEnum | DRecord =>
@@ -291,7 +295,7 @@ def boxedTypename(td: TypeDecl) = td.body match {
     case p: MPrimitive => (p.cxName, false)
     case MString => ("Platform::String", true)
     case MDate => ("Windows::Foundation::DateTime", true)
-    case MBinary => ("Platform::Array<uint8_t>", true)
+    case MBinary | MBuffer => ("Platform::Array<uint8_t>", true)
     case MOptional => // We use "nullptr" for the empty optional.
       assert(tm.args.size == 1)
       val arg = tm.args.head
@@ -303,9 +307,10 @@ def boxedTypename(td: TypeDecl) = td.body match {
           (s"Platform::IBox<${expr(arg, namespace, false)._1}>", true)
         case m => expr(arg, namespace, true)
       }
-    case MList => ("Windows::Foundation::Collections::IVector", true)
+    case MList | MArray => ("Windows::Foundation::Collections::IVector", true)
     case MSet => ("Windows::Foundation::Collections::IIterable", true)
     case MMap => ("Windows::Foundation::Collections::IMap", true)
+    case MFuture => ("Windows::Foundation::IAsyncOperation", true)
     case d: MDef =>
       d.defType match {
         case DEnum => (withNs(namespace, idCx.enumType(d.name)), false)
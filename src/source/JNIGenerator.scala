@@ -16,6 +16,7 @@
 
 package djinni
 
+import djinni.ast.Record.DerivingType
 import djinni.ast._
 import djinni.generatorTools._
 import djinni.meta._
@@ -83,20 +84,50 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
 
     val jniHelper = jniMarshal.helperClass(ident)
     val cppSelf = cppMarshal.fqTypename(ident, r) + cppTypeArgs(params)
+    val columnar = isColumnarRecord(params, r)
+    val recordBase = if (columnar) "JniPrimitiveRecord" else "JniRecord"
+    // Serialized records cross as one byte[] from toWire()/to fromWire() instead of field by field
+    val serialize = r.derivingTypes.contains(DerivingType.Serialize)
+    def wireHelper(f: Field) = s"::djinni::Wire<${jniMarshal.helperClass(f.ty.resolved)}>"
+    if (serialize) {
+      refs.jniHpp.add("#include " + q(spec.jniBaseLibIncludePrefix + "djinni_wire.hpp"))
+      refs.jniCpp.add("#include " + q(spec.jniBaseLibIncludePrefix + "Marshal.hpp"))
+    }
+    // Signature of the Java primitive array holding field f of every record in a list
+    def columnSig(f: Field) = "[" + jniMarshal.fqTypename(f.ty)
+    def columnHelper(f: Field) = s"::djinni::Column<${jniMarshal.helperName(f.ty.resolved)}>"
 
     def writeJniPrototype(w: IndentWriter) {
       writeJniTypeParams(w, params)
-      w.w(s"class $jniHelper final").bracedSemi {
+      w.w(s"class $jniHelper final : public ::djinni::$recordBase<$jniHelper${typeParamsSignature(params)}>").bracedSemi {
         w.wlOutdent("public:")
         w.wl(s"using CppType = $cppSelf;")
         w.wl(s"using JniType = jobject;")
         w.wl
         w.wl(s"using Boxed = $jniHelper;")
         w.wl
+        if (serialize) {
+          // The message and the record itself
+          w.wl(s"static constexpr jint kLocalRefsPerRecord = 2;")
+        } else {
+          // Each field may leave one local ref behind in toCpp, plus the record itself
+          w.wl(s"static constexpr jint kLocalRefsPerRecord = ${r.fields.size + 1};")
+        }
+        w.wl
         w.wl(s"~$jniHelper();")
         w.wl
         w.wl(s"static CppType toCpp(JNIEnv* jniEnv, JniType j);")
         w.wl(s"static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);")
+        w.wl(s"static CppType toCpp(JNIEnv* jniEnv, JniType j, const $jniHelper& data);")
+        w.wl(s"static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const $jniHelper& data);")
+        if (columnar) {
+          w.wl(s"static std::vector<CppType> toCppList(JNIEnv* jniEnv, jobject j, jint size);")
+          w.wl(s"static ::djinni::LocalRef<jobject> fromCppList(JNIEnv* jniEnv, const std::vector<CppType>& c);")
+        }
+        if (serialize) {
+          w.wl(s"static void writeWire(::djinni::WireWriter& w, const CppType& c);")
+          w.wl(s"static CppType readWire(::djinni::WireReader& r);")
+        }
         w.wl
         w.wlOutdent("private:")
         w.wl(s"$jniHelper();")
@@ -104,12 +135,23 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
         w.wl
         val classLookup = q(jniMarshal.undecoratedTypename(ident, r))
         w.wl(s"const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass($classLookup) };")
-        val constructorSig = q(jniMarshal.javaMethodSignature(r.fields, None))
-        w.wl(s"const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), ${q("<init>")}, $constructorSig) };")
-        for (f <- r.fields) {
-          val javaFieldName = idJava.field(f.ident)
-          val javaSig = q(jniMarshal.fqTypename(f.ty))
-          w.wl(s"const jfieldID field_$javaFieldName { ::djinni::jniGetFieldID(clazz.get(), ${q(javaFieldName)}, $javaSig) };")
+        if (serialize) {
+          val fromWireSig = q(s"([B)L${jniMarshal.undecoratedTypename(ident, r)};")
+          w.wl(s"const jmethodID method_toWire { ::djinni::jniGetMethodID(clazz.get(), ${q("toWire")}, ${q("()[B")}) };")
+          w.wl(s"const jmethodID method_fromWire { ::djinni::jniGetStaticMethodID(clazz.get(), ${q("fromWire")}, $fromWireSig) };")
+        } else {
+          val constructorSig = q(jniMarshal.javaMethodSignature(r.fields, None))
+          w.wl(s"const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), ${q("<init>")}, $constructorSig) };")
+          for (f <- r.fields) {
+            val javaFieldName = idJava.field(f.ident)
+            val javaSig = q(jniMarshal.fqTypename(f.ty))
+            w.wl(s"const jfieldID field_$javaFieldName { ::djinni::jniGetFieldID(clazz.get(), ${q(javaFieldName)}, $javaSig) };")
+          }
+        }
+        if (columnar) {
+          val columns = r.fields.map(columnSig).mkString
+          w.wl(s"const jmethodID method_fromColumns { ::djinni::jniGetStaticMethodID(clazz.get(), ${q("fromColumns")}, ${q(s"($columns)Ljava/util/ArrayList;")}) };")
+          w.wl(s"const jmethodID method_toColumns { ::djinni::jniGetStaticMethodID(clazz.get(), ${q("toColumns")}, ${q(s"(Ljava/util/ArrayList;$columns)V")}) };")
         }
       }
     }
@@ -126,40 +168,118 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
 
       writeJniTypeParams(w, params)
       w.w(s"auto $jniHelperWithParams::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType>").braced{
-        //w.wl(s"::${spec.jniNamespace}::JniLocalScope jscope(jniEnv, 10);")
-        if(r.fields.isEmpty) w.wl("(void)c; // Suppress warnings in release builds for empty records")
-        w.wl(s"const auto& data = ::djinni::JniClass<$jniHelper>::get();")
-        val call = "auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject("
-        w.w(call + "data.clazz.get(), data.jconstructor")
-        if(!r.fields.isEmpty) {
-          w.wl(",")
-          writeAlignedCall(w, " " * call.length(), r.fields, ")}", f => {
-            val name = idCpp.field(f.ident)
-            val param = jniMarshal.fromCpp(f.ty, s"c.$name")
-            s"::djinni::get($param)"
-          })
+        w.wl(s"return fromCpp(jniEnv, c, ::djinni::JniClass<$jniHelper>::get());")
+      }
+      w.wl
+      writeJniTypeParams(w, params)
+      w.w(s"auto $jniHelperWithParams::fromCpp(JNIEnv* jniEnv, const CppType& c, const $jniHelper& data) -> ::djinni::LocalRef<JniType>").braced{
+        if (serialize) {
+          w.wl("::djinni::WireWriter writer;")
+          w.wl("writeWire(writer, c);")
+          w.wl("auto message = ::djinni::jniWireMessage(jniEnv, writer);")
+          w.wl("auto r = ::djinni::LocalRef<JniType>{jniEnv->CallStaticObjectMethod(data.clazz.get(), data.method_fromWire, message.get())};")
+          w.wl(s"::djinni::jniExceptionCheck(jniEnv);")
+          w.wl(s"return r;")
+        } else {
+          if(r.fields.isEmpty) w.wl("(void)c; // Suppress warnings in release builds for empty records")
+          val call = "auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject("
+          w.w(call + "data.clazz.get(), data.jconstructor")
+          if(!r.fields.isEmpty) {
+            w.wl(",")
+            writeAlignedCall(w, " " * call.length(), r.fields, ")}", f => {
+              val name = idCpp.field(f.ident)
+              val param = jniMarshal.fromCpp(f.ty, s"c.$name")
+              s"::djinni::get($param)"
+            })
+          }
+          else
+            w.w(")}")
+          w.wl(";")
+          w.wl(s"::djinni::jniExceptionCheck(jniEnv);")
+          w.wl(s"return r;")
         }
-        else
-          w.w(")}")
-        w.wl(";")
-        w.wl(s"::djinni::jniExceptionCheck(jniEnv);")
-        w.wl(s"return r;")
       }
       w.wl
       writeJniTypeParams(w, params)
       w.w(s"auto $jniHelperWithParams::toCpp(JNIEnv* jniEnv, JniType j) -> CppType").braced {
-        w.wl(s"::djinni::JniLocalScope jscope(jniEnv, ${r.fields.size + 1});")
+        w.wl(s"::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);")
+        w.wl(s"return toCpp(jniEnv, j, ::djinni::JniClass<$jniHelper>::get());")
+      }
+      w.wl
+      writeJniTypeParams(w, params)
+      w.w(s"auto $jniHelperWithParams::toCpp(JNIEnv* jniEnv, JniType j, const $jniHelper& data) -> CppType").braced {
         w.wl(s"assert(j != nullptr);")
-        if(r.fields.isEmpty)
-          w.wl("(void)j; // Suppress warnings in release builds for empty records")
-        else
+        if (serialize) {
+          w.wl("auto message = ::djinni::LocalRef<jbyteArray>(jniEnv, static_cast<jbyteArray>(jniEnv->CallObjectMethod(j, data.method_toWire)));")
+          w.wl("::djinni::jniExceptionCheck(jniEnv);")
+          w.wl(s"return ::djinni::jniWireRead<$jniHelperWithParams>(jniEnv, message.get());")
+        } else {
+          if(r.fields.isEmpty) {
+            w.wl("(void)j; // Suppress warnings in release builds for empty records")
+            w.wl("(void)data;")
+            w.wl("(void)jniEnv;")
+          }
+          writeAlignedCall(w, "return {", r.fields, "}", f => {
+            val fieldId = "data.field_" + idJava.field(f.ident)
+            val jniFieldAccess = toJniCall(f.ty, (jt: String) => s"jniEnv->Get${jt}Field(j, $fieldId)")
+            jniMarshal.toCpp(f.ty, jniFieldAccess)
+          })
+          w.wl(";")
+        }
+      }
+      if (serialize) {
+        w.wl
+        writeJniTypeParams(w, params)
+        w.w(s"void $jniHelperWithParams::writeWire(::djinni::WireWriter& w, const CppType& c)").braced {
+          if (r.fields.isEmpty) {
+            w.wl("(void)w;")
+            w.wl("(void)c;")
+          }
+          for (f <- r.fields) {
+            w.wl(s"${wireHelper(f)}::write(w, c.${idCpp.field(f.ident)});")
+          }
+        }
+        w.wl
+        writeJniTypeParams(w, params)
+        w.w(s"auto $jniHelperWithParams::readWire(::djinni::WireReader& r) -> CppType").braced {
+          if (r.fields.isEmpty) w.wl("(void)r;")
+          // Braced initializers are evaluated in order, which is the order of the fields on the wire
+          writeAlignedCall(w, "return {", r.fields, "}", f => s"${wireHelper(f)}::read(r)")
+          w.wl(";")
+        }
+      }
+      if (columnar) {
+        w.wl
+        w.w(s"auto $jniHelper::toCppList(JNIEnv* jniEnv, jobject j, jint size) -> std::vector<CppType>").braced {
           w.wl(s"const auto& data = ::djinni::JniClass<$jniHelper>::get();")
-        writeAlignedCall(w, "return {", r.fields, "}", f => {
-          val fieldId = "data.field_" + idJava.field(f.ident)
-          val jniFieldAccess = toJniCall(f.ty, (jt: String) => s"jniEnv->Get${jt}Field(j, $fieldId)")
-          jniMarshal.toCpp(f.ty, jniFieldAccess)
-        })
-        w.wl(";")
+          for (f <- r.fields) {
+            w.wl(s"auto j_${f.ident.name} = ${columnHelper(f)}::create(jniEnv, size);")
+          }
+          w.wl(s"jniEnv->CallStaticVoidMethod(data.clazz.get(), data.method_toColumns, j, ${r.fields.map(f => s"j_${f.ident.name}.get()").mkString(", ")});")
+          w.wl("::djinni::jniExceptionCheck(jniEnv);")
+          for (f <- r.fields) {
+            w.wl(s"const auto col_${f.ident.name} = ${columnHelper(f)}::toCpp(jniEnv, j_${f.ident.name}.get(), size);")
+          }
+          w.wl("std::vector<CppType> c;")
+          w.wl("c.reserve(size);")
+          w.w("for (jint i = 0; i < size; ++i)").braced {
+            writeAlignedCall(w, "c.push_back({", r.fields, "});", f => jniMarshal.toCpp(f.ty, s"col_${f.ident.name}[i]"))
+            w.wl
+          }
+          w.wl("return c;")
+        }
+        w.wl
+        w.w(s"auto $jniHelper::fromCppList(JNIEnv* jniEnv, const std::vector<CppType>& c) -> ::djinni::LocalRef<jobject>").braced {
+          w.wl(s"const auto& data = ::djinni::JniClass<$jniHelper>::get();")
+          val call = "auto r = ::djinni::LocalRef<jobject>{jniEnv->CallStaticObjectMethod("
+          w.wl(call + "data.clazz.get(), data.method_fromColumns,")
+          writeAlignedCall(w, " " * call.length(), r.fields, ")};", f => {
+            s"::djinni::get(${columnHelper(f)}::fromCpp(jniEnv, c, [](const CppType& e) { return e.${idCpp.field(f.ident)}; }))"
+          })
+          w.wl
+          w.wl("::djinni::jniExceptionCheck(jniEnv);")
+          w.wl("return r;")
+        }
       }
     }
     writeJniFiles(origin, params.nonEmpty, ident, refs, writeJniPrototype, writeJniBody)
@@ -201,7 +321,9 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
         w.wl(s"friend $baseType;")
         w.wl
         if (i.ext.java) {
-          w.wl(s"class JavaProxy final : ::djinni::JavaProxyCacheEntry, public $cppSelf").bracedSemi {
+          // oneway and coalesce calls keep the proxy, and so the Java object, alive until they're delivered.
+          val sharedFromThis = if (i.methods.exists(m => m.oneway || m.coalesce)) ", public std::enable_shared_from_this<JavaProxy>" else ""
+          w.wl(s"class JavaProxy final : ::djinni::JavaProxyCacheEntry, public $cppSelf$sharedFromThis").bracedSemi {
             w.wlOutdent(s"public:")
             // w.wl(s"using JavaProxyCacheEntry::JavaProxyCacheEntry;")
             w.wl(s"JavaProxy(JniType j);")
@@ -217,9 +339,14 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
             w.wl(s"using ::djinni::JavaProxyCacheEntry::getGlobalRef;")
             w.wl(s"friend ::djinni::JniInterface<$cppSelf, ${withNs(Some(spec.jniNamespace), jniSelf)}>;")
             w.wl(s"friend ::djinni::JavaProxyCache<JavaProxy>;")
+            for (m <- i.methods if m.coalesce) {
+              val types = m.params.map(p => cppMarshal.fqTypename(p.ty)).mkString(", ")
+              w.wl(s"::djinni::JniCoalescedCall<$types> m_coalesced_${idCpp.method(m.ident)};")
+            }
           }
           w.wl
           w.wl(s"const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass(${q(classLookup)}) };")
+          w.wl(s"const jfieldID field_djinniIdentityHash { ::djinni::jniGetFieldID(clazz.get(), ${q("djinniIdentityHash")}, ${q("I")}) };")
           for (m <- i.methods) {
             val javaMethodName = idJava.method(m.ident)
             val javaMethodSig = q(jniMarshal.javaMethodSignature(m.params, m.ret))
@@ -251,42 +378,87 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
           val params = m.params.map(p => cppMarshal.fqParamType(p.ty) + " c_" + idCpp.local(p.ident))
           writeJniTypeParams(w, typeParams)
           w.w(s"$ret $jniSelfWithParams::JavaProxy::${idCpp.method(m.ident)}${params.mkString("(", ", ", ")")}").braced {
-            w.wl(s"auto jniEnv = ::djinni::jniGetThreadEnv();")
-            w.wl(s"::djinni::JniLocalScope jscope(jniEnv, 10);")
-            w.wl(s"const auto& data = ::djinni::JniClass<${withNs(Some(spec.jniNamespace), jniSelf)}>::get();")
-            val call = m.ret.fold("jniEnv->CallVoidMethod(")(r => "auto jret = " + toJniCall(r, (jt: String) => s"jniEnv->Call${jt}Method("))
-            w.w(call)
-            val javaMethodName = idJava.method(m.ident)
-            w.w(s"getGlobalRef(), data.method_$javaMethodName")
-            if(!m.params.isEmpty){
-              w.wl(",")
-              writeAlignedCall(w, " " * call.length(), m.params, ")", p => {
-                val param = jniMarshal.fromCpp(p.ty, "c_" + idCpp.local(p.ident))
-                s"::djinni::get($param)"
-              })
+            def writeCall(self: String) {
+              w.wl(s"::djinni::JniLocalScope jscope(jniEnv, 10);")
+              w.wl(s"const auto& data = ::djinni::JniClass<${withNs(Some(spec.jniNamespace), jniSelf)}>::get();")
+              val call = m.ret.fold("jniEnv->CallVoidMethod(")(r => "auto jret = " + toJniCall(r, (jt: String) => s"jniEnv->Call${jt}Method("))
+              w.w(call)
+              val javaMethodName = idJava.method(m.ident)
+              w.w(s"${self}getGlobalRef(), data.method_$javaMethodName")
+              if(!m.params.isEmpty){
+                w.wl(",")
+                writeAlignedCall(w, " " * call.length(), m.params, ")", p => {
+                  val param = jniMarshal.fromCpp(p.ty, "c_" + idCpp.local(p.ident))
+                  s"::djinni::get($param)"
+                })
+              }
+              else
+                w.w(")")
+              w.wl(";")
+              w.wl(s"::djinni::jniExceptionCheck(jniEnv);")
+              m.ret.fold()(r => w.wl(s"return ${jniMarshal.toCpp(r, "jret")};"))
+            }
+            if (m.coalesce) {
+              // Replace the arguments still waiting, if any; otherwise schedule a delivery of
+              // whatever is newest when it runs, see JniCoalescedCall.
+              val slot = s"m_coalesced_${idCpp.method(m.ident)}"
+              w.w(s"if (!$slot.put(${m.params.map(p => "c_" + idCpp.local(p.ident)).mkString(", ")}))").braced {
+                w.wl("return;")
+              }
+              w.wl(s"auto self = shared_from_this();")
+              w.w(s"$slot.schedule([self](JNIEnv* jniEnv)").bracedEnd(");") {
+                w.wl(s"const auto c_args = self->$slot.take();")
+                w.w("if (!c_args)").braced {
+                  w.wl("return;")
+                }
+                for ((p, n) <- m.params.zipWithIndex) {
+                  w.wl(s"const auto& c_${idCpp.local(p.ident)} = std::get<$n>(*c_args);")
+                }
+                writeCall("self->")
+              }
+            } else if (m.oneway) {
+              // Copy the arguments into a call for the dispatcher thread, see JniOnewayQueue.
+              val captures = ("self" +: m.params.map(p => "c_" + idCpp.local(p.ident))).mkString(", ")
+              w.wl(s"auto self = shared_from_this();")
+              w.w(s"::djinni::JniOnewayQueue::post([$captures](JNIEnv* jniEnv)").bracedEnd(");") {
+                writeCall("self->")
+              }
+            } else {
+              w.wl(s"auto jniEnv = ::djinni::jniGetThreadEnv();")
+              writeCall("")
             }
-            else
-              w.w(")")
-            w.wl(";")
-            w.wl(s"::djinni::jniExceptionCheck(jniEnv);")
-            m.ret.fold()(r => w.wl(s"return ${jniMarshal.toCpp(r, "jret")};"))
           }
         }
       }
       if (i.ext.cpp) {
-        // Generate CEXPORT functions for JNI to call.
+        // Generate CEXPORT functions for JNI to call, or file-local ones to pass to
+        // RegisterNatives. Templates live in headers, so they always export their functions.
+        val registerNatives = spec.jniRegisterNatives && typeParams.isEmpty
+        val linkage = if (registerNatives) "static" else "CJNIEXPORT"
+        val staticNatives = mutable.ListBuffer[(String, String, String)]()
+        val cppProxyNatives = mutable.ListBuffer[(String, String, String)]()
         val classIdentMunged = javaMarshal.fqTypename(ident, i)
           .replaceAllLiterally("_", "_1")
           .replaceAllLiterally(".", "_")
         val prefix = "Java_" + classIdentMunged
-        def nativeHook(name: String, static: Boolean, params: Iterable[Field], ret: Option[TypeRef], f: => Unit) = {
-          val paramList = params.map(p => jniMarshal.paramType(p.ty) + " j_" + idJava.local(p.ident)).mkString(", ")
-          val jniRetType = jniMarshal.fqReturnType(ret)
+        // Parameters are (JNI type, name, Java signature). Small records of primitives are
+        // passed to CppProxy methods as one parameter per field, and returned through a long[]
+        // slot, see --java-scalar-records and ScalarSlot.java.
+        def jniParams(params: Iterable[Field], scalar: Boolean): Seq[(String, String, String)] = params.toSeq.flatMap(p => (if (scalar) scalarRecordFields(p.ty) else None) match {
+          case Some(fields) => fields.map(f => (jniMarshal.paramType(f.ty), "j_" + idJava.local(p.ident) + "_" + idJava.local(f.ident), jniMarshal.typename(f.ty)))
+          case None => Seq((jniMarshal.paramType(p.ty), "j_" + idJava.local(p.ident), jniMarshal.typename(p.ty)))
+        })
+        def nativeHook(name: String, static: Boolean, params: Seq[(String, String, String)], ret: Option[TypeRef], f: => Unit): Unit =
+          nativeHookRaw(name, static, params, jniMarshal.fqReturnType(ret), ret.fold("V")(jniMarshal.typename), f)
+        def nativeHookRaw(name: String, static: Boolean, params: Seq[(String, String, String)], jniRetType: String, retSig: String, f: => Unit) = {
+          val paramList = params.map(p => p._1 + " " + p._2).mkString(", ")
+          val javaSig = params.map(_._3).mkString("(", "", ")") + retSig
           w.wl
           val methodNameMunged = name.replaceAllLiterally("_", "_1")
-          val zero = ret.fold("")(s => "0 /* value doesn't matter */")
+          val zero = if (retSig == "V") "" else "0 /* value doesn't matter */"
           if (static) {
-            w.wl(s"CJNIEXPORT $jniRetType JNICALL ${prefix}_$methodNameMunged(JNIEnv* jniEnv, jobject /*this*/${preComma(paramList)})").braced {
+            staticNatives += ((name, javaSig, s"${prefix}_$methodNameMunged"))
+            w.wl(s"$linkage $jniRetType JNICALL ${prefix}_$methodNameMunged(JNIEnv* jniEnv, jobject /*this*/${preComma(paramList)})").braced {
               w.w("try").bracedEnd(s" JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, $zero)") {
                 w.wl(s"DJINNI_FUNCTION_PROLOGUE0(jniEnv);")
                 f
@@ -294,7 +466,9 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
             }
           }
           else {
-            w.wl(s"CJNIEXPORT $jniRetType JNICALL ${prefix}_00024CppProxy_$methodNameMunged(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef${preComma(paramList)})").braced {
+            // CppProxy methods take the native handle first.
+            cppProxyNatives += ((name, "(J" + javaSig.drop(1), s"${prefix}_00024CppProxy_$methodNameMunged"))
+            w.wl(s"$linkage $jniRetType JNICALL ${prefix}_00024CppProxy_$methodNameMunged(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef${preComma(paramList)})").braced {
               w.w("try").bracedEnd(s" JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, $zero)") {
                 w.wl(s"DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);")
                 f
@@ -302,22 +476,87 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
             }
           }
         }
-        nativeHook("nativeDestroy", false, Seq.empty, None, {
-          w.wl(s"delete reinterpret_cast<djinni::CppProxyHandle<$cppSelf>*>(nativeRef);")
-        })
+        // With batched release, handles are deleted by NativeRefQueue.nativeDestroyBatch instead.
+        if (!spec.javaBatchedRelease) {
+          nativeHook("nativeDestroy", false, Seq.empty, None, {
+            w.wl("delete djinni::CppProxyHandleBase::fromJava(nativeRef);")
+          })
+        }
         for (m <- i.methods) {
           val nativeAddon = if (m.static) "" else "native_"
-          nativeHook(nativeAddon + idJava.method(m.ident), m.static, m.params, m.ret, {
+          // Static methods are called from Java directly, so they keep their signatures.
+          val scalar = !m.static
+          val scalarRet = if (scalar) m.ret.flatMap(scalarRecordFields) else None
+          val params = jniParams(m.params, scalar) ++ scalarRet.map(_ => ("jlongArray", "j__slot", "[J"))
+          def paramToCpp(p: Field) = (if (scalar) scalarRecordFields(p.ty) else None) match {
+            case Some(fields) =>
+              val args = fields.map(f => jniMarshal.toCpp(f.ty, "j_" + idJava.local(p.ident) + "_" + idJava.local(f.ident)))
+              cppMarshal.fqTypename(p.ty) + args.mkString("{", ", ", "}")
+            case None => jniMarshal.toCpp(p.ty, "j_" + idJava.local(p.ident))
+          }
+          nativeHook(nativeAddon + idJava.method(m.ident), m.static, params, if (scalarRet.isDefined) None else m.ret, {
             //w.wl(s"::${spec.jniNamespace}::JniLocalScope jscope(jniEnv, 10);")
             if (!m.static) w.wl(s"const auto& ref = ::djinni::CppProxyHandle<$cppSelf>::get(nativeRef);")
             val methodName = idCpp.method(m.ident)
             val ret = m.ret.fold("")(r => "auto r = ")
             val call = if (m.static) s"$cppSelf::$methodName(" else s"ref->$methodName("
-            writeAlignedCall(w, ret + call, m.params, ")", p => jniMarshal.toCpp(p.ty, "j_" + idJava.local(p.ident)))
+            writeAlignedCall(w, ret + call, m.params, ")", paramToCpp)
             w.wl(";")
-            m.ret.fold()(r => w.wl(s"return ::djinni::release(${jniMarshal.fromCpp(r, "r")});"))
+            scalarRet match {
+              case Some(fields) =>
+                w.wl("::djinni::jniSetScalarSlot(jniEnv, j__slot, {")
+                w.nested {
+                  for (f <- fields) {
+                    w.wl(s"::djinni::jniScalarBits(${jniMarshal.fromCpp(f.ty, "r." + idCpp.field(f.ident))}),")
+                  }
+                }
+                w.wl("});")
+              case None =>
+                m.ret.fold()(r => w.wl(s"return ::djinni::release(${jniMarshal.fromCpp(r, "r")});"))
+            }
           })
         }
+        // Replays the calls recorded by the interface's Java Batch, see JavaGenerator.writeBatch.
+        val batched = batchMethods(i, typeParams)
+        if (batched.nonEmpty) {
+          nativeHookRaw("native_djinniExecuteBatch", false, Seq(("jbyteArray", "j_calls", "[B")), "jbyteArray", "[B", {
+            w.wl(s"const auto& ref = ::djinni::CppProxyHandle<$cppSelf>::get(nativeRef);")
+            w.w("return ::djinni::jniExecuteBatch(jniEnv, j_calls, [&](::djinni::WireReader& reader, ::djinni::WireWriter& writer, size_t method)").bracedEnd(").release();") {
+              if (!batched.exists(_.params.nonEmpty)) w.wl("(void)reader;")
+              if (!batched.exists(_.ret.isDefined)) w.wl("(void)writer;")
+              w.w("switch (method)").braced {
+                for ((m, index) <- batched.zipWithIndex) {
+                  w.w(s"case $index:").braced {
+                    for (p <- m.params) {
+                      w.wl(s"auto c_${idCpp.local(p.ident)} = ::djinni::Wire<${jniMarshal.helperClass(p.ty.resolved)}>::read(reader);")
+                    }
+                    val call = s"ref->${idCpp.method(m.ident)}(" + m.params.map(p => s"c_${idCpp.local(p.ident)}").mkString(", ") + ")"
+                    m.ret match {
+                      case Some(r) => w.wl(s"::djinni::Wire<${jniMarshal.helperClass(r.resolved)}>::write(writer, $call);")
+                      case None => w.wl(s"$call;")
+                    }
+                    w.wl("return;")
+                  }
+                }
+              }
+              w.wl("throw std::out_of_range(\"unknown batch method\");")
+            }
+          })
+        }
+        if (registerNatives) {
+          def writeNatives(tableName: String, javaClass: String, natives: Seq[(String, String, String)]) {
+            if (natives.isEmpty) return
+            w.wl
+            w.w(s"static const JNINativeMethod $tableName[] =").bracedSemi {
+              for ((name, sig, fn) <- natives) {
+                w.wl(s"{ const_cast<char*>(${q(name)}), const_cast<char*>(${q(sig)}), reinterpret_cast<void*>(&$fn) },")
+              }
+            }
+            w.wl(s"static const ::djinni::JniNativeMethods ${tableName}_registration(${q(javaClass)}, $tableName);")
+          }
+          writeNatives("s_staticNatives", classLookup, staticNatives)
+          writeNatives("s_cppProxyNatives", classLookup + "$CppProxy", cppProxyNatives)
+        }
       }
     }
 
@@ -353,6 +592,7 @@ class JNIGenerator(spec: Spec) extends Generator(spec) {
     case MString => "(jstring)" + f("Object")
     case MOptional => toJniCall(m.args.head, f, true)
     case MBinary => "(jbyteArray)" + f("Object")
+    case MArray => s"(${jniMarshal.toJniType(m, false)})" + f("Object")
     case _ => f("Object")
   }
 
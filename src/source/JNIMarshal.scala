@@ -31,7 +31,7 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
 
   // Name for the autogenerated class containing field/method IDs and toJava()/fromJava() methods
   def helperClass(name: String) = spec.jniClassIdentStyle(name)
-  private def helperClass(tm: MExpr) = helperName(tm) + helperTemplates(tm)
+  def helperClass(tm: MExpr) = helperName(tm) + helperTemplates(tm)
 
   def references(m: Meta, exclude: String = ""): Seq[SymbolReference] = m match {
     case o: MOpaque => List(ImportRef(q(spec.jniBaseLibIncludePrefix + "Marshal.hpp")))
@@ -48,6 +48,7 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
     case MString => "jstring"
     case MOptional => toJniType(m.args.head, true)
     case MBinary => "jbyteArray"
+    case MArray => toJniType(m.args.head, false) + "Array"
     case tp: MParam => helperClass(tp.name) + "::JniType"
     case e: MExtern => helperClass(m) + (if(needRef) "::Boxed" else "") + "::JniType"
     case _ => "jobject"
@@ -65,12 +66,15 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
       case MString => "Ljava/lang/String;"
       case MDate => "Ljava/util/Date;"
       case MBinary => "[B"
+      case MBuffer => "Ljava/nio/ByteBuffer;"
+      case MFuture => "Ljava/util/concurrent/CompletableFuture;"
       case MOptional =>  tm.args.head.base match {
         case p: MPrimitive => s"Ljava/lang/${p.jBoxed};"
         case MOptional => throw new AssertionError("nested optional?")
         case m => javaTypeSignature(tm.args.head)
       }
       case MList => "Ljava/util/ArrayList;"
+      case MArray => "[" + javaTypeSignature(tm.args.head)
       case MSet => "Ljava/util/HashSet;"
       case MMap => "Ljava/util/HashMap;"
     }
@@ -98,9 +102,12 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
       }
       case MOptional => "Optional"
       case MBinary => "Binary"
+      case MBuffer => "Buffer"
+      case MFuture => "Future"
       case MString => "String"
       case MDate => "Date"
       case MList => "List"
+      case MArray => "Array"
       case MSet => "Set"
       case MMap => "Map"
       case d: MDef => throw new AssertionError("unreachable")
@@ -116,7 +123,7 @@ class JNIMarshal(spec: Spec) extends Marshal(spec) {
         assert(tm.args.size == 1)
         val argHelperClass = helperClass(tm.args.head)
         s"<${spec.cppOptionalTemplate}, $argHelperClass>"
-      case MList | MSet =>
+      case MList | MArray | MSet =>
         assert(tm.args.size == 1)
         f
       case MMap =>
@@ -128,7 +128,26 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
     i.consts.map(c => {
       refs.find(c.ty)
     })
-    if (i.ext.cpp) {
+    val batchedRelease = i.ext.cpp && spec.javaBatchedRelease
+    // An IDL method called close() would clash with AutoCloseable's.
+    val closeable = batchedRelease &&
+      !i.methods.exists(m => !m.static && m.params.isEmpty && idJava.method(m.ident) == "close")
+    // Batched release has no per-proxy flag to make compact.
+    val compactProxy = i.ext.cpp && spec.javaCompactCppProxy && !batchedRelease
+    if (i.ext.cpp && i.methods.exists(m => !m.static && m.ret.flatMap(scalarRecordFields).isDefined)) {
+      refs.java.add("com.dropbox.djinni.ScalarSlot")
+    }
+    val batched = batchMethods(i, typeParams)
+    if (batched.nonEmpty) {
+      refs.java.add("com.dropbox.djinni.CallBatch")
+      refs.java.add("com.dropbox.djinni.WireWriter")
+      if (batched.exists(_.ret.isDefined)) refs.java.add("com.dropbox.djinni.WireReader")
+    }
+    if (batchedRelease) {
+      refs.java.add("com.dropbox.djinni.NativeRefQueue")
+    } else if (compactProxy) {
+      refs.java.add("java.util.concurrent.atomic.AtomicLongFieldUpdater")
+    } else if (i.ext.cpp) {
       refs.java.add("java.util.concurrent.atomic.AtomicBoolean")
     }
 
@@ -138,7 +157,8 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
       writeDoc(w, doc)
 
       javaAnnotationHeader.foreach(w.wl)
-      w.w(s"public abstract class $javaClass$typeParamList").braced {
+      val implementsFlag = if (closeable) " implements AutoCloseable" else ""
+      w.w(s"public abstract class $javaClass$typeParamList$implementsFlag").braced {
         val skipFirst = SkipFirst()
         generateJavaConstants(w, i.consts)
 
@@ -165,40 +185,113 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
           marshal.nullityAnnotation(m.ret).foreach(w.wl)
           w.wl("public static native "+ ret + " " + idJava.method(m.ident) + params.mkString("(", ", ", ")") + ";")
         }
+        if (closeable) {
+          skipFirst { w.wl }
+          w.wl("/**")
+          w.wl(" * Releases the C++ object behind this instance now, instead of after it is garbage")
+          w.wl(" * collected. The instance must not be used afterwards. Does nothing for Java implementations.")
+          w.wl(" */")
+          w.wl("@Override")
+          w.wl("public void close() {}")
+        }
+        if (i.ext.java) {
+          skipFirst { w.wl }
+          w.wl("// Caches System.identityHashCode(this) for the native proxy cache.")
+          w.wl("private int djinniIdentityHash;")
+        }
+        if (batched.nonEmpty) {
+          skipFirst { w.wl }
+          writeBatch(w, javaClass, batched)
+        }
+        val liveCheck =
+          if (batchedRelease) "!this.queueRef.isReleased()"
+          else if (compactProxy) "this.nativeRef != 0"
+          else "!this.destroyed.get()"
         if (i.ext.cpp) {
           w.wl
           javaAnnotationHeader.foreach(w.wl)
           w.wl(s"private static final class CppProxy$typeParamList extends $javaClass$typeParamList").braced {
-            w.wl("private final long nativeRef;")
-            w.wl("private final AtomicBoolean destroyed = new AtomicBoolean(false);")
+            if (compactProxy) {
+              w.wl("private static final AtomicLongFieldUpdater<CppProxy> NATIVE_REF =")
+              w.wl("    AtomicLongFieldUpdater.newUpdater(CppProxy.class, \"nativeRef\");")
+              w.wl("// Zero once destroyed.")
+              w.wl("private volatile long nativeRef;")
+            } else {
+              w.wl("private final long nativeRef;")
+            }
+            if (batchedRelease) {
+              w.wl("private final NativeRefQueue.Ref queueRef;")
+            } else if (!compactProxy) {
+              w.wl("private final AtomicBoolean destroyed = new AtomicBoolean(false);")
+            }
             w.wl
             w.wl(s"private CppProxy(long nativeRef)").braced {
               w.wl("if (nativeRef == 0) throw new RuntimeException(\"nativeRef is zero\");")
               w.wl(s"this.nativeRef = nativeRef;")
+              if (batchedRelease) w.wl("this.queueRef = NativeRefQueue.register(this, nativeRef);")
             }
             w.wl
-            w.wl("private native void nativeDestroy(long nativeRef);")
-            w.wl("public void destroy()").braced {
-              w.wl("boolean destroyed = this.destroyed.getAndSet(true);")
-              w.wl("if (!destroyed) nativeDestroy(this.nativeRef);")
-            }
-            w.wl("protected void finalize() throws java.lang.Throwable").braced {
-              w.wl("destroy();")
-              w.wl("super.finalize();")
+            if (batchedRelease) {
+              if (closeable) w.wl("@Override")
+              w.wl(s"public void ${if (closeable) "close" else "destroy"}()").braced {
+                w.wl("queueRef.release();")
+              }
+            } else {
+              w.wl("private native void nativeDestroy(long nativeRef);")
+              w.wl("public void destroy()").braced {
+                if (compactProxy) {
+                  w.wl("long nativeRef = NATIVE_REF.getAndSet(this, 0);")
+                  w.wl("if (nativeRef != 0) nativeDestroy(nativeRef);")
+                } else {
+                  w.wl("boolean destroyed = this.destroyed.getAndSet(true);")
+                  w.wl("if (!destroyed) nativeDestroy(this.nativeRef);")
+                }
+              }
+              w.wl("protected void finalize() throws java.lang.Throwable").braced {
+                w.wl("destroy();")
+                w.wl("super.finalize();")
+              }
             }
             for (m <- i.methods if !m.static) { // Static methods not in CppProxy
             val ret = marshal.returnType(m.ret)
               val returnStmt = m.ret.fold("")(_ => "return ")
               val params = m.params.map(p => marshal.paramType(p.ty) + " " + idJava.local(p.ident)).mkString(", ")
-              val args = m.params.map(p => idJava.local(p.ident)).mkString(", ")
               val meth = idJava.method(m.ident)
+              // Small records of primitives go to native code as their fields, and come back
+              // through ScalarSlot, see --java-scalar-records.
+              val scalarRet = m.ret.flatMap(scalarRecordFields)
+              val nativeParams = m.params.flatMap(p => scalarRecordFields(p.ty) match {
+                case Some(fields) => fields.map(f => marshal.paramType(f.ty) + " " + idJava.local(p.ident) + "_" + idJava.local(f.ident))
+                case None => Seq(marshal.paramType(p.ty) + " " + idJava.local(p.ident))
+              }) ++ scalarRet.map(_ => "long[] _slot")
+              val nativeArgs = m.params.flatMap(p => scalarRecordFields(p.ty) match {
+                case Some(fields) => fields.map(f => idJava.local(p.ident) + "." + idJava.method("get_" + f.ident.name) + "()")
+                case None => Seq(idJava.local(p.ident))
+              }) ++ scalarRet.map(_ => "_slot")
+              val nativeRet = if (scalarRet.isDefined) "void" else ret
               w.wl
               w.wl(s"@Override")
               w.wl(s"public $ret $meth($params)$throwException").braced {
-                w.wl("assert !this.destroyed.get() : \"trying to use a destroyed object\";")
-                w.wl(s"${returnStmt}native_$meth(this.nativeRef${preComma(args)});")
+                w.wl(s"assert $liveCheck : \"trying to use a destroyed object\";")
+                scalarRet match {
+                  case Some(fields) =>
+                    w.wl("long[] _slot = ScalarSlot.get();")
+                    w.wl(s"native_$meth(this.nativeRef${preComma(nativeArgs.mkString(", "))});")
+                    val values = fields.zipWithIndex.map { case (f, n) => scalarSlotValue(f.ty, s"_slot[$n]") }
+                    w.wl(s"return new $ret(${values.mkString(", ")});")
+                  case None =>
+                    w.wl(s"${returnStmt}native_$meth(this.nativeRef${preComma(nativeArgs.mkString(", "))});")
+                }
+              }
+              w.wl(s"private native $nativeRet native_$meth(long _nativeRef${preComma(nativeParams.mkString(", "))});")
+            }
+            if (batched.nonEmpty) {
+              w.wl
+              w.wl("private byte[] djinniExecuteBatch(byte[] calls)").braced {
+                w.wl(s"assert $liveCheck : \"trying to use a destroyed object\";")
+                w.wl("return native_djinniExecuteBatch(this.nativeRef, calls);")
               }
-              w.wl(s"private native $ret native_$meth(long _nativeRef${preComma(params)});")
+              w.wl("private native byte[] native_djinniExecuteBatch(long _nativeRef, byte[] calls);")
             }
           }
         }
@@ -206,9 +299,168 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
     })
   }
 
+  // The Batch class of an interface, see --java-call-batches and CallBatch.java. Each method
+  // writes its index in batched, then its arguments; JNIGenerator decodes them in that order.
+  def writeBatch(w: IndentWriter, javaClass: String, batched: Seq[Interface.Method]) {
+    w.wl("/**")
+    w.wl(s" * Records calls to a $javaClass, which execute() makes in order with a single call into")
+    w.wl(" * native code. Only methods whose arguments and result can be serialized can be recorded.")
+    w.wl(" */")
+    javaAnnotationHeader.foreach(w.wl)
+    w.wl(s"public static final class Batch extends CallBatch").braced {
+      w.wl("private final CppProxy target;")
+      w.wl
+      val nonnull = javaNonnullAnnotation.map(_ + " ").getOrElse("")
+      w.wl(s"public Batch(${nonnull}$javaClass target)").braced {
+        w.wl("this.target = (CppProxy)target;")
+      }
+      for ((m, index) <- batched.zipWithIndex) {
+        w.wl
+        writeDoc(w, m.doc)
+        val params = m.params.map(p => {
+          val nullityAnnotation = marshal.nullityAnnotation(p.ty).map(_ + " ").getOrElse("")
+          nullityAnnotation + marshal.paramType(p.ty) + " " + idJava.local(p.ident)
+        })
+        val ret = m.ret.fold("void")(r => s"CallBatch.Result<${marshal.boxedTypename(r)}>")
+        if (m.ret.isDefined) javaNonnullAnnotation.foreach(w.wl)
+        w.wl(s"public $ret ${idJava.method(m.ident)}${params.mkString("(", ", ", ")")}").braced {
+          if (m.params.isEmpty) {
+            w.wl(s"djinniRecord($index);")
+          } else {
+            w.wl(s"WireWriter writer = djinniRecord($index);")
+            for (p <- m.params) {
+              writeWireValue(w, p.ty.resolved, idJava.local(p.ident), idJava.local(p.ident))
+            }
+          }
+          m.ret.foreach(r => {
+            val boxed = marshal.boxedTypename(r)
+            w.w(s"return djinniExpect(new CallBatch.Result<$boxed>()").bracedEnd(");") {
+              w.wl("@Override")
+              w.wl(s"protected $boxed read(WireReader reader)").braced {
+                readWireValue(w, r.resolved, "value")
+                w.wl("return value;")
+              }
+            }
+          })
+        }
+      }
+      w.wl
+      w.wl("@Override")
+      w.wl("protected byte[] djinniExecute(byte[] calls)").braced {
+        w.wl("return target.djinniExecuteBatch(calls);")
+      }
+    }
+  }
+
+  // Decodes one field of a record returned through ScalarSlot. Native code stores every field
+  // widened to a long, with floating point values as their raw bits.
+  def scalarSlotValue(ty: TypeRef, slot: String): String = ty.resolved.base match {
+    case p: MPrimitive => p.idlName match {
+      case "i64" => slot
+      case "f32" => s"Float.intBitsToFloat((int)$slot)"
+      case "f64" => s"Double.longBitsToDouble($slot)"
+      case "bool" => s"$slot != 0"
+      case _ => s"(${p.jName})$slot"
+    }
+    case _ => throw new AssertionError("scalar record field must be primitive")
+  }
+
+  // Suffix of the WireWriter/WireReader methods for each primitive
+  private def wirePrimitive(p: MPrimitive): String = p.idlName.capitalize
+
+  // Writes the statements encoding expr, of type tm, to the WireWriter named "writer". Locals
+  // introduced for collection elements are named after the field, so nesting can't clash.
+  def writeWireValue(w: IndentWriter, tm: MExpr, expr: String, name: String): Unit = tm.base match {
+    case p: MPrimitive => w.wl(s"writer.write${wirePrimitive(p)}($expr);")
+    case MString => w.wl(s"writer.writeString($expr);")
+    case MBinary => w.wl(s"writer.writeBinary($expr);")
+    case MDate => w.wl(s"writer.writeDate($expr);")
+    case MOptional =>
+      w.wl(s"if ($expr == null) {").nested {
+        w.wl("writer.writeBool(false);")
+      }
+      w.wl("} else {").nested {
+        w.wl("writer.writeBool(true);")
+        writeWireValue(w, tm.args.head, expr, name)
+      }
+      w.wl("}")
+    case MList | MSet | MArray =>
+      val elem = tm.args.head
+      w.wl(s"writer.writeLength($expr.${if (tm.base == MArray) "length" else "size()"});")
+      w.w(s"for (${marshal.typename(elem)} ${name}Elem : $expr)").braced {
+        writeWireValue(w, elem, name + "Elem", name + "Elem")
+      }
+    case MMap =>
+      val (key, value) = (tm.args(0), tm.args(1))
+      w.wl(s"writer.writeLength($expr.size());")
+      val entry = s"java.util.Map.Entry<${marshal.boxedTypename(key)}, ${marshal.boxedTypename(value)}>"
+      w.w(s"for ($entry ${name}Entry : $expr.entrySet())").braced {
+        writeWireValue(w, key, s"${name}Entry.getKey()", name + "Key")
+        writeWireValue(w, value, s"${name}Entry.getValue()", name + "Value")
+      }
+    case df: MDef => df.defType match {
+      case DEnum => w.wl(s"writer.writeLength($expr.ordinal());")
+      case DRecord => w.wl(s"$expr.writeWire(writer);")
+      case _ => throw new AssertionError("interfaces cannot be serialized")
+    }
+    case _ => throw new AssertionError("type cannot be serialized")
+  }
+
+  // Writes the statements decoding a value of type tm from the WireReader named "reader" into a
+  // new local called name.
+  def readWireValue(w: IndentWriter, tm: MExpr, name: String): Unit = {
+    val ty = marshal.typename(tm)
+    tm.base match {
+      case p: MPrimitive => w.wl(s"$ty $name = reader.read${wirePrimitive(p)}();")
+      case MString => w.wl(s"$ty $name = reader.readString();")
+      case MBinary => w.wl(s"$ty $name = reader.readBinary();")
+      case MDate => w.wl(s"$ty $name = reader.readDate();")
+      case MOptional =>
+        w.wl(s"$ty $name = null;")
+        w.w("if (reader.readBool())").braced {
+          readWireValue(w, tm.args.head, name + "Value")
+          w.wl(s"$name = ${name}Value;")
+        }
+      case MList | MSet =>
+        w.wl(s"int ${name}Size = reader.readLength();")
+        w.wl(s"$ty $name = new $ty(${name}Size);")
+        w.w(s"for (int ${name}Index = 0; ${name}Index < ${name}Size; ++${name}Index)").braced {
+          readWireValue(w, tm.args.head, name + "Elem")
+          w.wl(s"$name.add(${name}Elem);")
+        }
+      case MArray =>
+        w.wl(s"$ty $name = new ${ty.stripSuffix("[]")}[reader.readLength()];")
+        w.w(s"for (int ${name}Index = 0; ${name}Index < $name.length; ++${name}Index)").braced {
+          readWireValue(w, tm.args.head, name + "Elem")
+          w.wl(s"$name[${name}Index] = ${name}Elem;")
+        }
+      case MMap =>
+        w.wl(s"int ${name}Size = reader.readLength();")
+        w.wl(s"$ty $name = new $ty(${name}Size);")
+        w.w(s"for (int ${name}Index = 0; ${name}Index < ${name}Size; ++${name}Index)").braced {
+          readWireValue(w, tm.args(0), name + "Key")
+          readWireValue(w, tm.args(1), name + "Value")
+          w.wl(s"$name.put(${name}Key, ${name}Value);")
+        }
+      case df: MDef => df.defType match {
+        case DEnum => w.wl(s"$ty $name = $ty.values()[reader.readLength()];")
+        case DRecord => w.wl(s"$ty $name = $ty.readWire(reader);")
+        case _ => throw new AssertionError("interfaces cannot be serialized")
+      }
+      case _ => throw new AssertionError("type cannot be serialized")
+    }
+  }
+
   override def generateRecord(origin: String, ident: Ident, doc: Doc, params: Seq[TypeParam], r: Record) {
     val refs = new JavaRefs()
     r.fields.foreach(f => refs.find(f.ty))
+    val columnar = isColumnarRecord(params, r)
+    if (columnar) refs.java.add("java.util.ArrayList")
+    val serialize = r.derivingTypes.contains(DerivingType.Serialize)
+    if (serialize) {
+      refs.java.add("com.dropbox.djinni.WireReader")
+      refs.java.add("com.dropbox.djinni.WireWriter")
+    }
 
     val (javaName, javaFinal) = if (r.ext.java) (ident.name + "_base", "") else (ident.name, " final")
     writeJavaFile(javaName, origin, refs.java, w => {
@@ -259,6 +511,57 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
           }
         }
 
+        if (columnar) {
+          // Called from JNI, which passes lists of this record as one array per field.
+          def column(f: Field) = idJava.local(f.ident) + "Column"
+          val columnParams = r.fields.map(f => s"${marshal.fieldType(f.ty)}[] ${column(f)}").mkString(", ")
+          w.wl
+          w.w(s"/*package*/ static ArrayList<$self> fromColumns($columnParams)").braced {
+            val size = column(r.fields.head) + ".length"
+            w.wl(s"ArrayList<$self> list = new ArrayList<$self>($size);")
+            w.w(s"for (int i = 0; i < $size; ++i)").braced {
+              w.wl(s"list.add(new $self(${r.fields.map(f => column(f) + "[i]").mkString(", ")}));")
+            }
+            w.wl("return list;")
+          }
+          w.wl
+          w.w(s"/*package*/ static void toColumns(ArrayList<$self> list, $columnParams)").braced {
+            w.w(s"for (int i = 0; i < ${column(r.fields.head)}.length; ++i)").braced {
+              w.wl(s"$self element = list.get(i);")
+              for (f <- r.fields) {
+                w.wl(s"${column(f)}[i] = element.${idJava.field(f.ident)};")
+              }
+            }
+          }
+        }
+
+        if (serialize) {
+          // Called from JNI, which passes this record as a single byte array.
+          w.wl
+          w.w(s"/*package*/ byte[] toWire()").braced {
+            w.wl("WireWriter writer = WireWriter.begin();")
+            w.wl("writeWire(writer);")
+            w.wl("return writer.finish();")
+          }
+          w.wl
+          w.w(s"/*package*/ static $self fromWire(byte[] message)").braced {
+            w.wl("return readWire(new WireReader(message));")
+          }
+          w.wl
+          w.w(s"/*package*/ void writeWire(WireWriter writer)").braced {
+            for (f <- r.fields) {
+              writeWireValue(w, f.ty.resolved, "this." + idJava.field(f.ident), idJava.local(f.ident))
+            }
+          }
+          w.wl
+          w.w(s"/*package*/ static $self readWire(WireReader reader)").braced {
+            for (f <- r.fields) {
+              readWireValue(w, f.ty.resolved, idJava.local(f.ident))
+            }
+            w.wl(s"return new $self(${r.fields.map(f => idJava.local(f.ident)).mkString(", ")});")
+          }
+        }
+
         if (r.derivingTypes.contains(DerivingType.Eq)) {
           w.wl
           w.wl("@Override")
@@ -273,7 +576,7 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
               for (f <- r.fields) {
                 skipFirst { w.wl(" &&") }
                 f.ty.resolved.base match {
-                  case MBinary => w.w(s"java.util.Arrays.equals(${idJava.field(f.ident)}, other.${idJava.field(f.ident)})")
+                  case MBinary | MArray => w.w(s"java.util.Arrays.equals(${idJava.field(f.ident)}, other.${idJava.field(f.ident)})")
                   case MList | MSet | MMap => w.w(s"this.${idJava.field(f.ident)}.equals(other.${idJava.field(f.ident)})")
                   case MOptional =>
                     w.w(s"((this.${idJava.field(f.ident)} == null && other.${idJava.field(f.ident)} == null) || ")
@@ -313,7 +616,7 @@ class JavaGenerator(spec: Spec) extends Generator(spec) {
             val multiplier = "31"
             for (f <- r.fields) {
               val fieldHashCode = f.ty.resolved.base match {
-                case MBinary => s"java.util.Arrays.hashCode(${idJava.field(f.ident)})"
+                case MBinary | MArray => s"java.util.Arrays.hashCode(${idJava.field(f.ident)})"
                 case MList | MSet | MMap | MString | MDate => s"${idJava.field(f.ident)}.hashCode()"
                 // Need to repeat this case for MDef
                 case df: MDef => s"${idJava.field(f.ident)}.hashCode()"
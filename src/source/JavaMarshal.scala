@@ -15,6 +15,9 @@ class JavaMarshal(spec: Spec) extends Marshal(spec) {
   override def fqTypename(tm: MExpr): String = toJavaType(tm, spec.javaPackage)
   def fqTypename(name: String, ty: TypeDef): String = withPackage(spec.javaPackage, idJava.ty(name))
 
+  // The type of tm when used as a generic argument, with primitives boxed
+  def boxedTypename(tm: MExpr): String = toJavaType(tm, None, true)
+
   override def paramType(tm: MExpr): String = typename(tm)
   override def fqParamType(tm: MExpr): String = fqTypename(tm)
 
@@ -34,6 +37,8 @@ class JavaMarshal(spec: Spec) extends Marshal(spec) {
         case MSet => List(ImportRef("java.util.HashSet"))
         case MMap => List(ImportRef("java.util.HashMap"))
         case MDate => List(ImportRef("java.util.Date"))
+        case MBuffer => List(ImportRef("java.nio.ByteBuffer"))
+        case MFuture => List(ImportRef("java.util.concurrent.CompletableFuture"))
         case _ => List()
       }
     case _ => List()
@@ -64,7 +69,7 @@ class JavaMarshal(spec: Spec) extends Marshal(spec) {
     case e: Enum =>  true
   }
 
-  private def toJavaType(tm: MExpr, packageName: Option[String]): String = {
+  private def toJavaType(tm: MExpr, packageName: Option[String], boxed: Boolean = false): String = {
     def args(tm: MExpr) = if (tm.args.isEmpty) "" else tm.args.map(f(_, true)).mkString("<", ", ", ">")
     def f(tm: MExpr, needRef: Boolean): String = {
       tm.base match {
@@ -77,6 +82,10 @@ class JavaMarshal(spec: Spec) extends Marshal(spec) {
             case MOptional => throw new AssertionError("nested optional?")
             case m => f(arg, true)
           }
+        case MArray =>
+          // Primitive arrays, with no boxing in either language.
+          assert(tm.args.size == 1)
+          f(tm.args.head, false) + "[]"
         case e: MExtern => (if(needRef) e.java.boxed else e.java.typename) + (if(e.java.generic) args(tm) else "")
         case o =>
           val base = o match {
@@ -84,7 +93,10 @@ class JavaMarshal(spec: Spec) extends Marshal(spec) {
             case MString => "String"
             case MDate => "Date"
             case MBinary => "byte[]"
+            case MBuffer => "ByteBuffer"
+            case MFuture => "CompletableFuture"
             case MOptional => throw new AssertionError("optional should have been special cased")
+            case MArray => throw new AssertionError("array should have been special cased")
             case MList => "ArrayList"
             case MSet => "HashSet"
             case MMap => "HashMap"
@@ -95,7 +107,7 @@ class JavaMarshal(spec: Spec) extends Marshal(spec) {
           base + args(tm)
       }
     }
-    f(tm, false)
+    f(tm, boxed)
   }
 
   private def withPackage(packageName: Option[String], t: String) = packageName.fold(t)(_ + "." + t)
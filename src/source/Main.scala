@@ -31,12 +31,17 @@ object Main {
     var cppOptionalTemplate: String = "std::optional"
     var cppOptionalHeader: String = "<optional>"
     var cppEnumHashWorkaround : Boolean = true
+    var cppBaseLibIncludePrefix: String = ""
     var javaOutFolder: Option[File] = None
     var javaPackage: Option[String] = None
     var javaCppException: Option[String] = None
     var javaAnnotation: Option[String] = None
     var javaNullableAnnotation: Option[String] = None
     var javaNonnullAnnotation: Option[String] = None
+    var javaBatchedRelease: Boolean = false
+    var javaCompactCppProxy: Boolean = false
+    var javaScalarRecords: Int = 0
+    var javaCallBatches: Boolean = false
     var jniOutFolder: Option[File] = None
     var jniHeaderOutFolderOptional: Option[File] = None
     var jniNamespace: String = "djinni_generated"
@@ -46,6 +51,7 @@ object Main {
     var jniFileIdentStyleOptional: Option[IdentConverter] = None
     var jniBaseLibClassIdentStyleOptional: Option[IdentConverter] = None
     var jniBaseLibIncludePrefix: String = ""
+    var jniRegisterNatives: Boolean = false
     var cppHeaderOutFolderOptional: Option[File] = None
     var cppExt: String = "cpp"
     var cppHeaderExt: String = "hpp"
@@ -110,6 +116,15 @@ object Main {
         .text("Java annotation (@Nullable) to place on all fields and return values that are optional")
       opt[String]("java-nonnull-annotation").valueName("<nonnull-annotation-class>").foreach(x => javaNonnullAnnotation = Some(x))
         .text("Java annotation (@Nonnull) to place on all fields and return values that are not optional")
+      opt[Boolean]("java-batched-release").valueName("<true/false>").foreach(x => javaBatchedRelease = x)
+        .text("Release C++ objects behind CppProxy instances from a reference queue in batches instead of finalize(), and make them AutoCloseable (default: false)")
+      opt[Boolean]("java-compact-cpp-proxy").valueName("<true/false>").foreach(x => javaCompactCppProxy = x)
+        .text("Track whether a CppProxy was destroyed in its nativeRef field instead of a separate AtomicBoolean (default: false)")
+      opt[Int]("java-scalar-records").valueName("<max-fields>").foreach(x => javaScalarRecords = x)
+        .validate(x => if (x >= 0 && x <= 8) success else failure("--java-scalar-records must be between 0 and 8"))
+        .text("Pass records with up to this many primitive fields (at most 8) to and from CppProxy methods as separate primitives (default: 0, disabled)")
+      opt[Boolean]("java-call-batches").valueName("<true/false>").foreach(x => javaCallBatches = x)
+        .text("Give C++ interfaces with batch methods a Batch class that records calls to them in Java and makes them all with one JNI call (default: false)")
       note("")
       opt[File]("cpp-out").valueName("<out-folder>").foreach(x => cppOutFolder = Some(x))
         .text("The output folder for C++ files (Generator disabled if unspecified).")
@@ -129,6 +144,8 @@ object Main {
         .text("The header to use for optional values (default: \"<optional>\")")
       opt[Boolean]("cpp-enum-hash-workaround").valueName("<true/false>").foreach(x => cppEnumHashWorkaround = x)
         .text("Work around LWG-2148 by generating std::hash specializations for C++ enums (default: true)")
+      opt[String]("cpp-base-lib-include-prefix").valueName("...").foreach(x => cppBaseLibIncludePrefix = x)
+        .text("The C++ base library's include path, relative to the C++ classes.")
       note("")
       opt[File]("jni-out").valueName("<out-folder>").foreach(x => jniOutFolder = Some(x))
         .text("The folder for the JNI C++ output files (Generator disabled if unspecified).")
@@ -142,6 +159,8 @@ object Main {
         .text("The namespace name to use for generated JNI C++ classes.")
       opt[String]("jni-base-lib-include-prefix").valueName("...").foreach(x => jniBaseLibIncludePrefix = x)
         .text("The JNI base library's include path, relative to the JNI C++ classes.")
+      opt[Boolean]("jni-register-natives").valueName("<true/false>").foreach(x => jniRegisterNatives = x)
+        .text("Bind native methods with RegisterNatives from jniInit instead of exporting a symbol per method (default: false)")
       note("")
       opt[File]("objc-out").valueName("<out-folder>").foreach(x => objcOutFolder = Some(x))
         .text("The output folder for Objective-C files (Generator disabled if unspecified).")
@@ -300,6 +319,10 @@ object Main {
       javaAnnotation,
       javaNullableAnnotation,
       javaNonnullAnnotation,
+      javaBatchedRelease,
+      javaCompactCppProxy,
+      javaScalarRecords,
+      javaCallBatches,
       cppOutFolder,
       cppHeaderOutFolder,
       cppIncludePrefix,
@@ -309,6 +332,7 @@ object Main {
       cppOptionalTemplate,
       cppOptionalHeader,
       cppEnumHashWorkaround,
+      cppBaseLibIncludePrefix,
       jniOutFolder,
       jniHeaderOutFolder,
       jniIncludePrefix,
@@ -317,6 +341,7 @@ object Main {
       jniClassIdentStyle,
       jniFileIdentStyle,
       jniBaseLibIncludePrefix,
+      jniRegisterNatives,
       cppExt,
       cppHeaderExt,
       objcOutFolder,
@@ -278,7 +278,7 @@ class ObjcGenerator(spec: Spec) extends Generator(spec) {
               skipFirst { w.wl(" &&") }
               f.ty.resolved.base match {
                 case MBinary => w.w(s"[self.${idObjc.field(f.ident)} isEqualToData:typedOther.${idObjc.field(f.ident)}]")
-                case MList => w.w(s"[self.${idObjc.field(f.ident)} isEqualToArray:typedOther.${idObjc.field(f.ident)}]")
+                case MList | MArray => w.w(s"[self.${idObjc.field(f.ident)} isEqualToArray:typedOther.${idObjc.field(f.ident)}]")
                 case MSet => w.w(s"[self.${idObjc.field(f.ident)} isEqualToSet:typedOther.${idObjc.field(f.ident)}]")
                 case MMap => w.w(s"[self.${idObjc.field(f.ident)} isEqualToDictionary:typedOther.${idObjc.field(f.ident)}]")
                 case MOptional =>
@@ -425,11 +425,12 @@ class ObjcGenerator(spec: Spec) extends Generator(spec) {
             case p: MPrimitive => if (needRef) (p.objcBoxed, true) else (p.objcName, false)
             case MString => ("NSString", true)
             case MDate => ("NSDate", true)
-            case MBinary => ("NSData", true)
+            case MBinary | MBuffer => ("NSData", true)
             case MOptional => throw new AssertionError("optional should have been special cased")
-            case MList => ("NSArray", true)
+            case MList | MArray => ("NSArray", true)
             case MSet => ("NSSet", true)
             case MMap => ("NSDictionary", true)
+            case MFuture => ("DJIFuture", true)
             case d: MDef => d.defType match {
               case DEnum => if (needRef) ("NSNumber", true) else (idObjc.ty(d.name), false)
               case DRecord => (idObjc.ty(d.name), true)
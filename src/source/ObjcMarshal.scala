@@ -50,6 +50,8 @@ class ObjcMarshal(spec: Spec) extends Marshal(spec) {
   override def fromCpp(tm: MExpr, expr: String): String = throw new AssertionError("direct cpp to objc conversion not possible")
 
   def references(m: Meta, exclude: String = ""): Seq[SymbolReference] = m match {
+    case MFuture =>
+      List(ImportRef("<Foundation/Foundation.h>"), ImportRef(q(spec.objcBaseLibIncludePrefix + "DJIFuture.h")))
     case o: MOpaque =>
       List(ImportRef("<Foundation/Foundation.h>"))
     case d: MDef => d.defType match {
@@ -107,11 +109,12 @@ class ObjcMarshal(spec: Spec) extends Marshal(spec) {
             case p: MPrimitive => if (needRef) (p.objcBoxed, true) else (p.objcName, false)
             case MString => ("NSString", true)
             case MDate => ("NSDate", true)
-            case MBinary => ("NSData", true)
+            case MBinary | MBuffer => ("NSData", true)
             case MOptional => throw new AssertionError("optional should have been special cased")
-            case MList => ("NSArray", true)
+            case MList | MArray => ("NSArray", true)
             case MSet => ("NSSet", true)
             case MMap => ("NSDictionary", true)
+            case MFuture => ("DJIFuture", true)
             case d: MDef => d.defType match {
               case DEnum => if (needRef) ("NSNumber", true) else (idObjc.ty(d.name), false)
               case DRecord => (idObjc.ty(d.name), true)
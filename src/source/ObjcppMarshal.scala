@@ -78,9 +78,11 @@ class ObjcppMarshal(spec: Spec) extends Marshal(spec) {
       }
       case MOptional => "Optional"
       case MBinary => "Binary"
+      case MBuffer => "Buffer"
+      case MFuture => "Future"
       case MDate => "Date"
       case MString => "String"
-      case MList => "List"
+      case MList | MArray => "List"
       case MSet => "Set"
       case MMap => "Map"
       case d: MDef => throw new AssertionError("unreachable")
@@ -96,7 +98,7 @@ class ObjcppMarshal(spec: Spec) extends Marshal(spec) {
         assert(tm.args.size == 1)
         val argHelperClass = helperClass(tm.args.head)
         s"<${spec.cppOptionalTemplate}, $argHelperClass>"
-      case MList | MSet =>
+      case MList | MArray | MSet =>
         assert(tm.args.size == 1)
         f
       case MMap =>
@@ -101,6 +101,8 @@ class YamlGenerator(spec: Spec) extends Generator(spec) {
         r.derivingTypes.collect {
           case Record.DerivingType.Eq => "eq"
           case Record.DerivingType.Ord => "ord"
+          case Record.DerivingType.Serialize => "serialize"
+          case Record.DerivingType.Flat => "flat"
         }.mkString(" deriving(", ", ", ")")
       }
     }
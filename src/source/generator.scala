@@ -35,6 +35,10 @@ package object generatorTools {
                    javaAnnotation: Option[String],
                    javaNullableAnnotation: Option[String],
                    javaNonnullAnnotation: Option[String],
+                   javaBatchedRelease: Boolean,
+                   javaCompactCppProxy: Boolean,
+                   javaScalarRecords: Int,
+                   javaCallBatches: Boolean,
                    cppOutFolder: Option[File],
                    cppHeaderOutFolder: Option[File],
                    cppIncludePrefix: String,
@@ -44,6 +48,7 @@ package object generatorTools {
                    cppOptionalTemplate: String,
                    cppOptionalHeader: String,
                    cppEnumHashWorkaround: Boolean,
+                   cppBaseLibIncludePrefix: String,
                    jniOutFolder: Option[File],
                    jniHeaderOutFolder: Option[File],
                    jniIncludePrefix: String,
@@ -52,6 +57,7 @@ package object generatorTools {
                    jniClassIdentStyle: IdentConverter,
                    jniFileIdentStyle: IdentConverter,
                    jniBaseLibIncludePrefix: String,
+                   jniRegisterNatives: Boolean,
                    cppExt: String,
                    cppHeaderExt: String,
                    objcOutFolder: Option[File],
@@ -346,6 +352,29 @@ abstract class Generator(spec: Spec)
   def generateRecord(origin: String, ident: Ident, doc: Doc, params: Seq[TypeParam], r: Record)
   def generateInterface(origin: String, ident: Ident, doc: Doc, typeParams: Seq[TypeParam], i: Interface)
 
+  // Records with only primitive fields, whose lists the JNI layer passes as one primitive
+  // array per field. The Java generator adds the helpers this needs to the record class.
+  def isColumnarRecord(params: Seq[TypeParam], r: Record): Boolean =
+    params.isEmpty && !r.ext.java && r.fields.nonEmpty &&
+      r.fields.forall(_.ty.resolved.base.isInstanceOf[MPrimitive])
+
+  // The fields of a record that CppProxy methods pass across JNI one by one instead of as an
+  // object, see --java-scalar-records. Records extended in either language are left alone, since
+  // their constructors may differ from the generated ones.
+  def scalarRecordFields(ty: TypeRef): Option[Seq[Field]] = ty.resolved match {
+    case MExpr(MDef(_, 0, DRecord, r: Record), _) if !r.ext.java && !r.ext.cpp &&
+      r.fields.nonEmpty && r.fields.size <= spec.javaScalarRecords &&
+      r.fields.forall(_.ty.resolved.base.isInstanceOf[MPrimitive]) => Some(r.fields)
+    case _ => None
+  }
+
+  // The methods a Batch can record, numbered in this order on both sides of JNI, see
+  // --java-call-batches. Only methods marked batch are recorded; the resolver has checked that
+  // their arguments and result can be encoded. Empty if there's no Batch.
+  def batchMethods(i: Interface, typeParams: Seq[TypeParam]): Seq[Interface.Method] =
+    if (!spec.javaCallBatches || typeParams.nonEmpty) Seq()
+    else i.methods.filter(_.batch)
+
   // --------------------------------------------------------------------------
   // Render type expression
 
@@ -89,10 +89,13 @@ case class MPrimitive(_idlName: String, jName: String, jniName: String, cName: S
 case object MString extends MOpaque { val numParams = 0; val idlName = "string" }
 case object MDate extends MOpaque { val numParams = 0; val idlName = "date" }
 case object MBinary extends MOpaque { val numParams = 0; val idlName = "binary" }
+case object MBuffer extends MOpaque { val numParams = 0; val idlName = "buffer" }
 case object MOptional extends MOpaque { val numParams = 1; val idlName = "optional" }
 case object MList extends MOpaque { val numParams = 1; val idlName = "list" }
+case object MArray extends MOpaque { val numParams = 1; val idlName = "array" } // Primitive elements only
 case object MSet extends MOpaque { val numParams = 1; val idlName = "set" }
 case object MMap extends MOpaque { val numParams = 2; val idlName = "map" }
+case object MFuture extends MOpaque { val numParams = 1; val idlName = "future" } // Method returns only
 
 val defaults: Map[String,MOpaque] = immutable.HashMap(
   ("i8",   MPrimitive("i8",   "byte",    "jbyte",    "uint8",  "Byte",    "B", "int8_t",  "NSNumber", "uint8", "Platform::IBox<uint8>")),
@@ -104,9 +107,12 @@ val defaults: Map[String,MOpaque] = immutable.HashMap(
   ("bool", MPrimitive("bool", "boolean", "jboolean", "bool",    "Boolean", "Z", "BOOL",    "NSNumber", "bool", "Platform::IBox<bool>")),
   ("string", MString),
   ("binary", MBinary),
+  ("buffer", MBuffer),
   ("optional", MOptional),
   ("date", MDate),
   ("list", MList),
+  ("array", MArray),
   ("set", MSet),
-  ("map", MMap))
+  ("map", MMap),
+  ("future", MFuture))
 }
@@ -108,6 +108,8 @@ private object IdlParser extends RegexParsers {
     _.map(ident => ident.name match {
       case "eq" => Record.DerivingType.Eq
       case "ord" => Record.DerivingType.Ord
+      case "serialize" => Record.DerivingType.Serialize
+      case "flat" => Record.DerivingType.Flat
       case _ => return err( s"""Unrecognized deriving type "${ident.name}"""")
     }).toSet
   }
@@ -140,8 +142,21 @@ private object IdlParser extends RegexParsers {
     case "const " => true
     case "" => false
   }
-  def method: Parser[Interface.Method] = doc ~ staticLabel ~ constLabel ~ ident ~ parens(repsepend(field, ",")) ~ opt(ret) ^^ {
-    case doc~staticLabel~constLabel~ ident~params~ret => Interface.Method(ident, params, ret, doc, staticLabel, constLabel)
+  def onewayLabel: Parser[Boolean] = ("oneway ".r | "".r) ^^ {
+    case "oneway " => true
+    case "" => false
+  }
+  def coalesceLabel: Parser[Boolean] = ("coalesce ".r | "".r) ^^ {
+    case "coalesce " => true
+    case "" => false
+  }
+  def batchLabel: Parser[Boolean] = ("batch ".r | "".r) ^^ {
+    case "batch " => true
+    case "" => false
+  }
+
+  def method: Parser[Interface.Method] = doc ~ staticLabel ~ constLabel ~ onewayLabel ~ coalesceLabel ~ batchLabel ~ ident ~ parens(repsepend(field, ",")) ~ opt(ret) ^^ {
+    case doc~staticLabel~constLabel~onewayLabel~coalesceLabel~batchLabel~ ident~params~ret => Interface.Method(ident, params, ret, doc, staticLabel, constLabel, onewayLabel, coalesceLabel, batchLabel)
   }
   def ret: Parser[TypeRef] = ":" ~> typeRef
 
@@ -135,7 +135,7 @@ private def constTypeCheck(ty: MExpr, value: Any, resolvedConsts: Seq[Const]) {
     throw new AssertionError(s"Const ${ref.name} does not exist")
   }
   ty.base match {
-    case MBinary | MList | MSet | MMap =>
+    case MBinary | MBuffer | MList | MArray | MSet | MMap =>
       throw new AssertionError("Type not allowed for constant")
     case MString =>
       if (!value.isInstanceOf[String] ||
@@ -213,6 +213,7 @@ private def resolveRecord(scope: Scope, r: Record) {
   for (f <- r.fields) {
     dupeChecker.check(f.ident)
     resolveRef(scope, f.ty)
+    checkNoFuture(f.ident, f.ty.resolved)
     // Deriving Type Check
     if (r.ext.any())
       if (r.derivingTypes.contains(DerivingType.Ord)) {
@@ -221,9 +222,12 @@ private def resolveRecord(scope: Scope, r: Record) {
         throw new Error(f.ident.loc, "Cannot safely implement Eq on a record that may be extended").toException
       }
     f.ty.resolved.base match {
-      case MBinary | MList | MSet | MMap =>
+      case MBinary | MList | MArray | MSet | MMap =>
         if (r.derivingTypes.contains(DerivingType.Ord))
           throw new Error(f.ident.loc, "Cannot compare collections in Ord deriving (Java limitation)").toException
+      case MBuffer =>
+        if (r.derivingTypes.contains(DerivingType.Eq) || r.derivingTypes.contains(DerivingType.Ord))
+          throw new Error(f.ident.loc, "Cannot compare buffers in Eq or Ord deriving").toException
       case MString =>
       case MDate =>
       case MOptional =>
@@ -256,10 +260,80 @@ private def resolveRecord(scope: Scope, r: Record) {
       case _ => throw new AssertionError("Type cannot be resolved")
     }
   }
+  if (r.derivingTypes.contains(DerivingType.Serialize)) {
+    if (r.ext.any() && r.fields.nonEmpty)
+      throw new Error(r.fields.head.ident.loc, "Cannot serialize a record that may be extended").toException
+    for (f <- r.fields)
+      checkSerializable(f.ident, f.ty.resolved)
+  }
+  if (r.derivingTypes.contains(DerivingType.Flat)) {
+    if (r.ext.cpp && r.fields.nonEmpty)
+      throw new Error(r.fields.head.ident.loc, "Cannot lay out a record that is extended in C++ as flat").toException
+    for (f <- r.fields)
+      checkFlat(f.ident, f.ty.resolved)
+  }
   // Name checking for constants. Type check only possible after resolving record field types.
   for (c <- r.consts) {
     dupeChecker.check(c.ident)
     resolveRef(scope, c.ty)
+    checkNoFuture(c.ident, c.ty.resolved)
+  }
+}
+
+// Serialized records are written field by field on both sides, so every type they contain
+// needs a wire encoding in the support libraries.
+private def checkSerializable(field: Ident, tm: MExpr) {
+  tm.base match {
+    case _: MPrimitive | MString | MBinary | MDate =>
+    case MOptional | MList | MArray | MSet | MMap => tm.args.foreach(checkSerializable(field, _))
+    case MBuffer =>
+      throw new Error(field.loc, "Cannot serialize buffers").toException
+    case df: MDef => df.defType match {
+      case DRecord =>
+        if (!df.body.asInstanceOf[Record].derivingTypes.contains(DerivingType.Serialize))
+          throw new Error(field.loc, s"Record ${df.name} must also derive serialize to be used in ${field.name}").toException
+      case DEnum =>
+      case DInterface =>
+        throw new Error(field.loc, "Interface reference cannot live in a record").toException
+    }
+    case e: MExtern =>
+      throw new Error(field.loc, s"Cannot serialize extern type ${e.name}").toException
+    case p: MParam =>
+      throw new Error(field.loc, s"Cannot serialize generic type ${p.name}").toException
+  }
+}
+
+// Flat records are read in place, so everything in them needs a flat layout in the support
+// library, and set elements and map keys need an order to be binary searched by.
+private def checkFlat(field: Ident, tm: MExpr) {
+  def checkKey(key: MExpr) = key.base match {
+    case _: MPrimitive | MString | MBinary | MDate =>
+    case df: MDef if df.defType == DEnum =>
+    case _ =>
+      throw new Error(field.loc, "Flat set elements and map keys must be primitives, strings, binary, dates or enums").toException
+  }
+  tm.base match {
+    case _: MPrimitive | MString | MBinary | MDate =>
+    case MOptional | MList | MArray => tm.args.foreach(checkFlat(field, _))
+    case MSet =>
+      checkKey(tm.args.head)
+    case MMap =>
+      checkKey(tm.args.head)
+      checkFlat(field, tm.args(1))
+    case MBuffer =>
+      throw new Error(field.loc, "Cannot lay out buffers as flat").toException
+    case df: MDef => df.defType match {
+      case DRecord =>
+        if (!df.body.asInstanceOf[Record].derivingTypes.contains(DerivingType.Flat))
+          throw new Error(field.loc, s"Record ${df.name} must also derive flat to be used in ${field.name}").toException
+      case DEnum =>
+      case DInterface =>
+        throw new Error(field.loc, "Interface reference cannot live in a record").toException
+    }
+    case e: MExtern =>
+      throw new Error(field.loc, s"Cannot lay out extern type ${e.name} as flat").toException
+    case p: MParam =>
+      throw new Error(field.loc, s"Cannot lay out generic type ${p.name} as flat").toException
   }
 }
 
@@ -279,24 +353,77 @@ private def resolveInterface(scope: Scope, i: Interface) {
         throw Error(m.ident.loc, "+c method cannot be both static and const").toException
     }
   }
+  // oneway calls are queued for Java to pick up later, so nothing can come back from them.
+  for (m <- i.methods if m.oneway) {
+    if (!i.ext.java)
+      throw Error(m.ident.loc, "oneway only allowed for +j interfaces").toException
+    if (m.static || m.ret.isDefined)
+      throw Error(m.ident.loc, "oneway method must be non-static and return nothing").toException
+  }
+  // coalesce calls are also queued, and may be replaced by later ones before Java sees them.
+  for (m <- i.methods if m.coalesce) {
+    if (!i.ext.java)
+      throw Error(m.ident.loc, "coalesce only allowed for +j interfaces").toException
+    if (m.static || m.ret.isDefined)
+      throw Error(m.ident.loc, "coalesce method must be non-static and return nothing").toException
+    if (m.oneway)
+      throw Error(m.ident.loc, "method cannot be both oneway and coalesce").toException
+  }
+  // batch calls are recorded in Java and made by the C++ object, see --java-call-batches.
+  for (m <- i.methods if m.batch) {
+    if (!i.ext.cpp || i.ext.java)
+      throw Error(m.ident.loc, "batch only allowed for +c interfaces that are not also +j").toException
+    if (m.static)
+      throw Error(m.ident.loc, "batch method must be non-static").toException
+  }
   val dupeChecker = new DupeChecker("method")
   for (m <- i.methods) {
     dupeChecker.check(m.ident)
     for (p <- m.params) {
       resolveRef(scope, p.ty)
+      checkNoFuture(p.ident, p.ty.resolved)
     }
     m.ret match {
-      case Some(ty) => resolveRef(scope, ty)
+      case Some(ty) =>
+        resolveRef(scope, ty)
+        // A future is completed by whoever returned it, so it only makes sense as the result.
+        if (ty.resolved.base == MFuture)
+          ty.resolved.args.foreach(checkNoFuture(m.ident, _))
+        else
+          checkNoFuture(m.ident, ty.resolved)
       case _ =>
     }
+    // A batch sends its arguments and results in the wire format.
+    if (m.batch) {
+      for (p <- m.params)
+        checkBatchable(p.ident, p.ty.resolved)
+      m.ret.foreach(r => checkBatchable(m.ident, r.resolved))
+    }
   }
   // Name checking for constants. Type check only possible after resolving record field types.
   for (c <- i.consts) {
     dupeChecker.check(c.ident)
     resolveRef(scope, c.ty)
+    checkNoFuture(c.ident, c.ty.resolved)
   }
 }
 
+private def checkBatchable(ident: Ident, tm: MExpr) {
+  tm.base match {
+    case MFuture =>
+      throw Error(ident.loc, "Cannot record futures in a batch").toException
+    case df: MDef if df.defType == DInterface =>
+      throw Error(ident.loc, "Cannot record interface references in a batch").toException
+    case _ => checkSerializable(ident, tm)
+  }
+}
+
+private def checkNoFuture(ident: Ident, tm: MExpr) {
+  if (tm.base == MFuture)
+    throw Error(ident.loc, "future<T> is only allowed as the return type of a method").toException
+  tm.args.foreach(checkNoFuture(ident, _))
+}
+
 private def resolveRef(scope: Scope, r: TypeRef) {
   if (r.resolved != null) throw new AssertionError("double-resolve?")
   r.resolved = buildMExpr(scope, r.expr)
@@ -314,6 +441,10 @@ private def buildMExpr(scope: Scope, e: TypeExpr): MExpr = {
         // HACK: In Java, we use "null" for optionals, so we don't allow nested optionals.
         throw Error(e.ident.loc, "directly nested optionals not allowed").toException
       }
+      if (meta == MArray && !margs.head.base.isInstanceOf[MPrimitive]) {
+        // Backed by a Java primitive array, so there is no way to hold anything else.
+        throw Error(e.ident.loc, "array elements must be a primitive type").toException
+      }
       MExpr(meta, margs)
     }
     case None =>
@@ -0,0 +1,546 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#error "djinni flat snapshots are little-endian and are read in place"
+#endif
+
+/*
+ * Flat layout of records declared with deriving(flat). A snapshot written by a generated
+ * XxxBuilder can be read in place by the matching XxxView, for example straight from an
+ * mmap'd file, without building the C++ record or any of its containers.
+ *
+ * A snapshot starts with a 24-byte header: magic, format version, the layout hash of the root
+ * record, and the offset of the root record. Everything else is a block of 8-byte aligned
+ * data, found through a 64-bit offset from the start of the snapshot:
+ *  - record: one slot per field in declaration order, each aligned to its own size
+ *  - bool, i8: 1-byte slot; i16: 2; i32, f32 and enum (its value): 4
+ *  - i64, f64 and date (milliseconds since the POSIX epoch): 8
+ *  - all other types use an 8-byte slot holding the offset of their block
+ *  - string, binary: 64-bit count, then the bytes
+ *  - list, array, set: count, then one slot per element; set elements are sorted
+ *  - map: count, then the key slots sorted by key, then (8-byte aligned) the value slots
+ *  - optional: offset 0 if absent, else the offset of a block holding one slot
+ * All numbers are little-endian. The layout hash covers field names and types of the root
+ * record and everything it contains, so a snapshot is only read by code generated from the
+ * same IDL.
+ */
+
+namespace djinni {
+
+static constexpr uint32_t kFlatMagic = 0x4c464a44; // "DJFL"
+static constexpr uint32_t kFlatVersion = 1;
+static constexpr uint64_t kFlatHeaderBytes = 24;
+
+/*
+ * The bytes of a snapshot, which must outlive every view into them. Views hold a copy, and
+ * every read is bounds checked, so a truncated or corrupt file throws std::out_of_range
+ * instead of reading past the mapping.
+ */
+class FlatData {
+public:
+    FlatData(const void * data, size_t size) noexcept
+        : m_data(static_cast<const uint8_t *>(data)), m_size(size) {}
+
+    const uint8_t * bytes(uint64_t at, uint64_t size) const {
+        if (at > m_size || size > m_size - at) {
+            throw std::out_of_range("djinni flat offset is out of range");
+        }
+        return m_data + at;
+    }
+
+    // Checks that count slots of slotSize bytes fit at the given offset.
+    void checkArray(uint64_t at, uint64_t count, uint64_t slotSize) const {
+        if (at > m_size || count > (m_size - at) / slotSize) {
+            throw std::out_of_range("djinni flat count is out of range");
+        }
+    }
+
+    template <class T>
+    T load(uint64_t at) const {
+        T v;
+        std::memcpy(&v, bytes(at, sizeof(T)), sizeof(T));
+        return v;
+    }
+
+    // Checks the header and returns the offset of the root record.
+    uint64_t root(uint64_t layoutHash, uint64_t rootSize) const {
+        if (load<uint32_t>(0) != kFlatMagic || load<uint32_t>(4) != kFlatVersion) {
+            throw std::invalid_argument("not a djinni flat snapshot");
+        }
+        if (load<uint64_t>(8) != layoutHash) {
+            throw std::invalid_argument("djinni flat snapshot has a different layout");
+        }
+        const uint64_t at = load<uint64_t>(16);
+        bytes(at, rootSize);
+        return at;
+    }
+
+private:
+    const uint8_t * m_data;
+    size_t m_size;
+};
+
+/*
+ * A snapshot being written. Blocks are appended in the order they are written and referred
+ * to by offset, so growing the buffer never invalidates anything.
+ */
+class FlatBuilder {
+public:
+    FlatBuilder() : m_buffer(kFlatHeaderBytes, 0) {}
+
+    void reserve(size_t bytes) { m_buffer.reserve(bytes); }
+
+    // Appends a zero-filled block and returns its offset.
+    uint64_t allocate(uint64_t size) {
+        const uint64_t at = (m_buffer.size() + 7) & ~uint64_t(7);
+        m_buffer.resize(static_cast<size_t>(at + size));
+        return at;
+    }
+
+    template <class T>
+    void store(uint64_t at, T v) {
+        std::memcpy(&m_buffer[static_cast<size_t>(at)], &v, sizeof(T));
+    }
+
+    void storeBytes(uint64_t at, const void * data, size_t size) {
+        if (size > 0) {
+            std::memcpy(&m_buffer[static_cast<size_t>(at)], data, size);
+        }
+    }
+
+    // Fills in the header and hands over the snapshot. The builder is empty afterwards.
+    std::vector<uint8_t> finish(uint64_t layoutHash, uint64_t root) {
+        store(0, kFlatMagic);
+        store(4, kFlatVersion);
+        store(8, layoutHash);
+        store(16, root);
+        return std::move(m_buffer);
+    }
+
+private:
+    std::vector<uint8_t> m_buffer;
+};
+
+/*
+ * Helpers for each IDL type, in the same spirit as the JNI marshalling helpers. Each has:
+ *  - kSlot: size and alignment of its slot
+ *  - CppType, and View: what a view hands out, which refers into the snapshot
+ *  - view() and write() to read and write the slot at an offset
+ *  - toCpp() to turn a View into a CppType
+ * Types usable as set elements and map keys also have less() and compare() for sorting and
+ * binary search.
+ */
+
+template <class T>
+struct FlatPrimitive {
+    static constexpr uint64_t kSlot = sizeof(T);
+    using CppType = T;
+    using View = T;
+
+    static View view(const FlatData & d, uint64_t slot) { return d.load<T>(slot); }
+    static void write(FlatBuilder & b, uint64_t slot, T v) { b.store(slot, v); }
+    static CppType toCpp(View v) { return v; }
+
+    static bool less(T a, T b) { return a < b; }
+    static int compare(View a, T b) { return a < b ? -1 : (b < a ? 1 : 0); }
+};
+
+using FlatI8 = FlatPrimitive<int8_t>;
+using FlatI16 = FlatPrimitive<int16_t>;
+using FlatI32 = FlatPrimitive<int32_t>;
+using FlatI64 = FlatPrimitive<int64_t>;
+using FlatF32 = FlatPrimitive<float>;
+using FlatF64 = FlatPrimitive<double>;
+
+struct FlatBool {
+    static constexpr uint64_t kSlot = 1;
+    using CppType = bool;
+    using View = bool;
+
+    static View view(const FlatData & d, uint64_t slot) { return d.load<uint8_t>(slot) != 0; }
+    static void write(FlatBuilder & b, uint64_t slot, bool v) { b.store<uint8_t>(slot, v ? 1 : 0); }
+    static CppType toCpp(View v) { return v; }
+
+    static bool less(bool a, bool b) { return a < b; }
+    static int compare(View a, bool b) { return int(a) - int(b); }
+};
+
+struct FlatDate {
+    static constexpr uint64_t kSlot = 8;
+    using CppType = std::chrono::system_clock::time_point;
+    using View = CppType;
+
+    static View view(const FlatData & d, uint64_t slot) {
+        return CppType(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::milliseconds(d.load<int64_t>(slot))));
+    }
+    static void write(FlatBuilder & b, uint64_t slot, const CppType & v) {
+        b.store<int64_t>(slot, std::chrono::duration_cast<std::chrono::milliseconds>(v.time_since_epoch()).count());
+    }
+    static CppType toCpp(View v) { return v; }
+
+    static bool less(const CppType & a, const CppType & b) { return a < b; }
+    static int compare(View a, const CppType & b) { return a < b ? -1 : (b < a ? 1 : 0); }
+};
+
+template <class E>
+struct FlatEnum {
+    static constexpr uint64_t kSlot = 4;
+    using CppType = E;
+    using View = E;
+
+    static View view(const FlatData & d, uint64_t slot) { return static_cast<E>(d.load<int32_t>(slot)); }
+    static void write(FlatBuilder & b, uint64_t slot, E v) { b.store(slot, static_cast<int32_t>(v)); }
+    static CppType toCpp(View v) { return v; }
+
+    static bool less(E a, E b) { return static_cast<int32_t>(a) < static_cast<int32_t>(b); }
+    static int compare(View a, E b) { return less(a, b) ? -1 : (less(b, a) ? 1 : 0); }
+};
+
+/*
+ * The bytes of a string or binary value inside a snapshot. Not NUL-terminated.
+ */
+template <class CppT>
+class FlatBytesView {
+public:
+    using value_type = typename CppT::value_type;
+
+    FlatBytesView(const value_type * data, size_t size) noexcept : m_data(data), m_size(size) {}
+
+    const value_type * data() const noexcept { return m_data; }
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    const value_type * begin() const noexcept { return m_data; }
+    const value_type * end() const noexcept { return m_data + m_size; }
+
+    CppT toCpp() const { return CppT(begin(), end()); }
+
+    // Orders like std::string, by unsigned bytes and then by length.
+    int compare(const CppT & other) const {
+        const size_t n = std::min(m_size, other.size());
+        const int c = n > 0 ? std::memcmp(m_data, other.data(), n) : 0;
+        if (c != 0) {
+            return c;
+        }
+        return m_size < other.size() ? -1 : (m_size > other.size() ? 1 : 0);
+    }
+
+    friend bool operator==(const FlatBytesView & lhs, const CppT & rhs) { return lhs.compare(rhs) == 0; }
+    friend bool operator!=(const FlatBytesView & lhs, const CppT & rhs) { return lhs.compare(rhs) != 0; }
+
+private:
+    const value_type * m_data;
+    size_t m_size;
+};
+
+using FlatStringView = FlatBytesView<std::string>;
+using FlatBinaryView = FlatBytesView<std::vector<uint8_t>>;
+
+template <class CppT>
+struct FlatBytes {
+    static constexpr uint64_t kSlot = 8;
+    using CppType = CppT;
+    using View = FlatBytesView<CppT>;
+
+    static View view(const FlatData & d, uint64_t slot) {
+        const uint64_t at = d.load<uint64_t>(slot);
+        const uint64_t size = d.load<uint64_t>(at);
+        return View(reinterpret_cast<const typename View::value_type *>(d.bytes(at + 8, size)),
+                    static_cast<size_t>(size));
+    }
+    static void write(FlatBuilder & b, uint64_t slot, const CppT & v) {
+        const uint64_t at = b.allocate(8 + v.size());
+        b.store(slot, at);
+        b.store<uint64_t>(at, v.size());
+        b.storeBytes(at + 8, v.data(), v.size());
+    }
+    static CppType toCpp(const View & v) { return v.toCpp(); }
+
+    static bool less(const CppT & a, const CppT & b) { return a < b; }
+    static int compare(const View & a, const CppT & b) { return a.compare(b); }
+};
+
+using FlatString = FlatBytes<std::string>;
+using FlatBinary = FlatBytes<std::vector<uint8_t>>;
+
+/*
+ * The elements of a list, array or set inside a snapshot.
+ */
+template <class T>
+class FlatListView {
+public:
+    class const_iterator {
+    public:
+        const_iterator(const FlatListView * list, size_t i) noexcept : m_list(list), m_i(i) {}
+        typename T::View operator*() const { return (*m_list)[m_i]; }
+        const_iterator & operator++() noexcept { ++m_i; return *this; }
+        bool operator==(const const_iterator & other) const noexcept { return m_i == other.m_i; }
+        bool operator!=(const const_iterator & other) const noexcept { return m_i != other.m_i; }
+    private:
+        const FlatListView * m_list;
+        size_t m_i;
+    };
+
+    FlatListView(const FlatData & d, uint64_t at) : m_data(d), m_at(at) {
+        const uint64_t count = d.load<uint64_t>(at);
+        d.checkArray(at + 8, count, T::kSlot);
+        m_size = static_cast<size_t>(count);
+    }
+
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    typename T::View operator[](size_t i) const { return T::view(m_data, m_at + 8 + i * T::kSlot); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, m_size); }
+
+protected:
+    // Index of the first element that is not less than key.
+    size_t lowerBound(const typename T::CppType & key) const {
+        size_t lo = 0;
+        size_t hi = m_size;
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+            if (T::compare((*this)[mid], key) < 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    FlatData m_data;
+    uint64_t m_at;
+    size_t m_size;
+};
+
+template <class T>
+class FlatSetView : public FlatListView<T> {
+public:
+    using FlatListView<T>::FlatListView;
+
+    bool contains(const typename T::CppType & key) const {
+        const size_t i = this->lowerBound(key);
+        return i < this->m_size && T::compare((*this)[i], key) == 0;
+    }
+};
+
+/*
+ * The entries of a map inside a snapshot, sorted by key. Lookups are binary searches.
+ */
+template <class K, class V>
+class FlatMapView {
+public:
+    FlatMapView(const FlatData & d, uint64_t at) : m_keys(d, at), m_data(d) {
+        m_values = valuesAt(at, m_keys.size());
+        d.checkArray(m_values, m_keys.size(), V::kSlot);
+    }
+
+    size_t size() const noexcept { return m_keys.size(); }
+    bool empty() const noexcept { return m_keys.empty(); }
+    typename K::View key(size_t i) const { return m_keys[i]; }
+    typename V::View value(size_t i) const { return V::view(m_data, m_values + i * V::kSlot); }
+
+    // Index of the entry with the given key, or size() if there is none.
+    size_t find(const typename K::CppType & key) const {
+        const size_t i = m_keys.lowerBound(key);
+        return i < size() && K::compare(m_keys[i], key) == 0 ? i : size();
+    }
+    bool contains(const typename K::CppType & key) const { return find(key) != size(); }
+
+    // Throws std::out_of_range if there is no such key.
+    typename V::View at(const typename K::CppType & key) const {
+        const size_t i = find(key);
+        if (i == size()) {
+            throw std::out_of_range("key not found in djinni flat map");
+        }
+        return value(i);
+    }
+
+    static uint64_t valuesAt(uint64_t at, uint64_t count) {
+        return (at + 8 + count * K::kSlot + 7) & ~uint64_t(7);
+    }
+
+private:
+    struct Keys : FlatListView<K> {
+        using FlatListView<K>::FlatListView;
+        using FlatListView<K>::lowerBound;
+    };
+
+    Keys m_keys;
+    FlatData m_data;
+    uint64_t m_values;
+};
+
+template <class T>
+struct FlatList {
+    static constexpr uint64_t kSlot = 8;
+    using CppType = std::vector<typename T::CppType>;
+    using View = FlatListView<T>;
+
+    static View view(const FlatData & d, uint64_t slot) { return View(d, d.load<uint64_t>(slot)); }
+    static void write(FlatBuilder & b, uint64_t slot, const CppType & v) {
+        const uint64_t at = b.allocate(8 + v.size() * T::kSlot);
+        b.store(slot, at);
+        b.store<uint64_t>(at, v.size());
+        for (size_t i = 0; i < v.size(); ++i) {
+            T::write(b, at + 8 + i * T::kSlot, v[i]);
+        }
+    }
+    static CppType toCpp(const View & v) {
+        CppType c;
+        c.reserve(v.size());
+        for (size_t i = 0; i < v.size(); ++i) {
+            c.push_back(T::toCpp(v[i]));
+        }
+        return c;
+    }
+};
+
+template <class T>
+struct FlatSet {
+    static constexpr uint64_t kSlot = 8;
+    using CppType = std::unordered_set<typename T::CppType>;
+    using View = FlatSetView<T>;
+
+    static View view(const FlatData & d, uint64_t slot) { return View(d, d.load<uint64_t>(slot)); }
+    static void write(FlatBuilder & b, uint64_t slot, const CppType & v) {
+        std::vector<const typename T::CppType *> sorted;
+        sorted.reserve(v.size());
+        for (const auto & e : v) {
+            sorted.push_back(&e);
+        }
+        std::sort(sorted.begin(), sorted.end(), [] (const typename T::CppType * x, const typename T::CppType * y) {
+            return T::less(*x, *y);
+        });
+        const uint64_t at = b.allocate(8 + sorted.size() * T::kSlot);
+        b.store(slot, at);
+        b.store<uint64_t>(at, sorted.size());
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            T::write(b, at + 8 + i * T::kSlot, *sorted[i]);
+        }
+    }
+    static CppType toCpp(const View & v) {
+        CppType c;
+        c.reserve(v.size());
+        for (size_t i = 0; i < v.size(); ++i) {
+            c.insert(T::toCpp(v[i]));
+        }
+        return c;
+    }
+};
+
+template <class K, class V>
+struct FlatMap {
+    static constexpr uint64_t kSlot = 8;
+    using CppType = std::unordered_map<typename K::CppType, typename V::CppType>;
+    using View = FlatMapView<K, V>;
+
+    static View view(const FlatData & d, uint64_t slot) { return View(d, d.load<uint64_t>(slot)); }
+    static void write(FlatBuilder & b, uint64_t slot, const CppType & v) {
+        std::vector<const typename CppType::value_type *> sorted;
+        sorted.reserve(v.size());
+        for (const auto & e : v) {
+            sorted.push_back(&e);
+        }
+        std::sort(sorted.begin(), sorted.end(), [] (const typename CppType::value_type * x, const typename CppType::value_type * y) {
+            return K::less(x->first, y->first);
+        });
+        // Blocks start 8-byte aligned, so where the values start only depends on the count
+        const uint64_t valuesOffset = View::valuesAt(0, sorted.size());
+        const uint64_t keys = b.allocate(valuesOffset + sorted.size() * V::kSlot);
+        const uint64_t values = keys + valuesOffset;
+        b.store(slot, keys);
+        b.store<uint64_t>(keys, sorted.size());
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            K::write(b, keys + 8 + i * K::kSlot, sorted[i]->first);
+        }
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            V::write(b, values + i * V::kSlot, sorted[i]->second);
+        }
+    }
+    static CppType toCpp(const View & v) {
+        CppType c;
+        c.reserve(v.size());
+        for (size_t i = 0; i < v.size(); ++i) {
+            c.emplace(K::toCpp(v.key(i)), V::toCpp(v.value(i)));
+        }
+        return c;
+    }
+};
+
+template <template <class> class OptionalType, class T>
+struct FlatOptional {
+    static constexpr uint64_t kSlot = 8;
+    using CppType = OptionalType<typename T::CppType>;
+    using View = OptionalType<typename T::View>;
+
+    static View view(const FlatData & d, uint64_t slot) {
+        const uint64_t at = d.load<uint64_t>(slot);
+        if (at == 0) {
+            return View();
+        }
+        return View(T::view(d, at));
+    }
+    static void write(FlatBuilder & b, uint64_t slot, const CppType & v) {
+        if (v) {
+            const uint64_t at = b.allocate(T::kSlot);
+            b.store(slot, at);
+            T::write(b, at, *v);
+        }
+    }
+    static CppType toCpp(const View & v) {
+        if (!v) {
+            return CppType();
+        }
+        return CppType(T::toCpp(*v));
+    }
+};
+
+/*
+ * Nests a record with deriving(flat), given its generated XxxBuilder.
+ */
+template <class Builder>
+struct FlatRecord {
+    static constexpr uint64_t kSlot = 8;
+    using CppType = typename Builder::CppType;
+    using View = typename Builder::View;
+
+    static View view(const FlatData & d, uint64_t slot) { return View(d, d.load<uint64_t>(slot)); }
+    static void write(FlatBuilder & b, uint64_t slot, const CppType & v) {
+        const uint64_t at = b.allocate(View::kSize);
+        b.store(slot, at);
+        Builder::write(b, at, v);
+    }
+    static CppType toCpp(const View & v) { return v.toCpp(); }
+};
+
+} // namespace djinni
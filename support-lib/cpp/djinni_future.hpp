@@ -0,0 +1,203 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace djinni {
+
+template <typename T> class SharedFuture;
+template <typename T> class Promise;
+
+namespace detail {
+
+// The state shared by a Promise and the SharedFutures obtained from it.
+template <typename T>
+class FutureState {
+public:
+    using Callback = std::function<void()>;
+
+    // Returns false, and does nothing, if the state was already completed.
+    bool tryComplete(std::unique_ptr<T> value, std::exception_ptr error) {
+        std::vector<Callback> callbacks;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_done) {
+                return false;
+            }
+            m_value = std::move(value);
+            m_error = std::move(error);
+            m_done = true;
+            callbacks.swap(m_callbacks);
+        }
+        m_ready.notify_all();
+        // Outside the lock: callbacks may inspect the result, or chain more work.
+        for (const auto & callback : callbacks) {
+            callback();
+        }
+        return true;
+    }
+
+    void complete(std::unique_ptr<T> value, std::exception_ptr error) {
+        if (!tryComplete(std::move(value), std::move(error))) {
+            throw std::logic_error("djinni::Promise already satisfied");
+        }
+    }
+
+    bool isDone() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_done;
+    }
+
+    void wait() const {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_ready.wait(lock, [this] { return m_done; });
+    }
+
+    const T & get() const {
+        wait();
+        // m_value and m_error are never written again once m_done is set.
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+        return *m_value;
+    }
+
+    // Runs callback on the completing thread, or right away if already completed.
+    void onDone(Callback callback) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_done) {
+                m_callbacks.push_back(std::move(callback));
+                return;
+            }
+        }
+        callback();
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_ready;
+    bool m_done = false;
+    std::unique_ptr<T> m_value;
+    std::exception_ptr m_error;
+    std::vector<Callback> m_callbacks;
+};
+
+} // namespace detail
+
+/*
+ * The C++ type of the IDL "future<T>" type: the result of an asynchronous call, which will
+ * eventually hold either a T or an exception. Copies share the same result.
+ *
+ * Results are delivered by the thread that completes the Promise, so nothing needs to block
+ * on get() in order to be told about them: then() registers a continuation instead. This is
+ * how futures passed to Java or Objective-C are completed without tying up one of their
+ * threads.
+ */
+template <typename T>
+class SharedFuture {
+public:
+    using Continuation = std::function<void(const SharedFuture &)>;
+
+    // An invalid future, with no result to wait for.
+    SharedFuture() = default;
+
+    bool valid() const noexcept { return static_cast<bool>(m_state); }
+
+    // True once the future holds a value or an exception.
+    bool isReady() const { return m_state->isDone(); }
+
+    void wait() const { m_state->wait(); }
+
+    // Blocks until the future is ready, then returns its value or rethrows its exception.
+    const T & get() const { return m_state->get(); }
+
+    /*
+     * Runs continuation with this future once it is ready: on the thread that completes it,
+     * or on this thread if it is ready already. The continuation must not throw.
+     */
+    void then(Continuation continuation) const {
+        SharedFuture self = *this;
+        m_state->onDone([self, continuation] { continuation(self); });
+    }
+
+private:
+    friend class Promise<T>;
+
+    explicit SharedFuture(std::shared_ptr<detail::FutureState<T>> state) noexcept
+        : m_state(std::move(state)) {}
+
+    std::shared_ptr<detail::FutureState<T>> m_state;
+};
+
+/*
+ * The producing side of a SharedFuture. Copies complete the same future, which can be done
+ * once. If the last copy goes away without completing it, the future fails with a
+ * std::runtime_error instead of leaving its waiters hanging.
+ */
+template <typename T>
+class Promise {
+public:
+    Promise() : m_handle(std::make_shared<Handle>()) {}
+
+    SharedFuture<T> getFuture() const { return SharedFuture<T>(m_handle->state); }
+
+    // Both throw std::logic_error if the future was already completed.
+    void setValue(T value) const {
+        m_handle->state->complete(std::unique_ptr<T>(new T(std::move(value))), nullptr);
+    }
+    void setException(std::exception_ptr error) const {
+        m_handle->state->complete(nullptr, std::move(error));
+    }
+
+private:
+    struct Handle {
+        const std::shared_ptr<detail::FutureState<T>> state =
+            std::make_shared<detail::FutureState<T>>();
+
+        ~Handle() {
+            state->tryComplete(nullptr, std::make_exception_ptr(
+                std::runtime_error("djinni::Promise destroyed without a result")));
+        }
+    };
+
+    std::shared_ptr<Handle> m_handle;
+};
+
+template <typename T>
+SharedFuture<T> makeReadyFuture(T value) {
+    Promise<T> promise;
+    promise.setValue(std::move(value));
+    return promise.getFuture();
+}
+
+template <typename T>
+SharedFuture<T> makeExceptionalFuture(std::exception_ptr error) {
+    Promise<T> promise;
+    promise.setException(std::move(error));
+    return promise.getFuture();
+}
+
+} // namespace djinni
@@ -0,0 +1,76 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+namespace djinni {
+
+/*
+ * The C++ type of the IDL "buffer" type: a fixed-size region of bytes shared between copies,
+ * and with the other language when passed across. The bytes stay valid for as long as any
+ * copy holds on to their owner, and are never copied by Djinni itself.
+ *
+ * The owner is type-erased, so a SharedBuffer can wrap memory allocated by C++ (see
+ * allocate() and copyOf()), a Java direct ByteBuffer, an NSData, or anything else that can
+ * be kept alive by a shared_ptr.
+ */
+class SharedBuffer {
+public:
+    SharedBuffer() noexcept : m_data(nullptr), m_size(0) {}
+
+    // Wraps size bytes at data, which must stay valid for as long as owner is alive.
+    SharedBuffer(std::shared_ptr<void> owner, uint8_t * data, size_t size) noexcept
+        : m_owner(std::move(owner)), m_data(data), m_size(size) {}
+
+    // A new zero-filled buffer of the given size.
+    static SharedBuffer allocate(size_t size) {
+        std::shared_ptr<uint8_t> bytes(new uint8_t[size](), std::default_delete<uint8_t[]>());
+        uint8_t * const data = bytes.get();
+        return SharedBuffer(std::move(bytes), data, size);
+    }
+
+    // A new buffer holding a copy of size bytes at data.
+    static SharedBuffer copyOf(const void * data, size_t size) {
+        SharedBuffer buffer = allocate(size);
+        if (size > 0) {
+            std::memcpy(buffer.data(), data, size);
+        }
+        return buffer;
+    }
+
+    uint8_t * data() const noexcept { return m_data; }
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+
+    uint8_t * begin() const noexcept { return m_data; }
+    uint8_t * end() const noexcept { return m_data + m_size; }
+
+    // Whatever keeps the bytes alive. Null only for the empty default-constructed buffer.
+    const std::shared_ptr<void> & owner() const noexcept { return m_owner; }
+
+private:
+    std::shared_ptr<void> m_owner;
+    uint8_t * m_data;
+    size_t m_size;
+};
+
+} // namespace djinni
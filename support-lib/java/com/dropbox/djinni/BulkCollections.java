@@ -0,0 +1,76 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+
+/**
+ * Used by the JNI support library to move large collections across JNI in one call each way,
+ * as flat Object[] arrays, instead of one JNI call per element.
+ */
+final class BulkCollections {
+    private BulkCollections() {}
+
+    // Initial capacity for a HashMap or HashSet that will hold size elements without rehashing.
+    private static int hashCapacity(int size) {
+        return size < 3 ? size + 1 : (int)(size / 0.75f + 1.0f);
+    }
+
+    static Object[] listToArray(List<?> list) {
+        return list.toArray();
+    }
+
+    static ArrayList<Object> arrayToList(Object[] array) {
+        return new ArrayList<Object>(Arrays.asList(array));
+    }
+
+    static Object[] setToArray(Set<?> set) {
+        return set.toArray();
+    }
+
+    static HashSet<Object> arrayToSet(Object[] array) {
+        HashSet<Object> set = new HashSet<Object>(hashCapacity(array.length));
+        Collections.addAll(set, array);
+        return set;
+    }
+
+    // Keys at even indices, each followed by its value.
+    static Object[] mapToArray(Map<?, ?> map) {
+        Object[] array = new Object[map.size() * 2];
+        int i = 0;
+        for (Map.Entry<?, ?> entry : map.entrySet()) {
+            array[i++] = entry.getKey();
+            array[i++] = entry.getValue();
+        }
+        return array;
+    }
+
+    static HashMap<Object, Object> arrayToMap(Object[] array) {
+        HashMap<Object, Object> map = new HashMap<Object, Object>(hashCapacity(array.length / 2));
+        for (int i = 0; i < array.length; i += 2) {
+            map.put(array[i], array[i + 1]);
+        }
+        return map;
+    }
+}
@@ -0,0 +1,109 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+import java.util.ArrayList;
+
+/**
+ * Base class of the Batch classes generated for C++ interfaces with --java-call-batches.
+ *
+ * A batch records calls to one C++ object instead of making them: each is written to a wire
+ * message (see support-lib/jni/djinni_wire.hpp) as the index of the method followed by its
+ * arguments. execute() then hands the whole message to native code in one JNI call, where
+ * djinni::jniExecuteBatch makes the calls in order and encodes their results into a single
+ * reply. A batch is not thread safe, and can be reused once it has been executed.
+ */
+public abstract class CallBatch {
+    /**
+     * The result of one recorded call, available once the batch has been executed.
+     */
+    public static abstract class Result<T> {
+        private T mValue;
+        private boolean mDone;
+
+        /** Returns the value the call returned. Throws if the batch hasn't been executed. */
+        public final T get() {
+            if (!mDone) {
+                throw new IllegalStateException("the batch has not been executed");
+            }
+            return mValue;
+        }
+
+        public final boolean isDone() {
+            return mDone;
+        }
+
+        /** Decodes the value from the reply, written by djinni::Wire on the native side. */
+        protected abstract T read(WireReader reader);
+
+        private void fill(WireReader reader) {
+            mValue = read(reader);
+            mDone = true;
+        }
+    }
+
+    private final WireWriter mWriter = WireWriter.allocate();
+    private ArrayList<Result<?>> mResults = new ArrayList<Result<?>>();
+    private int mCalls;
+
+    /** The number of calls recorded since the last execute(). */
+    public final int size() {
+        return mCalls;
+    }
+
+    /**
+     * Makes the recorded calls in order, with a single call into native code, and fills in
+     * their results. The batch is empty again afterwards, whether or not this succeeds. If a
+     * call throws, the ones after it aren't made, and none of the results are filled in.
+     */
+    public final void execute() {
+        if (mCalls == 0) {
+            return;
+        }
+        final ArrayList<Result<?>> results = mResults;
+        final byte[] reply;
+        try {
+            reply = djinniExecute(mWriter.finish());
+        } finally {
+            mWriter.reset();
+            mResults = new ArrayList<Result<?>>();
+            mCalls = 0;
+        }
+        if (!results.isEmpty()) {
+            WireReader reader = new WireReader(reply);
+            for (Result<?> result : results) {
+                result.fill(reader);
+            }
+        }
+    }
+
+    /** Starts recording a call to the method with the given index; its arguments follow. */
+    protected final WireWriter djinniRecord(int method) {
+        mWriter.writeLength(method);
+        ++mCalls;
+        return mWriter;
+    }
+
+    /** Registers the result of the call just recorded, for a method that returns one. */
+    protected final <T> Result<T> djinniExpect(Result<T> result) {
+        mResults.add(result);
+        return result;
+    }
+
+    /** Runs the recorded calls in native code, and returns the encoded results. */
+    protected abstract byte[] djinniExecute(byte[] calls);
+}
@@ -0,0 +1,122 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.WeakReference;
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.HashMap;
+
+/**
+ * Keeps the C++ memory behind direct ByteBuffers passed from C++ (the IDL "buffer" type) alive
+ * until the ByteBuffer is garbage collected, or until release() is called on it.
+ */
+public final class NativeBuffers {
+    private NativeBuffers() {}
+
+    private static final class BufferRef extends WeakReference<ByteBuffer> {
+        final int identityHash;
+        long nativeRef;
+
+        BufferRef(ByteBuffer buffer, long nativeRef) {
+            super(buffer, sQueue);
+            this.identityHash = System.identityHashCode(buffer);
+            this.nativeRef = nativeRef;
+        }
+    }
+
+    private static final ReferenceQueue<ByteBuffer> sQueue = new ReferenceQueue<ByteBuffer>();
+
+    // Every tracked buffer by identity hash. Also keeps the BufferRefs themselves reachable.
+    private static final HashMap<Integer, ArrayList<BufferRef>> sRefs =
+        new HashMap<Integer, ArrayList<BufferRef>>();
+
+    static {
+        Thread thread = new Thread(new Runnable() {
+            @Override
+            public void run() {
+                while (true) {
+                    try {
+                        release((BufferRef) sQueue.remove());
+                    } catch (InterruptedException e) {
+                        // Keep going: the thread lives as long as the process.
+                    }
+                }
+            }
+        }, "djinni-buffer-release");
+        thread.setDaemon(true);
+        thread.start();
+    }
+
+    // Called from native code with a ByteBuffer it just created and the C++ reference backing it.
+    static void track(ByteBuffer buffer, long nativeRef) {
+        BufferRef ref = new BufferRef(buffer, nativeRef);
+        synchronized (sRefs) {
+            ArrayList<BufferRef> bucket = sRefs.get(ref.identityHash);
+            if (bucket == null) {
+                bucket = new ArrayList<BufferRef>(1);
+                sRefs.put(ref.identityHash, bucket);
+            }
+            bucket.add(ref);
+        }
+    }
+
+    /**
+     * Releases the C++ memory behind a ByteBuffer that came from C++, without waiting for it
+     * to be garbage collected. The buffer, and any views or slices of it, must not be used
+     * afterwards. Does nothing for buffers that did not come from C++ or were already released.
+     */
+    public static void release(ByteBuffer buffer) {
+        BufferRef found = null;
+        synchronized (sRefs) {
+            ArrayList<BufferRef> bucket = sRefs.get(System.identityHashCode(buffer));
+            if (bucket != null) {
+                for (BufferRef ref : bucket) {
+                    if (ref.get() == buffer) {
+                        found = ref;
+                        break;
+                    }
+                }
+            }
+        }
+        if (found != null) {
+            found.clear();
+            release(found);
+        }
+    }
+
+    private static void release(BufferRef ref) {
+        long nativeRef;
+        synchronized (sRefs) {
+            nativeRef = ref.nativeRef;
+            ref.nativeRef = 0;
+            ArrayList<BufferRef> bucket = sRefs.get(ref.identityHash);
+            if (bucket != null) {
+                bucket.remove(ref);
+                if (bucket.isEmpty()) {
+                    sRefs.remove(ref.identityHash);
+                }
+            }
+        }
+        if (nativeRef != 0) {
+            nativeRelease(nativeRef);
+        }
+    }
+
+    private static native void nativeRelease(long nativeRef);
+}
@@ -0,0 +1,52 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+import java.util.concurrent.CompletionException;
+import java.util.function.BiConsumer;
+
+/**
+ * Passes the result of a CompletableFuture given to C++ (the IDL "future" type) to the C++
+ * future waiting for it, from whichever thread completes it. Created from native code only.
+ */
+final class NativeFutureHandler implements BiConsumer<Object, Throwable> {
+    // Taken by the one call to accept().
+    private long nativeRef;
+
+    NativeFutureHandler(long nativeRef) {
+        this.nativeRef = nativeRef;
+    }
+
+    @Override
+    public void accept(Object value, Throwable error) {
+        long ref;
+        synchronized (this) {
+            ref = nativeRef;
+            nativeRef = 0;
+        }
+        if (ref == 0) {
+            return;
+        }
+        // Failures of dependent stages arrive wrapped; C++ should see what was thrown.
+        if (error instanceof CompletionException && error.getCause() != null) {
+            error = error.getCause();
+        }
+        nativeComplete(ref, value, error);
+    }
+
+    private static native void nativeComplete(long nativeRef, Object value, Throwable error);
+}
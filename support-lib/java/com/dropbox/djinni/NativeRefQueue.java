@@ -0,0 +1,134 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+import java.lang.ref.PhantomReference;
+import java.lang.ref.ReferenceQueue;
+
+/**
+ * Releases the C++ objects behind CppProxy instances generated with --java-batched-release.
+ *
+ * Instead of a finalize() method, each CppProxy registers a PhantomReference here. A single
+ * daemon thread waits for them to be enqueued and deletes their native handles in batches,
+ * with one JNI call per batch. Proxies can also be released right away with close().
+ */
+public final class NativeRefQueue {
+    private NativeRefQueue() {}
+
+    private static final int BATCH_SIZE = 256;
+
+    public static final class Ref extends PhantomReference<Object> {
+        // Written under sLock; zero once released. Live refs are kept in a doubly-linked list,
+        // which keeps them reachable until they're enqueued and makes removal constant-time.
+        private volatile long nativeRef;
+        private Ref prev;
+        private Ref next;
+
+        private Ref(Object referent, long nativeRef) {
+            super(referent, sQueue);
+            this.nativeRef = nativeRef;
+        }
+
+        /**
+         * Releases the native object now, if that didn't already happen.
+         */
+        public void release() {
+            clear();
+            long ref = take();
+            if (ref != 0) {
+                nativeDestroyBatch(new long[] { ref }, 1);
+            }
+        }
+
+        public boolean isReleased() {
+            return nativeRef == 0;
+        }
+
+        // Unlinks this ref, returning its native handle, or 0 if that was already taken.
+        private long take() {
+            synchronized (sLock) {
+                long ref = nativeRef;
+                if (ref == 0) {
+                    return 0;
+                }
+                nativeRef = 0;
+                if (prev != null) {
+                    prev.next = next;
+                } else {
+                    sHead = next;
+                }
+                if (next != null) {
+                    next.prev = prev;
+                }
+                prev = null;
+                next = null;
+                return ref;
+            }
+        }
+    }
+
+    private static final ReferenceQueue<Object> sQueue = new ReferenceQueue<Object>();
+    private static final Object sLock = new Object();
+    private static Ref sHead;
+
+    static {
+        Thread thread = new Thread(new Runnable() {
+            @Override
+            public void run() {
+                long[] batch = new long[BATCH_SIZE];
+                while (true) {
+                    try {
+                        Ref ref = (Ref) sQueue.remove();
+                        int count = 0;
+                        // Take whatever else is already waiting, up to a full batch.
+                        do {
+                            long nativeRef = ref.take();
+                            if (nativeRef != 0) {
+                                batch[count++] = nativeRef;
+                            }
+                        } while (count < BATCH_SIZE && (ref = (Ref) sQueue.poll()) != null);
+                        if (count > 0) {
+                            nativeDestroyBatch(batch, count);
+                        }
+                    } catch (InterruptedException e) {
+                        // Keep going: the thread lives as long as the process.
+                    }
+                }
+            }
+        }, "djinni-native-release");
+        thread.setDaemon(true);
+        thread.start();
+    }
+
+    /**
+     * Tracks the native handle owned by a CppProxy, which is released once the proxy is
+     * phantom reachable, or when release() is called on the returned Ref.
+     */
+    public static Ref register(Object owner, long nativeRef) {
+        Ref ref = new Ref(owner, nativeRef);
+        synchronized (sLock) {
+            ref.next = sHead;
+            if (sHead != null) {
+                sHead.prev = ref;
+            }
+            sHead = ref;
+        }
+        return ref;
+    }
+
+    private static native void nativeDestroyBatch(long[] nativeRefs, int count);
+}
@@ -0,0 +1,46 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+/**
+ * Per-thread return slot for CppProxy methods generated with --java-scalar-records.
+ *
+ * Such methods return small records of primitives by having native code store the fields in
+ * this array, each widened to a long (floating point values as their raw bits), and then
+ * construct the record in Java, which is much cheaper than constructing it through JNI.
+ */
+public final class ScalarSlot {
+    private ScalarSlot() {}
+
+    /** The most fields a record returned through a slot can have. */
+    public static final int MAX_FIELDS = 8;
+
+    private static final ThreadLocal<long[]> sSlot = new ThreadLocal<long[]>() {
+        @Override
+        protected long[] initialValue() {
+            return new long[MAX_FIELDS];
+        }
+    };
+
+    /**
+     * Returns the calling thread's slot. It is overwritten by the next call on the same thread,
+     * so read it before making another one.
+     */
+    public static long[] get() {
+        return sSlot.get();
+    }
+}
@@ -0,0 +1,118 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+import java.nio.charset.Charset;
+import java.util.Date;
+
+/**
+ * Decodes records declared with deriving(serialize) from messages written by native code with
+ * djinni::WireWriter (see support-lib/jni/djinni_wire.hpp for the format).
+ */
+public final class WireReader {
+    private static final Charset UTF_8 = Charset.forName("UTF-8");
+
+    private final byte[] mBuffer;
+    private final int mLimit;
+    private int mPos;
+
+    /** Starts reading the message at the front of the given array. */
+    public WireReader(byte[] message) {
+        mBuffer = message;
+        mPos = WireWriter.HEADER_BYTES;
+        int payload = getInt(message, 0);
+        if (payload < 0 || payload > message.length - WireWriter.HEADER_BYTES) {
+            throw new IllegalArgumentException("djinni wire message is malformed");
+        }
+        mLimit = WireWriter.HEADER_BYTES + payload;
+    }
+
+    public boolean readBool() {
+        return mBuffer[take(1)] != 0;
+    }
+
+    public byte readI8() {
+        return mBuffer[take(1)];
+    }
+
+    public short readI16() {
+        int p = take(2);
+        return (short) ((mBuffer[p] & 0xff) | (mBuffer[p + 1] << 8));
+    }
+
+    public int readI32() {
+        return getInt(mBuffer, take(4));
+    }
+
+    public long readI64() {
+        int p = take(8);
+        return (getInt(mBuffer, p) & 0xffffffffL) | ((long) getInt(mBuffer, p + 4) << 32);
+    }
+
+    public float readF32() {
+        return Float.intBitsToFloat(readI32());
+    }
+
+    public double readF64() {
+        return Double.longBitsToDouble(readI64());
+    }
+
+    public int readLength() {
+        int n = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            byte b = mBuffer[take(1)];
+            n |= (b & 0x7f) << shift;
+            if (b >= 0) {
+                if (n < 0) {
+                    break;
+                }
+                return n;
+            }
+        }
+        throw new IllegalStateException("djinni wire length is malformed");
+    }
+
+    public String readString() {
+        int length = readLength();
+        return new String(mBuffer, take(length), length, UTF_8);
+    }
+
+    public byte[] readBinary() {
+        int length = readLength();
+        byte[] v = new byte[length];
+        System.arraycopy(mBuffer, take(length), v, 0, length);
+        return v;
+    }
+
+    public Date readDate() {
+        return new Date(readI64());
+    }
+
+    // Advances past n bytes, returning where they start.
+    private int take(int n) {
+        int p = mPos;
+        if (n > mLimit - p) {
+            throw new IllegalStateException("djinni wire message is truncated");
+        }
+        mPos = p + n;
+        return p;
+    }
+
+    private static int getInt(byte[] b, int pos) {
+        return (b[pos] & 0xff) | ((b[pos + 1] & 0xff) << 8) | ((b[pos + 2] & 0xff) << 16) | (b[pos + 3] << 24);
+    }
+}
@@ -0,0 +1,214 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+package com.dropbox.djinni;
+
+import java.util.Date;
+
+/**
+ * Encodes records declared with deriving(serialize) for native code, which decodes them with
+ * djinni::WireReader (support-lib/jni/djinni_wire.hpp, which also describes the format).
+ *
+ * Each thread has one writer, whose byte array is reused for every message: the generated
+ * toWire() methods start a message with begin(), write the fields, and hand the array from
+ * finish() straight to native code, which copies it out before the next message is started.
+ * Messages that are built up over time, like the calls recorded by a CallBatch, use a writer
+ * of their own from allocate() instead.
+ */
+public final class WireWriter {
+    /** Bytes before the payload, which hold its length. */
+    public static final int HEADER_BYTES = 4;
+
+    // Arrays grown past this size are dropped after use instead of kept for the next message.
+    private static final int RETAIN_BYTES = 1 << 20;
+    private static final int INITIAL_BYTES = 256;
+
+    private static final ThreadLocal<WireWriter> sWriter = new ThreadLocal<WireWriter>() {
+        @Override
+        protected WireWriter initialValue() {
+            return new WireWriter();
+        }
+    };
+
+    private byte[] mBuffer = new byte[INITIAL_BYTES];
+    private int mPos;
+
+    private WireWriter() {}
+
+    /**
+     * Returns the calling thread's writer, emptied. Anything returned by the previous finish()
+     * on this thread may be overwritten from here on.
+     */
+    public static WireWriter begin() {
+        WireWriter writer = sWriter.get();
+        writer.reset();
+        return writer;
+    }
+
+    /** Returns a new, empty writer that isn't shared with anything else. */
+    public static WireWriter allocate() {
+        WireWriter writer = new WireWriter();
+        writer.reset();
+        return writer;
+    }
+
+    /** Empties the writer, to start the next message. */
+    public void reset() {
+        mPos = HEADER_BYTES;
+    }
+
+    /**
+     * Fills in the header and returns the message, which is followed by unused bytes if the
+     * array is longer than HEADER_BYTES plus the length in the header.
+     */
+    public byte[] finish() {
+        byte[] message = mBuffer;
+        putInt(message, 0, mPos - HEADER_BYTES);
+        if (message.length > RETAIN_BYTES) {
+            mBuffer = new byte[INITIAL_BYTES];
+        }
+        return message;
+    }
+
+    public void writeBool(boolean v) {
+        ensure(1);
+        mBuffer[mPos++] = (byte) (v ? 1 : 0);
+    }
+
+    public void writeI8(byte v) {
+        ensure(1);
+        mBuffer[mPos++] = v;
+    }
+
+    public void writeI16(short v) {
+        ensure(2);
+        mBuffer[mPos] = (byte) v;
+        mBuffer[mPos + 1] = (byte) (v >> 8);
+        mPos += 2;
+    }
+
+    public void writeI32(int v) {
+        ensure(4);
+        putInt(mBuffer, mPos, v);
+        mPos += 4;
+    }
+
+    public void writeI64(long v) {
+        ensure(8);
+        putInt(mBuffer, mPos, (int) v);
+        putInt(mBuffer, mPos + 4, (int) (v >>> 32));
+        mPos += 8;
+    }
+
+    public void writeF32(float v) {
+        writeI32(Float.floatToRawIntBits(v));
+    }
+
+    public void writeF64(double v) {
+        writeI64(Double.doubleToRawLongBits(v));
+    }
+
+    public void writeLength(int n) {
+        ensure(5);
+        while ((n & ~0x7f) != 0) {
+            mBuffer[mPos++] = (byte) (n | 0x80);
+            n >>>= 7;
+        }
+        mBuffer[mPos++] = (byte) n;
+    }
+
+    /**
+     * Writes s as UTF-8, with every unpaired surrogate replaced by U+FFFD, which is how
+     * djinni::jniUTF8FromString converts Java strings.
+     */
+    public void writeString(String s) {
+        final int length = s.length();
+        int utf8Length = length;
+        for (int i = 0; i < length; ++i) {
+            char c = s.charAt(i);
+            if (c >= 0x800) {
+                utf8Length += 2;
+                if (Character.isHighSurrogate(c) && i + 1 < length && Character.isLowSurrogate(s.charAt(i + 1))) {
+                    // Four bytes for the pair, which counts as two chars.
+                    ++i;
+                }
+            } else if (c >= 0x80) {
+                utf8Length += 1;
+            }
+        }
+        writeLength(utf8Length);
+        ensure(utf8Length);
+        final byte[] buffer = mBuffer;
+        int pos = mPos;
+        for (int i = 0; i < length; ++i) {
+            char c = s.charAt(i);
+            if (c < 0x80) {
+                buffer[pos++] = (byte) c;
+            } else if (c < 0x800) {
+                buffer[pos++] = (byte) (0xc0 | (c >> 6));
+                buffer[pos++] = (byte) (0x80 | (c & 0x3f));
+            } else if (Character.isHighSurrogate(c) && i + 1 < length && Character.isLowSurrogate(s.charAt(i + 1))) {
+                int cp = Character.toCodePoint(c, s.charAt(++i));
+                buffer[pos++] = (byte) (0xf0 | (cp >> 18));
+                buffer[pos++] = (byte) (0x80 | ((cp >> 12) & 0x3f));
+                buffer[pos++] = (byte) (0x80 | ((cp >> 6) & 0x3f));
+                buffer[pos++] = (byte) (0x80 | (cp & 0x3f));
+            } else {
+                if (Character.isSurrogate(c)) {
+                    c = '\uFFFD';
+                }
+                buffer[pos++] = (byte) (0xe0 | (c >> 12));
+                buffer[pos++] = (byte) (0x80 | ((c >> 6) & 0x3f));
+                buffer[pos++] = (byte) (0x80 | (c & 0x3f));
+            }
+        }
+        mPos = pos;
+    }
+
+    public void writeBinary(byte[] v) {
+        writeLength(v.length);
+        ensure(v.length);
+        System.arraycopy(v, 0, mBuffer, mPos, v.length);
+        mPos += v.length;
+    }
+
+    public void writeDate(Date v) {
+        writeI64(v.getTime());
+    }
+
+    private void ensure(int n) {
+        if (mBuffer.length - mPos < n) {
+            long needed = (long) mPos + n;
+            if (needed > Integer.MAX_VALUE - 8) {
+                throw new IllegalStateException("djinni wire message is too large");
+            }
+            int size = mBuffer.length;
+            while (size < needed) {
+                size = size > (Integer.MAX_VALUE - 8) / 2 ? Integer.MAX_VALUE - 8 : size * 2;
+            }
+            byte[] grown = new byte[size];
+            System.arraycopy(mBuffer, 0, grown, 0, mPos);
+            mBuffer = grown;
+        }
+    }
+
+    private static void putInt(byte[] b, int pos, int v) {
+        b[pos] = (byte) v;
+        b[pos + 1] = (byte) (v >> 8);
+        b[pos + 2] = (byte) (v >> 16);
+        b[pos + 3] = (byte) (v >> 24);
+    }
+}
@@ -17,12 +17,18 @@
 #pragma once
 
 #include "djinni_support.hpp"
+#include "djinni_future.hpp"
+#include "djinni_shared_buffer.hpp"
+#include "djinni_wire.hpp"
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace djinni
@@ -146,7 +152,7 @@ namespace djinni
 		
 		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
 		{
-			return {jniEnv, jniStringFromUTF8(jniEnv, c.c_str())};
+			return {jniEnv, jniStringFromUTF8(jniEnv, c)};
 		}
 	};
 	
@@ -208,6 +214,19 @@ namespace djinni
 		}
 	};
 	
+	struct Buffer
+	{
+		using CppType = SharedBuffer;
+		using JniType = jobject;
+		
+		using Boxed = Buffer;
+		
+		// Java buffers must be direct; the C++ side reads and writes the same memory, from the
+		// buffer's position to its limit.
+		static CppType toCpp(JNIEnv* jniEnv, JniType j) { return jniBufferToCpp(jniEnv, j); }
+		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return jniBufferFromCpp(jniEnv, c); }
+	};
+	
 	struct Date
 	{
 		using CppType = std::chrono::system_clock::time_point;
@@ -264,6 +283,48 @@ namespace djinni
 		}
 	};
 	
+	// Element conversions for the Object[] of a bulk collection transfer. Generated records
+	// convert the whole range at once through JniRecord; everything else goes element by element.
+	template <class T, bool = IsJniRecord<typename T::Boxed>::value>
+	struct ArrayElements
+	{
+		template <class Sink>
+		static void toCpp(JNIEnv* jniEnv, jobjectArray array, jint offset, jint stride, jint count, Sink&& sink)
+		{
+			for(jint i = 0; i < count; ++i)
+			{
+				auto je = LocalRef<jobject>(jniEnv, jniEnv->GetObjectArrayElement(array, offset + i * stride));
+				sink(T::Boxed::toCpp(jniEnv, static_cast<typename T::Boxed::JniType>(je.get())));
+			}
+		}
+		
+		template <class Source>
+		static void fromCpp(JNIEnv* jniEnv, jint count, Source&& source, jobjectArray array, jint offset, jint stride)
+		{
+			for(jint i = 0; i < count; ++i)
+			{
+				auto je = T::Boxed::fromCpp(jniEnv, source());
+				jniEnv->SetObjectArrayElement(array, offset + i * stride, get(je));
+			}
+		}
+	};
+	
+	template <class T>
+	struct ArrayElements<T, true>
+	{
+		template <class Sink>
+		static void toCpp(JNIEnv* jniEnv, jobjectArray array, jint offset, jint stride, jint count, Sink&& sink)
+		{
+			T::Boxed::toCppRange(jniEnv, array, offset, stride, count, std::forward<Sink>(sink));
+		}
+		
+		template <class Source>
+		static void fromCpp(JNIEnv* jniEnv, jint count, Source&& source, jobjectArray array, jint offset, jint stride)
+		{
+			T::Boxed::fromCppRange(jniEnv, count, std::forward<Source>(source), array, offset, stride);
+		}
+	};
+	
 	struct ListJniInfo
 	{
 		const GlobalRef<jclass> clazz { jniFindClass("java/util/ArrayList") };
@@ -273,6 +334,11 @@ namespace djinni
 		const jmethodID method_size { jniGetMethodID(clazz.get(), "size", "()I") };
 	};
 	
+	struct ObjectJniInfo
+	{
+		const GlobalRef<jclass> clazz { jniFindClass("java/lang/Object") };
+	};
+	
 	template <class T>
 	class List
 	{
@@ -286,12 +352,62 @@ namespace djinni
 		using Boxed = List;
 		
 		static CppType toCpp(JNIEnv* jniEnv, JniType j)
+		{
+			return toCpp(jniEnv, j, IsJniPrimitiveRecord<typename T::Boxed>());
+		}
+		
+		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
+		{
+			return fromCpp(jniEnv, c, IsJniPrimitiveRecord<typename T::Boxed>());
+		}
+		
+		// Boxes every element of c into a new Object[], for the bulk collection path.
+		template <class Range>
+		static LocalRef<jobjectArray> toArray(JNIEnv* jniEnv, const Range& c)
+		{
+			const auto& data = JniClass<ObjectJniInfo>::get();
+			const auto size = static_cast<jint>(c.size());
+			auto array = LocalRef<jobjectArray>(jniEnv, jniEnv->NewObjectArray(size, data.clazz.get(), nullptr));
+			jniExceptionCheck(jniEnv);
+			auto it = c.begin();
+			ArrayElements<T>::fromCpp(jniEnv, size, [&]() -> typename Range::const_reference { return *it++; }, array.get(), 0, 1);
+			return array;
+		}
+		
+	private:
+		// Records with only primitive fields cross as one primitive array per field.
+		static CppType toCpp(JNIEnv* jniEnv, JniType j, std::true_type)
+		{
+			assert(j != nullptr);
+			const auto& data = JniClass<ListJniInfo>::get();
+			assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
+			const auto size = jniEnv->CallIntMethod(j, data.method_size);
+			jniExceptionCheck(jniEnv);
+			return T::Boxed::toCppList(jniEnv, j, size);
+		}
+		
+		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, std::true_type)
+		{
+			assert(c.size() <= std::numeric_limits<jint>::max());
+			return T::Boxed::fromCppList(jniEnv, c);
+		}
+		
+		static CppType toCpp(JNIEnv* jniEnv, JniType j, std::false_type)
 		{
 			assert(j != nullptr);
 			const auto& data = JniClass<ListJniInfo>::get();
 			assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
 			auto size = jniEnv->CallIntMethod(j, data.method_size);
+			jniExceptionCheck(jniEnv);
 			auto c = CppType();
+			if(size >= kBulkCollectionThreshold && jniBulkCollectionsAvailable())
+			{
+				auto array = jniCollectionToArray(jniEnv, BulkCollection::List, j);
+				size = jniEnv->GetArrayLength(array.get());
+				c.reserve(size);
+				ArrayElements<T>::toCpp(jniEnv, array.get(), 0, 1, size, [&](ECppType&& ce) { c.push_back(std::move(ce)); });
+				return c;
+			}
 			c.reserve(size);
 			for(jint i = 0; i < size; ++i)
 			{
@@ -302,11 +418,15 @@ namespace djinni
 			return c;
 		}
 		
-		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
+		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, std::false_type)
 		{
 			const auto& data = JniClass<ListJniInfo>::get();
 			assert(c.size() <= std::numeric_limits<jint>::max());
 			auto size = static_cast<jint>(c.size());
+			if(size >= kBulkCollectionThreshold && jniBulkCollectionsAvailable())
+			{
+				return jniCollectionFromArray(jniEnv, BulkCollection::List, toArray(jniEnv, c).get());
+			}
 			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, size));
 			jniExceptionCheck(jniEnv);
 			for(const auto& ce : c)
@@ -319,6 +439,145 @@ namespace djinni
 		}
 	};
 	
+	// The JNI array type and region copy functions for each primitive JNI type.
+	template <class JniT> struct PrimitiveArrayTraits;
+	
+#define DJINNI_PRIMITIVE_ARRAY_TRAITS(jtype, Name) \
+	template <> struct PrimitiveArrayTraits<jtype> \
+	{ \
+		using JniType = jtype##Array; \
+		static JniType create(JNIEnv* jniEnv, jsize size) { return jniEnv->New##Name##Array(size); } \
+		static void getRegion(JNIEnv* jniEnv, JniType j, jsize size, jtype* buf) { jniEnv->Get##Name##ArrayRegion(j, 0, size, buf); } \
+		static void setRegion(JNIEnv* jniEnv, JniType j, jsize size, const jtype* buf) { jniEnv->Set##Name##ArrayRegion(j, 0, size, buf); } \
+	};
+	
+	DJINNI_PRIMITIVE_ARRAY_TRAITS(jboolean, Boolean)
+	DJINNI_PRIMITIVE_ARRAY_TRAITS(jbyte, Byte)
+	DJINNI_PRIMITIVE_ARRAY_TRAITS(jshort, Short)
+	DJINNI_PRIMITIVE_ARRAY_TRAITS(jint, Int)
+	DJINNI_PRIMITIVE_ARRAY_TRAITS(jlong, Long)
+	DJINNI_PRIMITIVE_ARRAY_TRAITS(jfloat, Float)
+	DJINNI_PRIMITIVE_ARRAY_TRAITS(jdouble, Double)
+	
+#undef DJINNI_PRIMITIVE_ARRAY_TRAITS
+	
+	// array<T> for primitive T: a std::vector<T> copied to or from a Java primitive array in one
+	// Get/Set<Type>ArrayRegion call, without boxing.
+	template <class T>
+	class Array
+	{
+		using ECppType = typename T::CppType;
+		using EJniType = typename T::JniType;
+		using Traits = PrimitiveArrayTraits<EJniType>;
+		
+	public:
+		using CppType = std::vector<ECppType>;
+		using JniType = typename Traits::JniType;
+		
+		using Boxed = Array;
+		
+		static CppType toCpp(JNIEnv* jniEnv, JniType j)
+		{
+			assert(j != nullptr);
+			const auto size = jniEnv->GetArrayLength(j);
+			auto c = CppType(size);
+			if(size > 0)
+			{
+				copyToCpp(jniEnv, j, c);
+				jniExceptionCheck(jniEnv);
+			}
+			return c;
+		}
+		
+		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
+		{
+			assert(c.size() <= std::numeric_limits<jsize>::max());
+			auto j = LocalRef<JniType>(jniEnv, Traits::create(jniEnv, static_cast<jsize>(c.size())));
+			jniExceptionCheck(jniEnv);
+			if(!c.empty())
+			{
+				copyFromCpp(jniEnv, c, j.get());
+				jniExceptionCheck(jniEnv);
+			}
+			return j;
+		}
+		
+	private:
+		template <class E>
+		static void copyToCpp(JNIEnv* jniEnv, JniType j, std::vector<E>& c)
+		{
+			static_assert(sizeof(E) == sizeof(EJniType), "array element must have the layout of its JNI type");
+			Traits::getRegion(jniEnv, j, static_cast<jsize>(c.size()), reinterpret_cast<EJniType*>(c.data()));
+		}
+		template <class E>
+		static void copyFromCpp(JNIEnv* jniEnv, const std::vector<E>& c, JniType j)
+		{
+			static_assert(sizeof(E) == sizeof(EJniType), "array element must have the layout of its JNI type");
+			Traits::setRegion(jniEnv, j, static_cast<jsize>(c.size()), reinterpret_cast<const EJniType*>(c.data()));
+		}
+		// std::vector<bool> is packed, so it goes through a jboolean buffer.
+		static void copyToCpp(JNIEnv* jniEnv, JniType j, std::vector<bool>& c)
+		{
+			std::vector<jboolean> buf(c.size());
+			Traits::getRegion(jniEnv, j, static_cast<jsize>(buf.size()), buf.data());
+			std::copy(buf.begin(), buf.end(), c.begin());
+		}
+		static void copyFromCpp(JNIEnv* jniEnv, const std::vector<bool>& c, JniType j)
+		{
+			const std::vector<jboolean> buf(c.begin(), c.end());
+			Traits::setRegion(jniEnv, j, static_cast<jsize>(buf.size()), buf.data());
+		}
+	};
+	
+	// One field of a list of primitive-only records, as a Java primitive array. See
+	// JniPrimitiveRecord; the generated toCppList and fromCppList use one per field.
+	template <class T>
+	struct Column
+	{
+		using EJniType = typename T::JniType;
+		using Traits = PrimitiveArrayTraits<EJniType>;
+		using JniType = typename Traits::JniType;
+		
+		static LocalRef<JniType> create(JNIEnv* jniEnv, jsize size)
+		{
+			auto j = LocalRef<JniType>(jniEnv, Traits::create(jniEnv, size));
+			jniExceptionCheck(jniEnv);
+			return j;
+		}
+		
+		// Copies field(e) of every record e in c into a new Java array.
+		template <class Records, class Field>
+		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const Records& c, Field field)
+		{
+			std::vector<EJniType> buf;
+			buf.reserve(c.size());
+			for(const auto& e : c)
+			{
+				buf.push_back(T::fromCpp(jniEnv, field(e)));
+			}
+			const auto size = static_cast<jsize>(buf.size());
+			auto j = create(jniEnv, size);
+			if(size > 0)
+			{
+				Traits::setRegion(jniEnv, j.get(), size, buf.data());
+				jniExceptionCheck(jniEnv);
+			}
+			return j;
+		}
+		
+		// Reads back the first size elements of a column filled in by Java.
+		static std::vector<EJniType> toCpp(JNIEnv* jniEnv, JniType j, jsize size)
+		{
+			std::vector<EJniType> buf(size);
+			if(size > 0)
+			{
+				Traits::getRegion(jniEnv, j, size, buf.data());
+				jniExceptionCheck(jniEnv);
+			}
+			return buf;
+		}
+	};
+	
 	struct IteratorJniInfo
 	{
 		const GlobalRef<jclass> clazz { jniFindClass("java/util/Iterator") };
@@ -328,7 +587,7 @@ namespace djinni
 	struct SetJniInfo
 	{
 		const GlobalRef<jclass> clazz { jniFindClass("java/util/HashSet") };
-		const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "()V") };
+		const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "(I)V") };
 		const jmethodID method_add { jniGetMethodID(clazz.get(), "add", "(Ljava/lang/Object;)Z") };
 		const jmethodID method_size { jniGetMethodID(clazz.get(), "size", "()I") };
 		const jmethodID method_iterator { jniGetMethodID(clazz.get(), "iterator", "()Ljava/util/Iterator;") };
@@ -353,7 +612,17 @@ namespace djinni
 			const auto& iteData = JniClass<IteratorJniInfo>::get();
 			assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
 			auto size = jniEnv->CallIntMethod(j, data.method_size);
+			jniExceptionCheck(jniEnv);
 			auto c = CppType();
+			if(size >= kBulkCollectionThreshold && jniBulkCollectionsAvailable())
+			{
+				auto array = jniCollectionToArray(jniEnv, BulkCollection::Set, j);
+				size = jniEnv->GetArrayLength(array.get());
+				c.reserve(size);
+				ArrayElements<T>::toCpp(jniEnv, array.get(), 0, 1, size, [&](ECppType&& ce) { c.insert(std::move(ce)); });
+				return c;
+			}
+			c.reserve(size);
 			auto it = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(j, data.method_iterator));
 			for(jint i = 0; i < size; ++i)
 			{
@@ -368,11 +637,15 @@ namespace djinni
 		{
 			assert(c.size() <= std::numeric_limits<jint>::max());
 			const auto& data = JniClass<SetJniInfo>::get();
-			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor));
+			if(static_cast<jint>(c.size()) >= kBulkCollectionThreshold && jniBulkCollectionsAvailable())
+			{
+				return jniCollectionFromArray(jniEnv, BulkCollection::Set, List<T>::toArray(jniEnv, c).get());
+			}
+			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, jniHashCapacity(c.size())));
 			jniExceptionCheck(jniEnv);
 			for(const auto& ce : c)
 			{
-				auto je = T::fromCpp(jniEnv, ce);
+				auto je = T::Boxed::fromCpp(jniEnv, ce);
 				jniEnv->CallBooleanMethod(j, data.method_add, get(je));
 				jniExceptionCheck(jniEnv);
 			}
@@ -383,7 +656,7 @@ namespace djinni
 	struct MapJniInfo
 	{
 		const GlobalRef<jclass> clazz { jniFindClass("java/util/HashMap") };
-		const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "()V") };
+		const jmethodID constructor { jniGetMethodID(clazz.get(), "<init>", "(I)V") };
 		const jmethodID method_put { jniGetMethodID(clazz.get(), "put", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;") };
 		const jmethodID method_size { jniGetMethodID(clazz.get(), "size", "()I") };
 		const jmethodID method_entrySet { jniGetMethodID(clazz.get(), "entrySet", "()Ljava/util/Set;") };
@@ -425,8 +698,34 @@ namespace djinni
 			const auto& iteData = JniClass<IteratorJniInfo>::get();
 			assert(jniEnv->IsInstanceOf(j, data.clazz.get()));
 			auto size = jniEnv->CallIntMethod(j, data.method_size);
-			auto entrySet = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(j, data.method_entrySet));
+			jniExceptionCheck(jniEnv);
 			auto c = CppType();
+			if(size >= kBulkCollectionThreshold && jniBulkCollectionsAvailable())
+			{
+				auto array = jniCollectionToArray(jniEnv, BulkCollection::Map, j);
+				size = jniEnv->GetArrayLength(array.get());
+				c.reserve(size / 2);
+				if(IsJniRecord<typename Key::Boxed>::value || IsJniRecord<typename Value::Boxed>::value)
+				{
+					// Convert all keys, then all values, so that records go through their bulk
+					// conversion.
+					std::vector<CppKeyType> keys;
+					keys.reserve(size / 2);
+					ArrayElements<Key>::toCpp(jniEnv, array.get(), 0, 2, size / 2, [&](CppKeyType&& k) { keys.push_back(std::move(k)); });
+					auto key = keys.begin();
+					ArrayElements<Value>::toCpp(jniEnv, array.get(), 1, 2, size / 2, [&](CppValueType&& v) { c.emplace(std::move(*key++), std::move(v)); });
+					return c;
+				}
+				for(jint i = 0; i + 1 < size; i += 2)
+				{
+					auto jKey = LocalRef<jobject>(jniEnv, jniEnv->GetObjectArrayElement(array.get(), i));
+					auto jValue = LocalRef<jobject>(jniEnv, jniEnv->GetObjectArrayElement(array.get(), i + 1));
+					c.emplace(Key::Boxed::toCpp(jniEnv, static_cast<JniKeyType>(jKey.get())),
+							  Value::Boxed::toCpp(jniEnv, static_cast<JniValueType>(jValue.get())));
+				}
+				return c;
+			}
+			auto entrySet = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(j, data.method_entrySet));
 			c.reserve(size);
 			auto it = LocalRef<jobject>(jniEnv, jniEnv->CallObjectMethod(entrySet, entrySetData.method_iterator));
 			for(jint i = 0; i < size; ++i)
@@ -446,7 +745,21 @@ namespace djinni
 			const auto& data = JniClass<MapJniInfo>::get();
 			assert(c.size() <= std::numeric_limits<jint>::max());
 			auto size = c.size();
-			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, size));
+			if(static_cast<jint>(size) >= kBulkCollectionThreshold && jniBulkCollectionsAvailable())
+			{
+				const auto& objectData = JniClass<ObjectJniInfo>::get();
+				assert(size <= static_cast<size_t>(std::numeric_limits<jint>::max() / 2));
+				auto array = LocalRef<jobjectArray>(jniEnv, jniEnv->NewObjectArray(static_cast<jint>(size * 2), objectData.clazz.get(), nullptr));
+				jniExceptionCheck(jniEnv);
+				// Keys and values in separate passes, so that records go through their bulk
+				// conversion. Iterating an unchanged unordered_map twice visits it in the same order.
+				auto keyIt = c.begin();
+				ArrayElements<Key>::fromCpp(jniEnv, static_cast<jint>(size), [&]() -> const CppKeyType& { return (keyIt++)->first; }, array.get(), 0, 2);
+				auto valueIt = c.begin();
+				ArrayElements<Value>::fromCpp(jniEnv, static_cast<jint>(size), [&]() -> const CppValueType& { return (valueIt++)->second; }, array.get(), 1, 2);
+				return jniCollectionFromArray(jniEnv, BulkCollection::Map, array.get());
+			}
+			auto j = LocalRef<jobject>(jniEnv, jniEnv->NewObject(data.clazz.get(), data.constructor, jniHashCapacity(size)));
 			jniExceptionCheck(jniEnv);
 			for(const auto& ce : c)
 			{
@@ -459,4 +772,295 @@ namespace djinni
 		}
 	};
 	
+	/*
+	 * The IDL "future<T>" type, as a java.util.concurrent.CompletableFuture. Neither direction
+	 * waits for the result: it is converted and passed on by whichever thread completes the
+	 * future, which for C++ futures is attached to the JVM if need be.
+	 */
+	template <class T>
+	class Future
+	{
+		using ECppType = typename T::CppType;
+		using EJniType = typename T::Boxed::JniType;
+		
+	public:
+		using CppType = SharedFuture<ECppType>;
+		using JniType = jobject;
+		
+		using Boxed = Future;
+		
+		static CppType toCpp(JNIEnv* jniEnv, JniType j)
+		{
+			assert(j != nullptr);
+			Promise<ECppType> promise;
+			jniListenToFuture(jniEnv, j, [promise] (JNIEnv* env, jobject value, jthrowable error)
+			{
+				try
+				{
+					if(error)
+					{
+						throw jni_exception(env, error);
+					}
+					promise.setValue(T::Boxed::toCpp(env, static_cast<EJniType>(value)));
+				}
+				catch(const std::exception&)
+				{
+					promise.setException(std::current_exception());
+				}
+			});
+			return promise.getFuture();
+		}
+		
+		static LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c)
+		{
+			assert(c.valid());
+			auto j = jniNewCompletableFuture(jniEnv);
+			auto target = std::make_shared<GlobalRef<jobject>>(jniEnv, j.get());
+			c.then([target] (const CppType& done)
+			{
+				JNIEnv* const env = jniGetThreadEnv();
+				// Completing threads may have no Java frame to release local refs for them.
+				JniLocalScope jscope(env, 10, false);
+				try
+				{
+					jniCompleteFuture(env, target->get(), get(T::Boxed::fromCpp(env, done.get())));
+				}
+				catch(const std::exception&)
+				{
+					jniFailFutureFromCurrent(env, target->get());
+				}
+			});
+			return j;
+		}
+	};
+	
+	/*
+	 * Encoding of each marshalled type in the wire format of djinni_wire.hpp, used by records
+	 * declared with deriving(serialize). The generated marshallers of those records provide
+	 * writeWire and readWire; the specializations below cover everything they can contain.
+	 */
+	template <class T, class = void>
+	struct Wire
+	{
+		static void write(WireWriter& w, const typename T::CppType& c) { T::writeWire(w, c); }
+		static typename T::CppType read(WireReader& r) { return T::readWire(r); }
+	};
+	
+	template <class T>
+	struct WireFixed
+	{
+		static void write(WireWriter& w, typename T::CppType c) { w.writeFixed(c); }
+		static typename T::CppType read(WireReader& r) { return r.readFixed<typename T::CppType>(); }
+	};
+	
+	template <> struct Wire<I8> : WireFixed<I8> {};
+	template <> struct Wire<I16> : WireFixed<I16> {};
+	template <> struct Wire<I32> : WireFixed<I32> {};
+	template <> struct Wire<I64> : WireFixed<I64> {};
+	template <> struct Wire<F32> : WireFixed<F32> {};
+	template <> struct Wire<F64> : WireFixed<F64> {};
+	
+	template <>
+	struct Wire<Bool>
+	{
+		static void write(WireWriter& w, bool c) { w.writeBool(c); }
+		static bool read(WireReader& r) { return r.readBool(); }
+	};
+	
+	template <>
+	struct Wire<String>
+	{
+		static void write(WireWriter& w, const std::string& c) { w.writeBytes(c.data(), c.size()); }
+		static std::string read(WireReader& r)
+		{
+			size_t size;
+			const uint8_t* p = r.readBytes(size);
+			return std::string(reinterpret_cast<const char*>(p), size);
+		}
+	};
+	
+	template <>
+	struct Wire<Binary>
+	{
+		static void write(WireWriter& w, const std::vector<uint8_t>& c) { w.writeBytes(c.data(), c.size()); }
+		static std::vector<uint8_t> read(WireReader& r)
+		{
+			size_t size;
+			const uint8_t* p = r.readBytes(size);
+			return std::vector<uint8_t>(p, p + size);
+		}
+	};
+	
+	template <>
+	struct Wire<Date>
+	{
+		static void write(WireWriter& w, const Date::CppType& c)
+		{
+			static const auto POSIX_EPOCH = std::chrono::system_clock::from_time_t(0);
+			w.writeFixed(static_cast<int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(c - POSIX_EPOCH).count()));
+		}
+		static Date::CppType read(WireReader& r)
+		{
+			static const auto POSIX_EPOCH = std::chrono::system_clock::from_time_t(0);
+			return POSIX_EPOCH + std::chrono::milliseconds{r.readFixed<int64_t>()};
+		}
+	};
+	
+	// Generated enum marshallers derive from JniEnum; their values are sent as the ordinal.
+	template <class T>
+	struct Wire<T, typename std::enable_if<std::is_base_of<JniEnum, T>::value>::type>
+	{
+		static void write(WireWriter& w, typename T::CppType c) { w.writeLength(static_cast<size_t>(c)); }
+		static typename T::CppType read(WireReader& r) { return static_cast<typename T::CppType>(r.readLength()); }
+	};
+	
+	template <template <class> class OptionalType, class T>
+	struct Wire<Optional<OptionalType, T>>
+	{
+		using CppType = typename Optional<OptionalType, T>::CppType;
+		
+		static void write(WireWriter& w, const CppType& c)
+		{
+			w.writeBool(static_cast<bool>(c));
+			if(c)
+				Wire<T>::write(w, *c);
+		}
+		static CppType read(WireReader& r)
+		{
+			return r.readBool() ? CppType(Wire<T>::read(r)) : CppType();
+		}
+	};
+	
+	// list<T> and array<T> share a C++ representation and an encoding.
+	template <class T>
+	struct WireSequence
+	{
+		using CppType = std::vector<typename T::CppType>;
+		
+		static void write(WireWriter& w, const CppType& c)
+		{
+			w.writeLength(c.size());
+			for(const auto& e : c)
+				Wire<T>::write(w, e);
+		}
+		static CppType read(WireReader& r)
+		{
+			const size_t size = r.readLength();
+			CppType c;
+			c.reserve(size);
+			for(size_t i = 0; i < size; ++i)
+				c.push_back(Wire<T>::read(r));
+			return c;
+		}
+	};
+	
+	template <class T> struct Wire<List<T>> : WireSequence<T> {};
+	template <class T> struct Wire<Array<T>> : WireSequence<T> {};
+	
+	template <class T>
+	struct Wire<Set<T>>
+	{
+		using CppType = typename Set<T>::CppType;
+		
+		static void write(WireWriter& w, const CppType& c)
+		{
+			w.writeLength(c.size());
+			for(const auto& e : c)
+				Wire<T>::write(w, e);
+		}
+		static CppType read(WireReader& r)
+		{
+			const size_t size = r.readLength();
+			CppType c;
+			c.reserve(size);
+			for(size_t i = 0; i < size; ++i)
+				c.insert(Wire<T>::read(r));
+			return c;
+		}
+	};
+	
+	template <class Key, class Value>
+	struct Wire<Map<Key, Value>>
+	{
+		using CppType = typename Map<Key, Value>::CppType;
+		
+		static void write(WireWriter& w, const CppType& c)
+		{
+			w.writeLength(c.size());
+			for(const auto& e : c)
+			{
+				Wire<Key>::write(w, e.first);
+				Wire<Value>::write(w, e.second);
+			}
+		}
+		static CppType read(WireReader& r)
+		{
+			const size_t size = r.readLength();
+			CppType c;
+			c.reserve(size);
+			for(size_t i = 0; i < size; ++i)
+			{
+				auto key = Wire<Key>::read(r);
+				c.emplace(std::move(key), Wire<Value>::read(r));
+			}
+			return c;
+		}
+	};
+	
+	// Finishes a message and copies it into a new byte[].
+	inline LocalRef<jbyteArray> jniWireMessage(JNIEnv* jniEnv, WireWriter& w)
+	{
+		w.finish();
+		const jsize size = static_cast<jsize>(w.size());
+		auto j = LocalRef<jbyteArray>(jniEnv, jniEnv->NewByteArray(size));
+		jniExceptionCheck(jniEnv);
+		jniEnv->SetByteArrayRegion(j.get(), 0, size, reinterpret_cast<const jbyte*>(w.data()));
+		return j;
+	}
+	
+	// Copies the payload of the message in j, which may be followed by unused bytes, to buffer.
+	inline void jniWirePayload(JNIEnv* jniEnv, jbyteArray j, std::vector<uint8_t>& buffer)
+	{
+		uint8_t header[kWireHeaderBytes];
+		jniEnv->GetByteArrayRegion(j, 0, kWireHeaderBytes, reinterpret_cast<jbyte*>(header));
+		jniExceptionCheck(jniEnv);
+		const jint size = WireReader::load<int32_t>(header);
+		if(size < 0)
+			throw std::out_of_range("djinni wire message is malformed");
+		buffer.resize(static_cast<size_t>(size));
+		jniEnv->GetByteArrayRegion(j, kWireHeaderBytes, size, reinterpret_cast<jbyte*>(buffer.data()));
+		jniExceptionCheck(jniEnv);
+	}
+	
+	// Decodes the message in j, which may be followed by unused bytes, as a T.
+	template <class T>
+	typename T::CppType jniWireRead(JNIEnv* jniEnv, jbyteArray j)
+	{
+		WireScratch scratch;
+		auto& buffer = scratch.buffer();
+		jniWirePayload(jniEnv, j, buffer);
+		WireReader r(buffer.data(), buffer.size());
+		return Wire<T>::read(r);
+	}
+	
+	/*
+	 * Makes the calls recorded by a Java CallBatch in the message j, and returns their results
+	 * as one message. Each call is the index of a method followed by its arguments, and
+	 * dispatch(reader, writer, index) decodes the arguments, makes the call, and encodes its
+	 * result, if it has one. An exception from a call ends the batch, and goes to Java in place
+	 * of all the results.
+	 */
+	template <class Dispatch>
+	LocalRef<jbyteArray> jniExecuteBatch(JNIEnv* jniEnv, jbyteArray j, Dispatch&& dispatch)
+	{
+		WireScratch scratch;
+		auto& buffer = scratch.buffer();
+		jniWirePayload(jniEnv, j, buffer);
+		WireReader r(buffer.data(), buffer.size());
+		WireWriter w;
+		while(!r.atEnd())
+			dispatch(r, w, r.readLength());
+		return jniWireMessage(jniEnv, w);
+	}
+	
 } // namespace djinni
@@ -15,9 +15,18 @@
 //
 
 #include "djinni_support.hpp"
+#include "djinni_shared_buffer.hpp"
+#include "djinni_utf.hpp"
+#include <algorithm>
 #include <cassert>
+#include <condition_variable>
 #include <cstdlib>
 #include <cstring>
+#include <future>
+#include <map>
+#include <new>
+#include <pthread.h>
+#include <thread>
 
 static_assert(sizeof(jlong) >= sizeof(void*), "must be able to fit a void* into a jlong");
 
@@ -31,11 +40,59 @@ namespace djinni {
 
 // Set only once from JNI_OnLoad before any other JNI calls, so no lock needed.
 static JavaVM * g_cachedJVM;
+static JniInitOptions g_initOptions;
+
+// Only set in lazy mode; see findClassLocal().
+static GlobalRef<jobject> g_classLoader;
+static GlobalRef<jclass> g_classClass;
+static jmethodID g_classForName;
+
+static void captureClassLoader(JNIEnv * env, jobject classLoader) {
+    const LocalRef<jclass> classClass(env, env->FindClass("java/lang/Class"));
+    g_classClass = GlobalRef<jclass>(env, classClass.get());
+    DJINNI_ASSERT(g_classClass, env);
+    g_classForName = env->GetStaticMethodID(g_classClass.get(), "forName",
+        "(Ljava/lang/String;ZLjava/lang/ClassLoader;)Ljava/lang/Class;");
+    DJINNI_ASSERT(g_classForName, env);
+
+    if (classLoader) {
+        g_classLoader = GlobalRef<jobject>(env, classLoader);
+        return;
+    }
+    const LocalRef<jclass> threadClass(env, env->FindClass("java/lang/Thread"));
+    DJINNI_ASSERT(threadClass, env);
+    const jmethodID currentThread = env->GetStaticMethodID(threadClass.get(), "currentThread",
+                                                           "()Ljava/lang/Thread;");
+    const jmethodID getContextClassLoader = env->GetMethodID(threadClass.get(),
+        "getContextClassLoader", "()Ljava/lang/ClassLoader;");
+    DJINNI_ASSERT(currentThread && getContextClassLoader, env);
+    const LocalRef<jobject> thread(env, env->CallStaticObjectMethod(threadClass.get(),
+                                                                    currentThread));
+    jniExceptionCheck(env);
+    const LocalRef<jobject> loader(env, env->CallObjectMethod(thread.get(),
+                                                              getContextClassLoader));
+    jniExceptionCheck(env);
+    g_classLoader = GlobalRef<jobject>(env, loader.get());
+}
 
-void jniInit(JavaVM * jvm) {
+void jniInit(JavaVM * jvm, const JniInitOptions & options) {
     g_cachedJVM = jvm;
+    g_initOptions = options;
+    g_initOptions.classLoader = nullptr; // only valid during this call
 
     try {
+        for (const auto & kv : JniNativeMethods::Registration::get_all()) {
+            const JniNativeMethods & natives = *kv.second;
+            const GlobalRef<jclass> clazz = jniFindClass(natives.m_className);
+            JNIEnv * const env = jniGetThreadEnv();
+            const jint res = env->RegisterNatives(clazz.get(), natives.m_methods, natives.m_count);
+            jniExceptionCheck(env);
+            DJINNI_ASSERT(res == JNI_OK, env);
+        }
+        if (options.lazyClassInit) {
+            captureClassLoader(jniGetThreadEnv(), options.classLoader);
+            return;
+        }
         for (const auto & kv : JniClassInitializer::Registration::get_all()) {
             kv.second->init();
         }
@@ -50,53 +107,156 @@ void jniShutdown() {
     g_cachedJVM = nullptr;
 }
 
-JNIEnv * jniGetThreadEnv() {
-    assert(g_cachedJVM);
+/*
+ * Per-thread JNIEnv cache. It has no destructor, so thread_local destructors that release
+ * JavaProxies can still use it; if we attached the thread ourselves, onThreadExit detaches it
+ * again after they have run.
+ */
+namespace {
+struct ThreadEnv {
     JNIEnv * env = nullptr;
-    const jint get_res = g_cachedJVM->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6);
-    if (get_res != 0 || !env) {
-        // :(
-        std::abort();
+    bool attachedByUs = false;
+    bool exiting = false;
+};
+}
+
+static_assert(std::is_trivially_destructible<ThreadEnv>::value,
+              "must stay usable from thread_local destructors");
+static thread_local ThreadEnv t_threadEnv;
+
+static void drainCppProxyHandleCache() noexcept;
+
+static void onThreadExit(void *) {
+    drainCppProxyHandleCache();
+    t_threadEnv.exiting = true;
+    t_threadEnv.env = nullptr;
+    if (t_threadEnv.attachedByUs && g_cachedJVM) {
+        t_threadEnv.attachedByUs = false;
+        g_cachedJVM->DetachCurrentThread();
     }
+}
 
-    return env;
+/*
+ * Has onThreadExit run when this thread exits. Destructors of pthread keys run after those of
+ * the thread's thread_locals, and not at all for the main thread when the process exits.
+ */
+static void runOnThreadExit() {
+    static const pthread_key_t key = [] {
+        pthread_key_t k;
+        if (pthread_key_create(&k, &onThreadExit) != 0) {
+            std::abort();
+        }
+        return k;
+    }();
+    static char value;
+    pthread_setspecific(key, &value);
 }
 
-static JNIEnv * getOptThreadEnv() {
-    if (!g_cachedJVM) {
+// Android declares the Attach functions with JNIEnv **, everyone else with void **.
+template <typename EnvOut>
+static jint callAttach(jint (JavaVM::*attach)(EnvOut, void *), JNIEnv ** env) {
+    return (g_cachedJVM->*attach)(reinterpret_cast<EnvOut>(env), nullptr);
+}
+
+static JNIEnv * attachCurrentThread() {
+    const jint attach_res = g_initOptions.attachAsDaemon
+        ? callAttach(&JavaVM::AttachCurrentThreadAsDaemon, &t_threadEnv.env)
+        : callAttach(&JavaVM::AttachCurrentThread, &t_threadEnv.env);
+    if (attach_res != JNI_OK || !t_threadEnv.env) {
+        t_threadEnv.env = nullptr;
         return nullptr;
     }
+    t_threadEnv.attachedByUs = true;
+    runOnThreadExit();
+    return t_threadEnv.env;
+}
+
+/*
+ * Look up (and cache) this thread's JNIEnv. A thread the JVM doesn't know about is attached if
+ * mayAttach is set and the options allow it; otherwise null is returned for it. Aborts on any
+ * other error. Whoever gets an env also deletes any global refs that were left for us.
+ */
+static JNIEnv * lookupThreadEnv(bool mayAttach) {
+    if (JNIEnv * env = t_threadEnv.env) {
+        JniDeferredGlobalRefs::drain(env);
+        return env;
+    }
 
-    // Special case: this allows us to ignore GlobalRef deletions that happen after this
-    // thread has been detached. (This is known to happen during process shutdown, when
-    // there's no need to release the ref anyway.)
     JNIEnv * env = nullptr;
     const jint get_res = g_cachedJVM->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6);
 
     if (get_res == JNI_EDETACHED) {
+        // Never attach once onThreadExit has run; nothing would detach the thread again.
+        if (mayAttach && g_initOptions.attachNativeThreads && !t_threadEnv.exiting) {
+            if (JNIEnv * attached = attachCurrentThread()) {
+                JniDeferredGlobalRefs::drain(attached);
+                return attached;
+            }
+        }
         return nullptr;
     }
 
-    // Still bail on any other error.
-    if (get_res != 0 || !env) {
-        // :(
-        std::abort();
+    if (get_res == JNI_OK && env) {
+        if (g_initOptions.cacheThreadEnv && !t_threadEnv.exiting) {
+            t_threadEnv.env = env;
+        }
+        JniDeferredGlobalRefs::drain(env);
+        return env;
     }
 
+    // :(
+    std::abort();
+}
+
+JNIEnv * jniGetThreadEnv() {
+    assert(g_cachedJVM);
+    JNIEnv * const env = lookupThreadEnv(true);
+    if (!env) {
+        std::abort();
+    }
     return env;
 }
 
+std::atomic<JniDeferredGlobalRefs::Node *> JniDeferredGlobalRefs::s_head { nullptr };
+
+void JniDeferredGlobalRefs::push(jobject globalRef) noexcept {
+    Node * node;
+    try {
+        node = new Node { globalRef, s_head.load(std::memory_order_relaxed) };
+    } catch (const std::bad_alloc &) {
+        return; // leak the ref rather than fail
+    }
+    // Consumers take the whole list at once, so there's no ABA problem here.
+    while (!s_head.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                         std::memory_order_relaxed)) {}
+}
+
+void JniDeferredGlobalRefs::drainSlow(JNIEnv * env) noexcept {
+    Node * node = s_head.exchange(nullptr, std::memory_order_acquire);
+    while (node) {
+        env->DeleteGlobalRef(node->ref);
+        Node * const next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
 void GlobalRefDeleter::operator() (jobject globalRef) noexcept {
-    if (globalRef) {
-        if (JNIEnv * env = getOptThreadEnv()) {
-            env->DeleteGlobalRef(globalRef);
-        }
+    // After jniShutdown there's no JVM to delete anything with.
+    if (!globalRef || !g_cachedJVM) {
+        return;
+    }
+    if (JNIEnv * env = lookupThreadEnv(false)) {
+        env->DeleteGlobalRef(globalRef);
+    } else {
+        // A native thread, or one whose ThreadEnv has already detached it on exit.
+        JniDeferredGlobalRefs::push(globalRef);
     }
 }
 
 void LocalRefDeleter::operator() (jobject localRef) noexcept {
     if (localRef) {
-        jniGetThreadEnv()->DeleteLocalRef(localRef);
+        (env ? env : jniGetThreadEnv())->DeleteLocalRef(localRef);
     }
 }
 
@@ -132,26 +292,6 @@ struct SystemClassInfo {
 };
 } // namespace
 
-/*
- * Hasher and comparator based on Java object identity.
- */
-struct JavaIdentityHash { size_t operator() (jobject obj) const; };
-struct JavaIdentityEquals { bool operator() (jobject obj1, jobject obj2) const; };
-
-size_t JavaIdentityHash::operator() (jobject obj) const {
-    JNIEnv * const env = jniGetThreadEnv();
-    const SystemClassInfo & sys = JniClass<SystemClassInfo>::get();
-    jint res = env->CallStaticIntMethod(sys.clazz.get(), sys.staticmethIdentityHashCode, obj);
-    jniExceptionCheck(env);
-    return res;
-}
-bool JavaIdentityEquals::operator() (jobject obj1, jobject obj2) const {
-    JNIEnv * const env = jniGetThreadEnv();
-    const bool res = env->IsSameObject(obj1, obj2);
-    jniExceptionCheck(env);
-    return res;
-}
-
 void jniThrowAssertionError(JNIEnv * env, const char * file, int line, const char * check) {
     // basename() exists, but is bad (it's allowed to modify its input).
     const char * slash = strrchr(file, '/');
@@ -179,10 +319,34 @@ void jniThrowAssertionError(JNIEnv * env, const char * file, int line, const cha
     jniThrowCppFromJavaException(env, e);
 }
 
+/*
+ * FindClass, falling back on the ClassLoader captured by jniInit in lazy mode. FindClass uses
+ * the class loader of the Java method that called into native code, or the system class
+ * loader if there is none, which can't see app classes on Android. That's only an issue for
+ * lazy initialization; eager initialization runs from JNI_OnLoad, which has the right one.
+ * Leaves an exception pending if the class can't be found.
+ */
+static LocalRef<jclass> findClassLocal(JNIEnv * env, const char * name) {
+    LocalRef<jclass> clazz(env, env->FindClass(name));
+    if (clazz || !g_classLoader) {
+        return clazz;
+    }
+    env->ExceptionClear();
+
+    std::string dotted(name);
+    std::replace(dotted.begin(), dotted.end(), '/', '.');
+    const LocalRef<jstring> jname(env, env->NewStringUTF(dotted.c_str()));
+    if (!jname) {
+        return clazz;
+    }
+    return LocalRef<jclass>(env, static_cast<jclass>(env->CallStaticObjectMethod(
+        g_classClass.get(), g_classForName, jname.get(), JNI_FALSE, g_classLoader.get())));
+}
+
 GlobalRef<jclass> jniFindClass(const char * name) {
     JNIEnv * env = jniGetThreadEnv();
     DJINNI_ASSERT(name, env);
-    GlobalRef<jclass> guard(env, env->FindClass(name));
+    GlobalRef<jclass> guard(env, findClassLocal(env, name).get());
     jniExceptionCheck(env);
     if (!guard) {
         jniThrowAssertionError(env, __FILE__, __LINE__, "FindClass returned null");
@@ -229,203 +393,512 @@ jfieldID jniGetFieldID(jclass clazz, const char * name, const char * sig) {
     return id;
 }
 
+/*
+ * Look up java.lang.Enum's private ordinal field. Reading it is much cheaper than a virtual
+ * call to ordinal(), but since it's not part of any API, fall back to the call if it's missing.
+ */
+static jfieldID findEnumOrdinalField() {
+    JNIEnv * const env = jniGetThreadEnv();
+    const LocalRef<jclass> enumClass(env, env->FindClass("java/lang/Enum"));
+    jniExceptionCheck(env);
+    const jfieldID field = env->GetFieldID(enumClass.get(), "ordinal", "I");
+    if (!field) {
+        env->ExceptionClear();
+    }
+    return field;
+}
+
 JniEnum::JniEnum(const std::string & name)
     : m_clazz { jniFindClass(name.c_str()) },
-      m_staticmethValues { jniGetStaticMethodID(m_clazz.get(), "values", ("()[L" + name + ";").c_str()) },
-      m_methOrdinal { jniGetMethodID(m_clazz.get(), "ordinal", "()I") }
+      m_methOrdinal { jniGetMethodID(m_clazz.get(), "ordinal", "()I") },
+      m_fieldOrdinal { findEnumOrdinalField() },
+      m_constants { loadConstants(name) }
     {}
 
+std::vector<GlobalRef<jobject>> JniEnum::loadConstants(const std::string & name) const {
+    JNIEnv * const env = jniGetThreadEnv();
+    const jmethodID values = jniGetStaticMethodID(m_clazz.get(), "values", ("()[L" + name + ";").c_str());
+    const LocalRef<jobjectArray> array(env, static_cast<jobjectArray>(
+        env->CallStaticObjectMethod(m_clazz.get(), values)));
+    DJINNI_ASSERT(array, env);
+
+    const jsize count = env->GetArrayLength(array.get());
+    std::vector<GlobalRef<jobject>> constants;
+    constants.reserve(count);
+    for (jsize i = 0; i < count; ++i) {
+        const LocalRef<jobject> constant(env, env->GetObjectArrayElement(array.get(), i));
+        jniExceptionCheck(env);
+        constants.emplace_back(env, constant.get());
+    }
+    return constants;
+}
+
 jint JniEnum::ordinal(JNIEnv * env, jobject obj) const {
     DJINNI_ASSERT(obj, env);
+    if (m_fieldOrdinal) {
+        return env->GetIntField(obj, m_fieldOrdinal);
+    }
     const jint res = env->CallIntMethod(obj, m_methOrdinal);
     jniExceptionCheck(env);
     return res;
 }
 
 LocalRef<jobject> JniEnum::create(JNIEnv * env, jint value) const {
-    LocalRef<jobject> values(env, env->CallStaticObjectMethod(m_clazz.get(), m_staticmethValues));
-    DJINNI_ASSERT(values, env);
-    return LocalRef<jobject>(env, env->GetObjectArrayElement(static_cast<jobjectArray>(values.get()), value));
+    DJINNI_ASSERT(value >= 0 && static_cast<size_t>(value) < m_constants.size(), env);
+    return LocalRef<jobject>(env, env->NewLocalRef(m_constants[value].get()));
 }
 
-JniLocalScope::JniLocalScope(JNIEnv* p_env, jint capacity, bool throwOnError)
-    : m_env(p_env)
-    , m_success(_pushLocalFrame(m_env, capacity)) {
-    if (throwOnError) {
-        DJINNI_ASSERT(m_success, m_env);
+namespace { // anonymous namespace to guard the structs below
+/*
+ * Classes from support-lib/java are looked up leniently, since apps that predate it won't have
+ * them on the class path. Returns a null ref if the class is missing.
+ */
+GlobalRef<jclass> findOptionalClass(const char * name) {
+    JNIEnv * const env = jniGetThreadEnv();
+    GlobalRef<jclass> guard(env, findClassLocal(env, name).get());
+    if (!guard) {
+        env->ExceptionClear();
     }
+    return guard;
 }
-JniLocalScope::~JniLocalScope() {
-    if (m_success) {
-        _popLocalFrame(m_env, nullptr);
+
+/*
+ * The Java half of the bulk collection path. Unlike other JniInfo structs this one tolerates
+ * a missing class, see findOptionalClass().
+ */
+struct BulkCollectionsJniInfo {
+    const GlobalRef<jclass> clazz { findOptionalClass("com/dropbox/djinni/BulkCollections") };
+    const jmethodID toArray[3] {
+        getOptionalStaticMethod("listToArray", "(Ljava/util/List;)[Ljava/lang/Object;"),
+        getOptionalStaticMethod("setToArray", "(Ljava/util/Set;)[Ljava/lang/Object;"),
+        getOptionalStaticMethod("mapToArray", "(Ljava/util/Map;)[Ljava/lang/Object;"),
+    };
+    const jmethodID fromArray[3] {
+        getOptionalStaticMethod("arrayToList", "([Ljava/lang/Object;)Ljava/util/ArrayList;"),
+        getOptionalStaticMethod("arrayToSet", "([Ljava/lang/Object;)Ljava/util/HashSet;"),
+        getOptionalStaticMethod("arrayToMap", "([Ljava/lang/Object;)Ljava/util/HashMap;"),
+    };
+
+    jmethodID getOptionalStaticMethod(const char * name, const char * sig) const {
+        return clazz ? jniGetStaticMethodID(clazz.get(), name, sig) : nullptr;
     }
+};
+
+/*
+ * Ties the lifetime of a SharedBuffer passed to Java to the direct ByteBuffer wrapping it.
+ * Also optional: without it, buffers can still be passed from Java to C++, but not back.
+ */
+struct NativeBuffersJniInfo {
+    const GlobalRef<jclass> clazz { findOptionalClass("com/dropbox/djinni/NativeBuffers") };
+    const jmethodID method_track {
+        clazz ? jniGetStaticMethodID(clazz.get(), "track", "(Ljava/nio/ByteBuffer;J)V") : nullptr
+    };
+};
+
+/*
+ * The part of a direct ByteBuffer that jniBufferToCpp passes on, from its position to its limit.
+ */
+struct JavaNioBufferJniInfo {
+    const GlobalRef<jclass> clazz { jniFindClass("java/nio/Buffer") };
+    const jmethodID method_position { jniGetMethodID(clazz.get(), "position", "()I") };
+    const jmethodID method_limit { jniGetMethodID(clazz.get(), "limit", "()I") };
+};
+
+/*
+ * The future<T> type needs CompletableFuture (Java 8, Android API 24) and NativeFutureHandler,
+ * but apps that don't use it shouldn't, so both are optional as well.
+ */
+struct CompletableFutureJniInfo {
+    const GlobalRef<jclass> clazz { findOptionalClass("java/util/concurrent/CompletableFuture") };
+    const GlobalRef<jclass> handlerClazz { findOptionalClass("com/dropbox/djinni/NativeFutureHandler") };
+    const jmethodID constructor { getOptionalMethod(clazz, "<init>", "()V") };
+    const jmethodID method_complete { getOptionalMethod(clazz, "complete", "(Ljava/lang/Object;)Z") };
+    const jmethodID method_completeExceptionally {
+        getOptionalMethod(clazz, "completeExceptionally", "(Ljava/lang/Throwable;)Z")
+    };
+    const jmethodID method_whenComplete {
+        getOptionalMethod(clazz, "whenComplete",
+                          "(Ljava/util/function/BiConsumer;)Ljava/util/concurrent/CompletableFuture;")
+    };
+    const jmethodID handlerConstructor { getOptionalMethod(handlerClazz, "<init>", "(J)V") };
+    const jmethodID handlerAccept {
+        getOptionalMethod(handlerClazz, "accept", "(Ljava/lang/Object;Ljava/lang/Throwable;)V")
+    };
+
+    static jmethodID getOptionalMethod(const GlobalRef<jclass> & c, const char * name, const char * sig) {
+        return c ? jniGetMethodID(c.get(), name, sig) : nullptr;
+    }
+};
+
+const CompletableFutureJniInfo & completableFutureJniInfo(JNIEnv * env) {
+    const auto & data = JniClass<CompletableFutureJniInfo>::get();
+    if (!data.clazz || !data.handlerClazz) {
+        jniThrowAssertionError(env, __FILE__, __LINE__,
+                               "future<T> needs java.util.concurrent.CompletableFuture and "
+                               "com.dropbox.djinni.NativeFutureHandler on the class path");
+    }
+    return data;
 }
+} // namespace
 
-bool JniLocalScope::_pushLocalFrame(JNIEnv* const env, jint capacity) {
+bool jniBulkCollectionsAvailable() {
+    return static_cast<bool>(JniClass<BulkCollectionsJniInfo>::get().clazz);
+}
+
+LocalRef<jobjectArray> jniCollectionToArray(JNIEnv * env, BulkCollection kind, jobject collection) {
+    const auto & data = JniClass<BulkCollectionsJniInfo>::get();
+    DJINNI_ASSERT(data.clazz, env);
+    LocalRef<jobjectArray> array(env, static_cast<jobjectArray>(env->CallStaticObjectMethod(
+        data.clazz.get(), data.toArray[static_cast<int>(kind)], collection)));
+    jniExceptionCheck(env);
+    DJINNI_ASSERT(array, env);
+    return array;
+}
+
+LocalRef<jobject> jniCollectionFromArray(JNIEnv * env, BulkCollection kind, jobjectArray array) {
+    const auto & data = JniClass<BulkCollectionsJniInfo>::get();
+    DJINNI_ASSERT(data.clazz, env);
+    LocalRef<jobject> collection(env, env->CallStaticObjectMethod(
+        data.clazz.get(), data.fromArray[static_cast<int>(kind)], array));
+    jniExceptionCheck(env);
+    DJINNI_ASSERT(collection, env);
+    return collection;
+}
+
+void jniSetScalarSlot(JNIEnv * env, jlongArray slot, std::initializer_list<jlong> values) {
+    DJINNI_ASSERT(slot, env);
+    env->SetLongArrayRegion(slot, 0, static_cast<jsize>(values.size()), values.begin());
+    jniExceptionCheck(env);
+}
+
+SharedBuffer jniBufferToCpp(JNIEnv * env, jobject buffer) {
+    DJINNI_ASSERT(buffer, env);
+    const jlong capacity = env->GetDirectBufferCapacity(buffer);
+    // -1 means that buffer isn't a direct buffer, or that this JVM can't share direct buffers.
     DJINNI_ASSERT(capacity >= 0, env);
-    const jint push_res = env->PushLocalFrame(capacity);
-    return 0 == push_res;
+    auto * const data = static_cast<uint8_t *>(env->GetDirectBufferAddress(buffer));
+    DJINNI_ASSERT(data || capacity == 0, env);
+    const auto & info = JniClass<JavaNioBufferJniInfo>::get();
+    const jint position = env->CallIntMethod(buffer, info.method_position);
+    jniExceptionCheck(env);
+    const jint limit = env->CallIntMethod(buffer, info.method_limit);
+    jniExceptionCheck(env);
+    DJINNI_ASSERT(0 <= position && position <= limit && limit <= capacity, env);
+    // The global ref keeps the ByteBuffer, and so its memory, alive for as long as C++ needs it.
+    auto owner = std::make_shared<GlobalRef<jobject>>(env, buffer);
+    return SharedBuffer(std::move(owner), data ? data + position : data,
+                        static_cast<size_t>(limit - position));
 }
 
-void JniLocalScope::_popLocalFrame(JNIEnv* const env, jobject returnRef) {
-    env->PopLocalFrame(returnRef);
+LocalRef<jobject> jniBufferFromCpp(JNIEnv * env, const SharedBuffer & buffer) {
+    const auto & data = JniClass<NativeBuffersJniInfo>::get();
+    if (!data.clazz) {
+        jniThrowAssertionError(env, __FILE__, __LINE__,
+                               "com.dropbox.djinni.NativeBuffers is not on the class path");
+    }
+    // Owned by the Java side from here on, and deleted by nativeRelease().
+    std::unique_ptr<SharedBuffer> ref(new SharedBuffer(buffer));
+    // NewDirectByteBuffer rejects a null address, even for an empty buffer.
+    static uint8_t s_empty;
+    LocalRef<jobject> j(env, env->NewDirectByteBuffer(ref->data() ? ref->data() : &s_empty,
+                                                      static_cast<jlong>(ref->size())));
+    jniExceptionCheck(env);
+    DJINNI_ASSERT(j, env);
+    env->CallStaticVoidMethod(data.clazz.get(), data.method_track, j.get(),
+                              static_cast<jlong>(reinterpret_cast<uintptr_t>(ref.get())));
+    jniExceptionCheck(env);
+    ref.release();
+    return j;
+}
+
+LocalRef<jobject> jniNewCompletableFuture(JNIEnv * env) {
+    const auto & data = completableFutureJniInfo(env);
+    LocalRef<jobject> future(env, env->NewObject(data.clazz.get(), data.constructor));
+    jniExceptionCheck(env);
+    DJINNI_ASSERT(future, env);
+    return future;
+}
+
+void jniCompleteFuture(JNIEnv * env, jobject future, jobject value) {
+    const auto & data = completableFutureJniInfo(env);
+    env->CallBooleanMethod(future, data.method_complete, value);
+    jniExceptionCheck(env);
+}
+
+void jniFailFutureFromCurrent(JNIEnv * env, jobject future) noexcept {
+    jniSetPendingFromCurrent(env, __func__);
+    const LocalRef<jthrowable> error(env, env->ExceptionOccurred());
+    env->ExceptionClear();
+    const auto & data = JniClass<CompletableFutureJniInfo>::get();
+    if (error && data.clazz) {
+        env->CallBooleanMethod(future, data.method_completeExceptionally, error.get());
+        // Nothing is left to report a failure to, and the future can't be left pending.
+        env->ExceptionClear();
+    }
+}
+
+void jniListenToFuture(JNIEnv * env, jobject future, FutureListener listener) {
+    const auto & data = completableFutureJniInfo(env);
+    // Owned by the handler from here on, and deleted by nativeComplete().
+    std::unique_ptr<FutureListener> ref(new FutureListener(std::move(listener)));
+    LocalRef<jobject> handler(env, env->NewObject(data.handlerClazz.get(), data.handlerConstructor,
+                                                  static_cast<jlong>(reinterpret_cast<uintptr_t>(ref.get()))));
+    jniExceptionCheck(env);
+    DJINNI_ASSERT(handler, env);
+    // The handler may run, and delete the listener, before whenComplete() even returns.
+    ref.release();
+    // Runs the handler right away if future is already complete. Exceptions from the handler
+    // go to the stage whenComplete() returns, which is dropped.
+    LocalRef<jobject> stage(env, env->CallObjectMethod(future, data.method_whenComplete, handler.get()));
+    const LocalRef<jthrowable> error(env, env->ExceptionOccurred());
+    if (error) {
+        // Nothing will call the handler now, so fail the listener with this exception instead.
+        // The handler ignores the call if it has already run.
+        env->ExceptionClear();
+        env->CallVoidMethod(handler.get(), data.handlerAccept, nullptr, error.get());
+        jniExceptionCheck(env);
+    }
 }
 
+static std::atomic<uint64_t> g_onewayDropped { 0 };
+
+namespace {
+
 /*
- * UTF-8 and UTF-16 conversion functions from miniutf: https://github.com/dropbox/miniutf
+ * The state behind JniOnewayQueue. Created by the first post and never freed, since its
+ * detached dispatcher thread may still be waiting on it while statics are destroyed at exit.
  */
+class OnewayDispatcher {
+public:
+    static OnewayDispatcher & get() {
+        static OnewayDispatcher * const s_instance = new OnewayDispatcher;
+        return *s_instance;
+    }
+
+    // Calls that aren't bounded don't count against onewayQueueDepth and are never dropped.
+    // They're used by flush() and postAt(). A call isn't made before due.
+    bool post(JniOnewayQueue::Call call, bool bounded,
+              std::chrono::steady_clock::time_point due = std::chrono::steady_clock::time_point());
+
+private:
+    struct Node {
+        JniOnewayQueue::Call call;
+        std::chrono::steady_clock::time_point due;
+        bool bounded;
+        Node * next;
+    };
 
-struct offset_pt {
-    int offset;
-    char32_t pt;
+    OnewayDispatcher() {
+        std::thread([this] { run(); }).detach();
+    }
+
+    void run();
+    static void deliver(JNIEnv * env, Node & node);
+
+    std::atomic<Node *> m_head { nullptr };
+    std::atomic<size_t> m_waiting { 0 }; // bounded calls only
+    std::atomic<size_t> m_excess { 0 }; // oldest calls to discard, under DropOldest
+    std::mutex m_mutex;                 // only guards sleeping and waking up
+    std::condition_variable m_wake;
 };
 
-static constexpr const offset_pt invalid_pt = { -1, 0 };
+bool OnewayDispatcher::post(JniOnewayQueue::Call call, bool bounded,
+                            std::chrono::steady_clock::time_point due) {
+    std::unique_ptr<Node> node(new Node { std::move(call), due, bounded, nullptr });
+    const size_t depth = g_initOptions.onewayQueueDepth;
+    const size_t waiting = bounded ? m_waiting.fetch_add(1, std::memory_order_relaxed) : 0;
+    if (bounded && depth && waiting >= depth) {
+        if (g_initOptions.onewayDropPolicy == OnewayDropPolicy::DropNewest) {
+            m_waiting.fetch_sub(1, std::memory_order_relaxed);
+            g_onewayDropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_excess.fetch_add(1, std::memory_order_relaxed);
+    }
+    // As in JniDeferredGlobalRefs, the consumer takes the whole list, so there's no ABA problem.
+    // Once pushed, the node may be delivered and freed at any moment, so only head is read after.
+    Node * head = m_head.load(std::memory_order_relaxed);
+    do {
+        node->next = head;
+    } while (!m_head.compare_exchange_weak(head, node.get(), std::memory_order_release,
+                                           std::memory_order_relaxed));
+    node.release();
+    if (!head) {
+        // The dispatcher checks for work under the lock before it sleeps, so taking it here
+        // means the notification can't slip in between the two.
+        { std::lock_guard<std::mutex> lock(m_mutex); }
+        m_wake.notify_one();
+    }
+    return true;
+}
 
-/*
- * Decode a codepoint starting at str[i], and return the number of code units (bytes, for
- * UTF-8) consumed and the result. If no valid codepoint is at str[i], return invalid_pt.
- */
-static offset_pt utf8_decode_check(const std::string & str, std::string::size_type i) {
-    uint32_t b0, b1, b2, b3;
-
-    b0 = static_cast<unsigned char>(str[i]);
-
-    if (b0 < 0x80) {
-        // 1-byte character
-        return { 1, b0 };
-    } else if (b0 < 0xC0) {
-        // Unexpected continuation byte
-        return invalid_pt;
-    } else if (b0 < 0xE0) {
-        // 2-byte character
-        if (((b1 = str[i+1]) & 0xC0) != 0x80)
-            return invalid_pt;
-
-        char32_t pt = (b0 & 0x1F) << 6 | (b1 & 0x3F);
-        if (pt < 0x80)
-            return invalid_pt;
-
-        return { 2, pt };
-    } else if (b0 < 0xF0) {
-        // 3-byte character
-        if (((b1 = str[i+1]) & 0xC0) != 0x80)
-            return invalid_pt;
-        if (((b2 = str[i+2]) & 0xC0) != 0x80)
-            return invalid_pt;
-
-        char32_t pt = (b0 & 0x0F) << 12 | (b1 & 0x3F) << 6 | (b2 & 0x3F);
-        if (pt < 0x800)
-            return invalid_pt;
-
-        return { 3, pt };
-    } else if (b0 < 0xF8) {
-        // 4-byte character
-        if (((b1 = str[i+1]) & 0xC0) != 0x80)
-            return invalid_pt;
-        if (((b2 = str[i+2]) & 0xC0) != 0x80)
-            return invalid_pt;
-        if (((b3 = str[i+3]) & 0xC0) != 0x80)
-            return invalid_pt;
-
-        char32_t pt = (b0 & 0x0F) << 18 | (b1 & 0x3F) << 12
-                    | (b2 & 0x3F) << 6  | (b3 & 0x3F);
-        if (pt < 0x10000 || pt >= 0x110000)
-            return invalid_pt;
-
-        return { 4, pt };
-    } else {
-        // Codepoint out of range
-        return invalid_pt;
+void OnewayDispatcher::run() {
+    // Attached even if JniInitOptions::attachNativeThreads is off: this thread is ours.
+    JNIEnv * env = g_cachedJVM ? lookupThreadEnv(false) : nullptr;
+    if (!env && g_cachedJVM) {
+        env = attachCurrentThread();
+    }
+    if (!env) {
+        std::abort();
+    }
+    // Calls that aren't due yet, soonest first. Only this thread uses it.
+    std::multimap<std::chrono::steady_clock::time_point, std::unique_ptr<Node>> delayed;
+    const auto posted = [this] { return m_head.load(std::memory_order_relaxed) != nullptr; };
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (delayed.empty()) {
+                m_wake.wait(lock, posted);
+            } else {
+                m_wake.wait_until(lock, delayed.begin()->first, posted);
+            }
+        }
+        // The list is newest first; reverse it into the order the calls were posted in.
+        Node * node = m_head.exchange(nullptr, std::memory_order_acquire);
+        Node * batch = nullptr;
+        size_t count = 0;
+        while (node) {
+            Node * const next = node->next;
+            node->next = batch;
+            batch = node;
+            count += node->bounded;
+            node = next;
+        }
+        m_waiting.fetch_sub(count, std::memory_order_relaxed);
+        const size_t excess = m_excess.exchange(0, std::memory_order_relaxed);
+        size_t discard = std::min(excess, count);
+        if (excess > discard) {
+            m_excess.fetch_add(excess - discard, std::memory_order_relaxed);
+        }
+        g_onewayDropped.fetch_add(discard, std::memory_order_relaxed);
+
+        JniDeferredGlobalRefs::drain(env);
+        auto now = std::chrono::steady_clock::now();
+        while (batch) {
+            std::unique_ptr<Node> current(batch);
+            batch = batch->next;
+            if (discard > 0 && current->bounded) {
+                --discard;
+                continue;
+            }
+            if (current->due > now) {
+                const auto due = current->due;
+                delayed.emplace(due, std::move(current));
+                continue;
+            }
+            deliver(env, *current);
+        }
+        now = std::chrono::steady_clock::now();
+        while (!delayed.empty() && delayed.begin()->first <= now) {
+            const std::unique_ptr<Node> current = std::move(delayed.begin()->second);
+            delayed.erase(delayed.begin());
+            deliver(env, *current);
+        }
     }
 }
 
-static char32_t utf8_decode(const std::string & str, std::string::size_type & i) {
-    offset_pt res = utf8_decode_check(str, i);
-    if (res.offset < 0) {
-        i += 1;
-        return 0xFFFD;
-    } else {
-        i += res.offset;
-        return res.pt;
+void OnewayDispatcher::deliver(JNIEnv * env, Node & node) {
+    // After jniShutdown there's no JVM left to call.
+    if (!g_cachedJVM) {
+        return;
+    }
+    try {
+        node.call(env);
+    } catch (const std::exception &) {
+        jniSetPendingFromCurrent(env, "oneway call");
+        env->ExceptionDescribe();
+        env->ExceptionClear();
     }
 }
 
-static void utf16_encode(char32_t pt, std::u16string & out) {
-    if (pt < 0x10000) {
-        out += static_cast<char16_t>(pt);
-    } else if (pt < 0x110000) {
-        out += { static_cast<char16_t>(((pt - 0x10000) >> 10) + 0xD800),
-                 static_cast<char16_t>((pt & 0x3FF) + 0xDC00) };
-    } else {
-        out += 0xFFFD;
+} // namespace
+
+bool JniOnewayQueue::post(Call call) noexcept {
+    try {
+        return OnewayDispatcher::get().post(std::move(call), true);
+    } catch (const std::exception &) {
+        // Out of memory, or no thread to be had.
+        g_onewayDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
     }
 }
 
-jstring jniStringFromUTF8(JNIEnv * env, const std::string & str) {
+bool JniOnewayQueue::postAt(std::chrono::steady_clock::time_point due, Call call) noexcept {
+    try {
+        return OnewayDispatcher::get().post(std::move(call), false, due);
+    } catch (const std::exception &) {
+        g_onewayDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+}
 
-    std::u16string utf16;
-    utf16.reserve(str.length()); // likely overallocate
-    for (std::string::size_type i = 0; i < str.length(); )
-        utf16_encode(utf8_decode(str, i), utf16);
+void JniOnewayQueue::flush() {
+    // If the marker is discarded rather than called, destroying it breaks the promise, which
+    // also ends the wait.
+    const auto marker = std::make_shared<std::promise<void>>();
+    auto delivered = marker->get_future();
+    OnewayDispatcher::get().post([marker] (JNIEnv *) { marker->set_value(); }, false);
+    delivered.wait();
+}
 
-    jstring res = env->NewString(
-        reinterpret_cast<const jchar *>(utf16.data()), utf16.length());
-    DJINNI_ASSERT(res, env);
-    return res;
+uint64_t JniOnewayQueue::droppedCount() noexcept {
+    return g_onewayDropped.load(std::memory_order_relaxed);
 }
 
-// UTF-16 decode helpers.
-static inline bool is_high_surrogate(char16_t c) { return (c >= 0xD800) && (c < 0xDC00); }
-static inline bool is_low_surrogate(char16_t c)  { return (c >= 0xDC00) && (c < 0xE000); }
+std::chrono::steady_clock::duration JniOnewayQueue::coalesceInterval() noexcept {
+    return g_initOptions.coalesceInterval;
+}
 
-/*
- * Like utf8_decode_check, but for UTF-16.
- */
-static offset_pt utf16_decode_check(const std::u16string & str, std::u16string::size_type i) {
-    if (is_high_surrogate(str[i]) && is_low_surrogate(str[i+1])) {
-        // High surrogate followed by low surrogate
-        char32_t pt = (((str[i] - 0xD800) << 10) | (str[i+1] - 0xDC00)) + 0x10000;
-        return { 2, pt };
-    } else if (is_high_surrogate(str[i]) || is_low_surrogate(str[i])) {
-        // High surrogate *not* followed by low surrogate, or unpaired low surrogate
-        return invalid_pt;
-    } else {
-        return { 1, str[i] };
+JniLocalScope::JniLocalScope(JNIEnv* p_env, jint capacity, bool throwOnError)
+    : m_env(p_env)
+    , m_success(_pushLocalFrame(m_env, capacity)) {
+    if (throwOnError) {
+        DJINNI_ASSERT(m_success, m_env);
+    }
+}
+JniLocalScope::~JniLocalScope() {
+    if (m_success) {
+        _popLocalFrame(m_env, nullptr);
     }
 }
 
-static char32_t utf16_decode(const std::u16string & str, std::u16string::size_type & i) {
-    offset_pt res = utf16_decode_check(str, i);
-    if (res.offset < 0) {
-        i += 1;
-        return 0xFFFD;
-    } else {
-        i += res.offset;
-        return res.pt;
-    }
-}
-
-static void utf8_encode(char32_t pt, std::string & out) {
-    if (pt < 0x80) {
-        out += static_cast<char>(pt);
-    } else if (pt < 0x800) {
-        out += { static_cast<char>((pt >> 6)   | 0xC0),
-                 static_cast<char>((pt & 0x3F) | 0x80) };
-    } else if (pt < 0x10000) {
-        out += { static_cast<char>((pt >> 12)         | 0xE0),
-                 static_cast<char>(((pt >> 6) & 0x3F) | 0x80),
-                 static_cast<char>((pt & 0x3F)        | 0x80) };
-    } else if (pt < 0x110000) {
-        out += { static_cast<char>((pt >> 18)          | 0xF0),
-                 static_cast<char>(((pt >> 12) & 0x3F) | 0x80),
-                 static_cast<char>(((pt >> 6)  & 0x3F) | 0x80),
-                 static_cast<char>((pt & 0x3F)         | 0x80) };
+bool JniLocalScope::_pushLocalFrame(JNIEnv* const env, jint capacity) {
+    DJINNI_ASSERT(capacity >= 0, env);
+    const jint push_res = env->PushLocalFrame(capacity);
+    return 0 == push_res;
+}
+
+void JniLocalScope::_popLocalFrame(JNIEnv* const env, jobject returnRef) {
+    env->PopLocalFrame(returnRef);
+}
+
+/*
+ * Strings up to this many code units are converted through buffers on the stack, so the only
+ * allocation left is the one for the result itself (and none at all for jstring results or
+ * std::string results that fit the small-string buffer).
+ */
+static constexpr size_t kStackStringUnits = 128;
+
+jstring jniStringFromUTF8(JNIEnv * env, const std::string & str) {
+    const UtfTranscoder & transcoder = utfTranscoder();
+    const size_t length = str.length();
+
+    jstring res;
+    if (transcoder.ascii_prefix(str.data(), length) == length) {
+        // Plain ASCII is also valid modified UTF-8, so the JVM can read our buffer directly.
+        res = env->NewStringUTF(str.c_str());
+    } else if (length <= kStackStringUnits) {
+        // One UTF-16 code unit per byte is always enough.
+        char16_t utf16[kStackStringUnits];
+        const size_t n = transcoder.utf8_to_utf16(str.data(), length, utf16);
+        res = env->NewString(reinterpret_cast<const jchar *>(utf16), static_cast<jsize>(n));
     } else {
-        out += { static_cast<char>(0xEF),
-                 static_cast<char>(0xBF),
-                 static_cast<char>(0xBD) }; // U+FFFD
+        std::unique_ptr<char16_t[]> utf16(new char16_t[length]);
+        const size_t n = transcoder.utf8_to_utf16(str.data(), length, utf16.get());
+        res = env->NewString(reinterpret_cast<const jchar *>(utf16.get()), static_cast<jsize>(n));
     }
+    DJINNI_ASSERT(res, env);
+    return res;
 }
 
 std::string jniUTF8FromString(JNIEnv * env, const jstring jstr) {
@@ -433,15 +906,40 @@ std::string jniUTF8FromString(JNIEnv * env, const jstring jstr) {
     const jsize length = env->GetStringLength(jstr);
     jniExceptionCheck(env);
 
+    const UtfTranscoder & transcoder = utfTranscoder();
+
+    if (static_cast<size_t>(length) <= kStackStringUnits) {
+        jchar utf16[kStackStringUnits];
+        env->GetStringRegion(jstr, 0, length, utf16);
+        jniExceptionCheck(env);
+        // At most three UTF-8 bytes per UTF-16 code unit.
+        char utf8[kStackStringUnits * 3];
+        const size_t n = transcoder.utf16_to_utf8(
+            reinterpret_cast<const char16_t *>(utf16), length, utf8);
+        return std::string(utf8, n);
+    }
+
+    // If the modified UTF-8 length equals the UTF-16 length, every character is in
+    // U+0001-U+007F, where modified UTF-8 and UTF-8 agree byte for byte.
+    const jsize utf8Length = env->GetStringUTFLength(jstr);
+    jniExceptionCheck(env);
+    if (utf8Length == length) {
+        // GetStringUTFRegion may append a NUL, so leave room for one before the terminator.
+        std::string out(static_cast<size_t>(length) + 1, '\0');
+        env->GetStringUTFRegion(jstr, 0, length, &out[0]);
+        jniExceptionCheck(env);
+        out.resize(static_cast<size_t>(length));
+        return out;
+    }
+
     const auto deleter = [env, jstr] (const jchar * c) { env->ReleaseStringChars(jstr, c); };
     std::unique_ptr<const jchar, decltype(deleter)> ptr(env->GetStringChars(jstr, nullptr),
                                                         deleter);
+    DJINNI_ASSERT(ptr, env);
+    const auto utf16 = reinterpret_cast<const char16_t *>(ptr.get());
 
-    std::u16string str(reinterpret_cast<const char16_t *>(ptr.get()), length);
-    std::string out;
-    out.reserve(str.length() * 3 / 2); // estimate
-    for (std::u16string::size_type i = 0; i < str.length(); )
-        utf8_encode(utf16_decode(str, i), out);
+    std::string out(utf16ToUtf8Length(utf16, length), '\0');
+    transcoder.utf16_to_utf8(utf16, length, &out[0]);
     return out;
 }
 
@@ -465,16 +963,101 @@ void jniDefaultSetPendingFromCurrent(JNIEnv * env, const char * /*ctx*/) noexcep
     // exceptions which aren't std::exception subclasses).
 }
 
+/*
+ * System.identityHashCode(obj), read from (and saved to) the given int field of obj if there
+ * is one, so that objects seen before don't need a call into Java.
+ */
+static jint javaIdentityHash(JNIEnv * env, jobject obj, jfieldID cacheField) {
+    if (cacheField) {
+        const jint cached = env->GetIntField(obj, cacheField);
+        jniExceptionCheck(env);
+        if (cached != 0) {
+            return cached;
+        }
+    }
+    const SystemClassInfo & sys = JniClass<SystemClassInfo>::get();
+    const jint hash = env->CallStaticIntMethod(sys.clazz.get(), sys.staticmethIdentityHashCode, obj);
+    jniExceptionCheck(env);
+    if (cacheField) {
+        // Racing threads all store the same value, so no synchronization is needed.
+        env->SetIntField(obj, cacheField, hash);
+        jniExceptionCheck(env);
+    }
+    return hash;
+}
+
+namespace {
+// Size of one of the proxy caches, summed over its shards, for jniProxyCacheStats().
+struct ProxyCacheCounter {
+    std::atomic<size_t> size { 0 };
+    std::atomic<size_t> highWater { 0 };
+
+    void add() {
+        const size_t n = size.fetch_add(1, std::memory_order_relaxed) + 1;
+        size_t seen = highWater.load(std::memory_order_relaxed);
+        while (n > seen && !highWater.compare_exchange_weak(seen, n, std::memory_order_relaxed)) {}
+    }
+    void remove() {
+        size.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+
+ProxyCacheCounter g_javaProxyCount;
+ProxyCacheCounter g_cppProxyCount;
+std::atomic<size_t> g_cppProxiesSwept { 0 };
+
+/*
+ * Map key: a Java object plus its precomputed identity hash, so that hashing and comparing
+ * keys under a shard lock never calls into Java.
+ */
+struct JavaProxyCacheKey {
+    jobject obj;
+    jint hash;
+};
+struct JavaProxyCacheKeyHash {
+    size_t operator() (const JavaProxyCacheKey & key) const { return static_cast<size_t>(key.hash); }
+};
+struct JavaProxyCacheKeyEquals {
+    bool operator() (const JavaProxyCacheKey & a, const JavaProxyCacheKey & b) const {
+        if (a.obj == b.obj) {
+            return true;
+        }
+        if (a.hash != b.hash) {
+            return false;
+        }
+        // This runs under a shard mutex from ~JavaProxyCacheEntry, which may be on any thread, so
+        // it must never attach or abort. A thread without a JNIEnv only ever looks up an entry's
+        // own key, and there is at most one entry per Java object, so other keys can't match.
+        JNIEnv * env = t_threadEnv.env;
+        if (!env && (!g_cachedJVM
+                || g_cachedJVM->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) != JNI_OK)) {
+            return false;
+        }
+        return env->IsSameObject(a.obj, b.obj);
+    }
+};
+
 struct JavaProxyCacheState {
-    std::mutex mtx;
-    std::unordered_map<jobject, std::weak_ptr<void>, JavaIdentityHash, JavaIdentityEquals> m;
-    int counter = 0;
+    struct Shard {
+        std::mutex mtx;
+        std::unordered_map<JavaProxyCacheKey, std::weak_ptr<void>,
+                           JavaProxyCacheKeyHash, JavaProxyCacheKeyEquals> m;
+    };
+    static constexpr int kShardBits = 4;
+    Shard shards[1 << kShardBits];
+
+    Shard & shard(jint hash) {
+        // Identity hashes often differ only in their high bits; mix before picking a shard.
+        const uint32_t mixed = static_cast<uint32_t>(hash) * 0x9E3779B1u;
+        return shards[mixed >> (32 - kShardBits)];
+    }
 
     static JavaProxyCacheState & get() {
         static JavaProxyCacheState st;
         return st;
     }
 };
+} // namespace
 
 JavaProxyCacheEntry::JavaProxyCacheEntry(jobject localRef, JNIEnv * env)
     : m_globalRef(env, localRef) {
@@ -485,26 +1068,41 @@ JavaProxyCacheEntry::JavaProxyCacheEntry(jobject localRef)
     : JavaProxyCacheEntry(localRef, jniGetThreadEnv()) {}
 
 JavaProxyCacheEntry::~JavaProxyCacheEntry() noexcept {
-    JavaProxyCacheState & st = JavaProxyCacheState::get();
-    const std::lock_guard<std::mutex> lock(st.mtx);
-    st.m.erase(m_globalRef.get());
+    JavaProxyCacheState::Shard & shard = JavaProxyCacheState::get().shard(m_identityHash);
+    const std::lock_guard<std::mutex> lock(shard.mtx);
+    const auto it = shard.m.find({ m_globalRef.get(), m_identityHash });
+    // Once our weak_ptr expired, a lookup may already have replaced us with a new entry for
+    // the same object. Leave that one alone.
+    if (it != shard.m.end() && it->second.expired()) {
+        shard.m.erase(it);
+        g_javaProxyCount.remove();
+    }
 }
 
-std::shared_ptr<void> javaProxyCacheLookup(jobject obj, std::pair<std::shared_ptr<void>, jobject>(*factory)(jobject)) {
-    JavaProxyCacheState & st = JavaProxyCacheState::get();
-    const std::lock_guard<std::mutex> lock(st.mtx);
+std::shared_ptr<void> javaProxyCacheLookup(jobject obj, jfieldID identityHashField,
+                                           std::pair<std::shared_ptr<void>,
+                                                     JavaProxyCacheEntry *>(*factory)(jobject)) {
+    const jint hash = javaIdentityHash(jniGetThreadEnv(), obj, identityHashField);
+    JavaProxyCacheState::Shard & shard = JavaProxyCacheState::get().shard(hash);
+    const std::lock_guard<std::mutex> lock(shard.mtx);
 
-    const auto it = st.m.find(obj);
-    if (it != st.m.end()) {
+    const auto it = shard.m.find({ obj, hash });
+    if (it != shard.m.end()) {
         std::shared_ptr<void> ptr = it->second.lock();
         if (ptr) {
             return ptr;
         }
+        // The old entry is being destroyed. Its key refers to its own global ref, which is
+        // about to go away, so replace the whole map node rather than just the value.
+        shard.m.erase(it);
+        g_javaProxyCount.remove();
     }
 
     // Otherwise, construct a new T, save it, and return it.
-    std::pair<std::shared_ptr<void>, jobject> ret = factory(obj);
-    st.m[ret.second] = ret.first;
+    std::pair<std::shared_ptr<void>, JavaProxyCacheEntry *> ret = factory(obj);
+    ret.second->m_identityHash = hash;
+    shard.m.emplace(JavaProxyCacheKey{ ret.second->getGlobalRef(), hash }, ret.first);
+    g_javaProxyCount.add();
     return ret.first;
 }
 
@@ -521,7 +1119,7 @@ CppProxyClassInfo::~CppProxyClassInfo() {
 }
 
 /*
- * Wrapper around Java WeakReference objects. (We can't use JNI NewWeakGlobalRef() because
+ * Helpers for Java WeakReference objects. (We can't use JNI NewWeakGlobalRef() because
  * it doesn't have the right semantics - see comment in djinni_support.hpp.)
  */
 class JavaWeakRef {
@@ -533,74 +1131,429 @@ private:
         const jmethodID method_get { jniGetMethodID(clazz.get(), "get", "()Ljava/lang/Object;") };
     };
 
-    // Helper used by constructor
-    static jobject create(JNIEnv * jniEnv, jobject obj) {
+public:
+    // Returns a global reference to a new WeakReference to obj.
+    static GlobalRef<jobject> create(JNIEnv * jniEnv, jobject obj) {
         const JniInfo & weakRefClass = JniClass<JniInfo>::get();
-        jobject weakRef = jniEnv->NewObject(weakRefClass.clazz.get(), weakRefClass.constructor, obj);
+        LocalRef<jobject> weakRef(jniEnv, jniEnv->NewObject(weakRefClass.clazz.get(),
+                                                            weakRefClass.constructor,
+                                                            obj));
         // DJINNI_ASSERT performs an exception check before anything else, so we don't need
         // a separate jniExceptionCheck call.
         DJINNI_ASSERT(weakRef, jniEnv);
-        return weakRef;
+        return GlobalRef<jobject>(jniEnv, weakRef.get());
     }
 
-public:
-    // Constructor
-    JavaWeakRef(JNIEnv * jniEnv, jobject obj) : m_weakRef(jniEnv, create(jniEnv, obj)) {}
-
-    // Get the object pointed to if it's still strongly reachable or, return null if not.
-    // (Analogous to weak_ptr::lock.) Returns a local reference.
-    jobject get(JNIEnv * jniEnv) {
+    // Get the object pointed to by the given WeakReference if it's still strongly reachable or,
+    // return null if not. (Analogous to weak_ptr::lock.) Returns a local reference.
+    static jobject get(JNIEnv * jniEnv, jobject weakRef) {
         const JniInfo & weakRefClass = JniClass<JniInfo>::get();
-        jobject javaObj = jniEnv->CallObjectMethod(m_weakRef.get(), weakRefClass.method_get);
+        jobject javaObj = jniEnv->CallObjectMethod(weakRef, weakRefClass.method_get);
         jniExceptionCheck(jniEnv);
         return javaObj;
     }
 
+    JavaWeakRef() = delete;
+};
+
+namespace {
+/*
+ * Allocator for CppProxyHandles. Every CppProxyHandle<T> holds a shared_ptr and nothing else,
+ * so they all have the same size: blocks of that size are carved out of slabs, and freed
+ * blocks are kept on a list for reuse. Slabs are never returned to the system.
+ *
+ * Each thread keeps a small list of free blocks of its own, and only takes the shared lock to
+ * move a batch of blocks to or from the shared list.
+ */
+class CppProxyHandleSlab {
+public:
+    static constexpr size_t kBlockSize = sizeof(CppProxyHandle<void>);
+
+    struct FreeBlock {
+        FreeBlock * next;
+    };
+
+    // Takes up to n blocks, at least one, and returns them as a list.
+    FreeBlock * allocateBatch(size_t n, size_t & taken) {
+        const std::lock_guard<std::mutex> lock(m_mtx);
+        FreeBlock * head = nullptr;
+        for (taken = 0; taken < n && m_free; ++taken) {
+            FreeBlock * block = m_free;
+            m_free = block->next;
+            block->next = head;
+            head = block;
+        }
+        for (; taken < n; ++taken) {
+            if (m_next == m_end) {
+                if (taken) {
+                    break;
+                }
+                m_next = static_cast<char *>(::operator new(kSlabSize));
+                m_end = m_next + kSlabSize / kBlockSize * kBlockSize;
+            }
+            head = new (m_next) FreeBlock { head };
+            m_next += kBlockSize;
+        }
+        return head;
+    }
+
+    // Returns the list from head to tail.
+    void freeBatch(FreeBlock * head, FreeBlock * tail) noexcept {
+        const std::lock_guard<std::mutex> lock(m_mtx);
+        tail->next = m_free;
+        m_free = head;
+    }
+
+    static CppProxyHandleSlab & get() {
+        static CppProxyHandleSlab slab;
+        return slab;
+    }
+
 private:
-    GlobalRef<jobject> m_weakRef;
+    static_assert(kBlockSize >= sizeof(FreeBlock), "handle too small for the free list");
+    static_assert(kBlockSize % alignof(CppProxyHandle<void>) == 0, "misaligned handle size");
+    static constexpr size_t kSlabSize = 64 * 1024;
+
+    std::mutex m_mtx;
+    FreeBlock * m_free = nullptr;
+    char * m_next = nullptr;
+    char * m_end = nullptr;
 };
 
-struct CppProxyCacheState {
+/*
+ * Per-thread free blocks. Like ThreadEnv it has no destructor; onThreadExit hands the blocks back
+ * to the shared slab, and handles freed after that go straight to the slab.
+ */
+struct CppProxyHandleCache {
+    using FreeBlock = CppProxyHandleSlab::FreeBlock;
+    static constexpr size_t kBatch = 32;
+
+    FreeBlock * head = nullptr;
+    size_t count = 0;
+    bool exiting = false;
+
+    void * allocate() {
+        if (!head) {
+            if (!exiting) {
+                runOnThreadExit();
+            }
+            head = CppProxyHandleSlab::get().allocateBatch(exiting ? 1 : kBatch, count);
+        }
+        FreeBlock * block = head;
+        head = block->next;
+        --count;
+        return block;
+    }
+
+    void free(void * p) noexcept {
+        FreeBlock * block = new (p) FreeBlock { head };
+        if (exiting) {
+            CppProxyHandleSlab::get().freeBatch(block, block);
+            return;
+        }
+        head = block;
+        if (++count > 2 * kBatch) {
+            // Keep one batch, and give the rest back.
+            FreeBlock * last = head;
+            for (size_t i = 1; i < kBatch; ++i) {
+                last = last->next;
+            }
+            FreeBlock * rest = last->next;
+            FreeBlock * restTail = rest;
+            while (restTail->next) {
+                restTail = restTail->next;
+            }
+            last->next = nullptr;
+            count = kBatch;
+            CppProxyHandleSlab::get().freeBatch(rest, restTail);
+        }
+    }
+
+    void drain() noexcept {
+        exiting = true;
+        if (head) {
+            FreeBlock * tail = head;
+            while (tail->next) {
+                tail = tail->next;
+            }
+            CppProxyHandleSlab::get().freeBatch(head, tail);
+            head = nullptr;
+            count = 0;
+        }
+    }
+};
+static_assert(std::is_trivially_destructible<CppProxyHandleCache>::value,
+              "must stay usable from thread_local destructors");
+} // namespace
+
+static thread_local CppProxyHandleCache t_cppProxyHandleCache;
+
+static void drainCppProxyHandleCache() noexcept {
+    t_cppProxyHandleCache.drain();
+}
+
+/*static*/ void * CppProxyHandleBase::operator new(size_t size) {
+    if (size == CppProxyHandleSlab::kBlockSize) {
+        return t_cppProxyHandleCache.allocate();
+    }
+    return ::operator new(size);
+}
+
+/*static*/ void CppProxyHandleBase::operator delete(void * p, size_t size) noexcept {
+    if (size == CppProxyHandleSlab::kBlockSize) {
+        t_cppProxyHandleCache.free(p);
+    } else {
+        ::operator delete(p);
+    }
+}
+
+struct CppProxyCacheShard {
     std::mutex mtx;
-    std::unordered_map<void *, JavaWeakRef> m;
+    std::vector<CppProxyHandleBase *> buckets = std::vector<CppProxyHandleBase *>(16);
+    size_t count = 0;
+    size_t sweepCursor = 0; // next bucket to sweep
+
+    static uint64_t hash(const void * key) {
+        // Allocations are aligned, so the low bits carry no information; mix them away.
+        return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key) >> 4) * 0x9E3779B97F4A7C15ull;
+    }
+
+    CppProxyHandleBase *& bucket(const void * key) {
+        // The top bits pick the shard, so use the ones just below them. The bucket count is
+        // always a power of two.
+        return buckets[(hash(key) >> 24) & (buckets.size() - 1)];
+    }
+
+    CppProxyHandleBase * find(const void * key) {
+        for (CppProxyHandleBase * h = bucket(key); h; h = h->m_next) {
+            if (h->m_key == key) {
+                return h;
+            }
+        }
+        return nullptr;
+    }
+
+    void insert(CppProxyHandleBase * handle, GlobalRef<jobject> weakRef) {
+        if (count >= buckets.size()) {
+            std::vector<CppProxyHandleBase *> old(buckets.size() * 2, nullptr);
+            old.swap(buckets);
+            for (CppProxyHandleBase * h : old) {
+                while (h) {
+                    CppProxyHandleBase * const next = h->m_next;
+                    CppProxyHandleBase *& head = bucket(h->m_key);
+                    h->m_next = head;
+                    head = h;
+                    h = next;
+                }
+            }
+        }
+        CppProxyHandleBase *& head = bucket(handle->m_key);
+        handle->m_next = head;
+        handle->m_weakRef = std::move(weakRef);
+        head = handle;
+        ++count;
+        g_cppProxyCount.add();
+    }
+
+    void remove(CppProxyHandleBase * handle) {
+        for (CppProxyHandleBase ** link = &bucket(handle->m_key); *link; link = &(*link)->m_next) {
+            if (*link == handle) {
+                *link = handle->m_next;
+                handle->m_next = nullptr;
+                handle->m_weakRef.reset();
+                --count;
+                g_cppProxyCount.remove();
+                return;
+            }
+        }
+    }
+
+    /*
+     * Incremental sweep. After an insert, and still under the lock, collect() picks the entries
+     * of the next bucket in turn. sweep() then checks them without the lock, since that calls
+     * into Java, and removes those whose CppProxy is gone. Their handles stay alive until the
+     * Java side releases them, but the GlobalRef and WeakReference go away right here.
+     */
+    struct SweepCandidates {
+        static constexpr int kMax = 4;
+        int n = 0;
+        CppProxyHandleBase * handles[kMax];
+        void * keys[kMax];
+        LocalRef<jobject> weakRefs[kMax];
+    };
+
+    void collect(JNIEnv * jniEnv, SweepCandidates & out) {
+        CppProxyHandleBase * h = buckets[sweepCursor++ & (buckets.size() - 1)];
+        for (; h && out.n < SweepCandidates::kMax; h = h->m_next, ++out.n) {
+            out.handles[out.n] = h;
+            out.keys[out.n] = h->m_key;
+            out.weakRefs[out.n] = LocalRef<jobject>(jniEnv, jniEnv->NewLocalRef(h->m_weakRef.get()));
+        }
+    }
+
+    void sweep(JNIEnv * jniEnv, SweepCandidates & candidates) {
+        bool dead[SweepCandidates::kMax];
+        bool anyDead = false;
+        for (int i = 0; i < candidates.n; ++i) {
+            const LocalRef<jobject> obj(jniEnv, JavaWeakRef::get(jniEnv, candidates.weakRefs[i].get()));
+            dead[i] = !obj;
+            anyDead |= dead[i];
+        }
+        if (!anyDead) {
+            return;
+        }
+        const std::lock_guard<std::mutex> lock(mtx);
+        for (int i = 0; i < candidates.n; ++i) {
+            // The handle may have been released and its memory reused since we let go of the
+            // lock. Only a handle that is still linked under its key is safe to look at.
+            CppProxyHandleBase * const h = candidates.handles[i];
+            if (dead[i] && find(candidates.keys[i]) == h
+                    && jniEnv->IsSameObject(h->m_weakRef.get(), candidates.weakRefs[i].get())) {
+                remove(h);
+                g_cppProxiesSwept.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+namespace {
+struct CppProxyCacheState {
+    static constexpr int kShardBits = 4;
+    CppProxyCacheShard shards[1 << kShardBits];
+
+    CppProxyCacheShard & shard(const void * key) {
+        return shards[CppProxyCacheShard::hash(key) >> (64 - kShardBits)];
+    }
 
     static CppProxyCacheState & get() {
         static CppProxyCacheState st;
         return st;
     }
 };
+} // namespace
 
-/*static*/ void JniCppProxyCache::erase(void * key) {
-    CppProxyCacheState & st = CppProxyCacheState::get();
-    const std::lock_guard<std::mutex> lock(st.mtx);
-    st.m.erase(key);
+/*static*/ void JniCppProxyCache::erase(CppProxyHandleBase * handle) {
+    CppProxyCacheShard & shard = CppProxyCacheState::get().shard(handle->m_key);
+    const std::lock_guard<std::mutex> lock(shard.mtx);
+    // Handles that were never cached, or were replaced by a newer proxy, have no WeakReference.
+    if (handle->m_weakRef) {
+        shard.remove(handle);
+    }
 }
 
 /*static*/ jobject JniCppProxyCache::get(const std::shared_ptr<void> & cppObj,
                                          JNIEnv * jniEnv,
                                          const CppProxyClassInfo & proxyClass,
-                                         jobject (*factory)(const std::shared_ptr<void> &,
-                                                            JNIEnv *,
-                                                            const CppProxyClassInfo &)) {
-    CppProxyCacheState & st = CppProxyCacheState::get();
-    const std::lock_guard<std::mutex> lock(st.mtx);
-
-    auto it = st.m.find(cppObj.get());
-    if (it != st.m.end()) {
+                                         std::pair<jobject, CppProxyHandleBase *> (*factory)(
+                                             const std::shared_ptr<void> &,
+                                             JNIEnv *,
+                                             const CppProxyClassInfo &)) {
+    void * const key = cppObj.get();
+    CppProxyCacheShard & shard = CppProxyCacheState::get().shard(key);
+
+    // A new proxy is only made once we've seen that there's no live one, and only installed if
+    // the entry we saw then (null if there was none) is still the current one. Otherwise
+    // another thread raced us, and we try its proxy instead. Handles are recycled by
+    // CppProxyHandleSlab, so the same address isn't enough: as in sweep(), the entry must also
+    // still have the WeakReference we saw.
+    LocalRef<jobject> created;
+    CppProxyHandleBase * createdHandle = nullptr;
+    GlobalRef<jobject> createdWeakRef;
+    const CppProxyHandleBase * seen = nullptr;
+    LocalRef<jobject> seenWeakRef;
+
+    for (;;) {
+        CppProxyCacheShard::SweepCandidates candidates;
+        bool inserted = false;
+        {
+            const std::lock_guard<std::mutex> lock(shard.mtx);
+            CppProxyHandleBase * const current = shard.find(key);
+            if (createdHandle && (!current || (current == seen
+                    && jniEnv->IsSameObject(current->m_weakRef.get(), seenWeakRef.get())))) {
+                if (current) {
+                    // Its CppProxy is gone; the handle itself is deleted once that is noticed
+                    // on the Java side.
+                    shard.remove(current);
+                }
+                shard.insert(createdHandle, std::move(createdWeakRef));
+                shard.collect(jniEnv, candidates);
+                inserted = true;
+            } else {
+                seen = current;
+                seenWeakRef = current
+                    ? LocalRef<jobject>(jniEnv, jniEnv->NewLocalRef(current->m_weakRef.get()))
+                    : LocalRef<jobject>();
+            }
+        }
+
+        if (inserted) {
+            shard.sweep(jniEnv, candidates);
+            return created.release();
+        }
+
         // It's in the map. See if the WeakReference still points to an object.
-        if (jobject javaObj = it->second.get(jniEnv)) {
-            return javaObj;
-        } else {
-            // The WeakReference is expired, so prune it from the map eagerly.
-            st.m.erase(it);
+        if (seenWeakRef) {
+            if (jobject javaObj = JavaWeakRef::get(jniEnv, seenWeakRef.get())) {
+                return javaObj;
+            }
+        }
+
+        if (!createdHandle) {
+            const std::pair<jobject, CppProxyHandleBase *> proxy = factory(cppObj, jniEnv, proxyClass);
+            created = LocalRef<jobject>(jniEnv, proxy.first);
+            createdHandle = proxy.second;
+            createdWeakRef = JavaWeakRef::create(jniEnv, created.get());
         }
     }
+}
 
-    jobject wrapper = factory(cppObj, jniEnv, proxyClass);
+JniProxyCacheStats jniProxyCacheStats() {
+    return {
+        g_cppProxyCount.size.load(std::memory_order_relaxed),
+        g_cppProxyCount.highWater.load(std::memory_order_relaxed),
+        g_cppProxiesSwept.load(std::memory_order_relaxed),
+        g_javaProxyCount.size.load(std::memory_order_relaxed),
+        g_javaProxyCount.highWater.load(std::memory_order_relaxed),
+    };
+}
 
-    /* Make a Java WeakRef object */
-    st.m.emplace(cppObj.get(), JavaWeakRef(jniEnv, wrapper));
-    return wrapper;
+void jniDestroyCppProxyHandles(const jlong * handles, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        delete CppProxyHandleBase::fromJava(handles[i]);
+    }
 }
 
 } // namespace djinni
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_NativeRefQueue_nativeDestroyBatch(JNIEnv * jniEnv,
+                                                                                 jclass /*clazz*/,
+                                                                                 jlongArray j_refs,
+                                                                                 jint count) {
+    try {
+        // Copied out rather than pinned: the handles' destructors make JNI calls.
+        std::vector<jlong> refs(static_cast<size_t>(count));
+        jniEnv->GetLongArrayRegion(j_refs, 0, count, refs.data());
+        djinni::jniExceptionCheck(jniEnv);
+        djinni::jniDestroyCppProxyHandles(refs.data(), refs.size());
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_NativeFutureHandler_nativeComplete(JNIEnv * jniEnv,
+                                                                                  jclass /*clazz*/,
+                                                                                  jlong nativeRef,
+                                                                                  jobject j_value,
+                                                                                  jthrowable j_error) {
+    try {
+        std::unique_ptr<djinni::FutureListener> listener(
+            reinterpret_cast<djinni::FutureListener *>(static_cast<uintptr_t>(nativeRef)));
+        (*listener)(jniEnv, j_value, j_error);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_NativeBuffers_nativeRelease(JNIEnv * jniEnv,
+                                                                           jclass /*clazz*/,
+                                                                           jlong nativeRef) {
+    try {
+        delete reinterpret_cast<djinni::SharedBuffer *>(static_cast<uintptr_t>(nativeRef));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
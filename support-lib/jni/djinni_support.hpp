@@ -16,12 +16,23 @@
 
 #pragma once
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <exception>
+#include <functional>
+#include <initializer_list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <jni.h>
 
@@ -40,14 +51,77 @@
 
 namespace djinni {
 
+/*
+ * What JniOnewayQueue does with a call posted while it already holds onewayQueueDepth of them.
+ */
+enum class OnewayDropPolicy {
+    DropNewest, // discard the call being posted
+    DropOldest, // deliver it, and discard the oldest call that hasn't been delivered yet
+};
+
+/*
+ * Options for jniInit.
+ */
+struct JniInitOptions {
+    /*
+     * If true, jniGetThreadEnv attaches threads that the JVM doesn't know about yet, and
+     * detaches them again when they exit. If false, calling into Java from such a thread
+     * aborts, and native threads have to be attached by hand.
+     */
+    bool attachNativeThreads = false;
+
+    /*
+     * Attach native threads as daemon threads, so they don't keep the JVM from exiting.
+     */
+    bool attachAsDaemon = true;
+
+    /*
+     * If true, each thread remembers its JNIEnv after the first lookup. Turn this off if code
+     * outside djinni detaches threads that djinni has already been used on, since a detached
+     * thread's JNIEnv is no longer valid.
+     */
+    bool cacheThreadEnv = true;
+
+    /*
+     * If true, jniInit doesn't look up any classes, and each JniClass<C> is initialized the
+     * first time it's used instead. This saves a FindClass and a few GetMethodID/GetFieldID
+     * calls per generated type at load time, for every type the process never touches.
+     */
+    bool lazyClassInit = false;
+
+    /*
+     * The ClassLoader that lazy initialization falls back on when FindClass can't see our
+     * classes, as on threads attached from native code, which only see the system class
+     * loader. If null, jniInit uses the calling thread's context ClassLoader. Only used with
+     * lazyClassInit.
+     */
+    jobject classLoader = nullptr;
+
+    /*
+     * The most calls to `oneway` methods that may wait for the dispatcher thread at once; see
+     * JniOnewayQueue. 0 means no limit. What happens to calls beyond it is up to
+     * onewayDropPolicy; the threads making them never wait.
+     */
+    size_t onewayQueueDepth = 4096;
+    OnewayDropPolicy onewayDropPolicy = OnewayDropPolicy::DropNewest;
+
+    /*
+     * The least time between two deliveries of a `coalesce` method to the same Java object; see
+     * JniCoalescedCall. Updates made in between replace each other. 0 delivers as soon as the
+     * dispatcher thread gets to it, which is when Java has handled whatever came before.
+     */
+    std::chrono::milliseconds coalesceInterval { 0 };
+};
+
 /*
  * Global initialization and shutdown. Call these from JNI_OnLoad and JNI_OnUnload.
  */
-void jniInit(JavaVM * jvm);
+void jniInit(JavaVM * jvm, const JniInitOptions & options = JniInitOptions());
 void jniShutdown();
 
 /*
- * Get the JNIEnv for the invoking thread. Should only be called on Java-created threads.
+ * Get the JNIEnv for the invoking thread. Threads the JVM didn't create are attached on first
+ * use if JniInitOptions::attachNativeThreads is set, and abort otherwise.
  */
 JNIEnv * jniGetThreadEnv();
 
@@ -58,10 +132,37 @@ JNIEnv * jniGetThreadEnv();
  * reference to a global reference, and the destructor deletes the local ref.
  *
  * A LocalRef<T> should be constructed with a new local reference. The local reference will
- * be deleted when the LocalRef is deleted.
+ * be deleted when the LocalRef is deleted, using the JNIEnv it was constructed with if any.
  */
 struct GlobalRefDeleter { void operator() (jobject globalRef) noexcept; };
 
+/*
+ * Global refs released on threads that aren't attached to the JVM can't be deleted there, and
+ * GlobalRefDeleter never attaches a thread just for that. It pushes them onto this lock-free
+ * list instead, and the next attached thread that enters djinni deletes them all in one go:
+ * every generated JNI function, and every jniGetThreadEnv() call, checks for them.
+ */
+class JniDeferredGlobalRefs {
+public:
+    static void push(jobject globalRef) noexcept;
+
+    static void drain(JNIEnv * env) noexcept {
+        if (s_head.load(std::memory_order_relaxed)) {
+            drainSlow(env);
+        }
+    }
+
+private:
+    struct Node {
+        jobject ref;
+        Node * next;
+    };
+    static std::atomic<Node *> s_head;
+    static void drainSlow(JNIEnv * env) noexcept;
+
+    JniDeferredGlobalRefs() = delete;
+};
+
 template <typename PointerType>
 class GlobalRef : public std::unique_ptr<typename std::remove_pointer<PointerType>::type,
                                          GlobalRefDeleter> {
@@ -71,6 +172,7 @@ public:
         : std::unique_ptr<typename std::remove_pointer<PointerType>::type, ::djinni::GlobalRefDeleter>(
             std::move(obj)
         ) {}
+    GlobalRef & operator=(GlobalRef && obj) = default;
     GlobalRef(JNIEnv * env, PointerType localRef)
         : std::unique_ptr<typename std::remove_pointer<PointerType>::type, ::djinni::GlobalRefDeleter>(
             static_cast<PointerType>(env->NewGlobalRef(localRef)),
@@ -78,16 +180,21 @@ public:
         ) {}
 };
 
-struct LocalRefDeleter { void operator() (jobject localRef) noexcept; };
+struct LocalRefDeleter {
+    LocalRefDeleter() = default;
+    explicit LocalRefDeleter(JNIEnv * e) noexcept : env(e) {}
+    JNIEnv * env = nullptr; // if null, looked up when the reference is deleted
+    void operator() (jobject localRef) noexcept;
+};
 
 template <typename PointerType>
 class LocalRef : public std::unique_ptr<typename std::remove_pointer<PointerType>::type,
                                         LocalRefDeleter> {
 public:
     LocalRef() {}
-    LocalRef(JNIEnv * /*env*/, PointerType localRef)
+    LocalRef(JNIEnv * env, PointerType localRef)
         : std::unique_ptr<typename std::remove_pointer<PointerType>::type, ::djinni::LocalRefDeleter>(
-            localRef) {}
+            localRef, ::djinni::LocalRefDeleter{env}) {}
     explicit LocalRef(PointerType localRef)
         : std::unique_ptr<typename std::remove_pointer<PointerType>::type, LocalRefDeleter>(
             localRef) {}
@@ -207,12 +314,33 @@ private:
     const Registration reg;
     JniClassInitializer(const std::function<void()> & init) : init(init), reg(this, this) {}
     template <class C> friend class JniClass;
-    friend void jniInit(JavaVM *);
+    friend void jniInit(JavaVM *, const JniInitOptions &);
+};
+
+/*
+ * A table of native methods for one Java class, bound with RegisterNatives by jniInit, in
+ * either class initialization mode. Generated code defines these as statics when run with
+ * --jni-register-natives, so the functions themselves needn't be exported from the library.
+ */
+class JniNativeMethods {
+public:
+    template <size_t N>
+    JniNativeMethods(const char * className, const JNINativeMethod (&methods)[N])
+        : m_className(className), m_methods(methods), m_count(static_cast<jint>(N)), m_reg(this, this) {}
+
+private:
+    using Registration = static_registration<void *, const JniNativeMethods>;
+    const char * const m_className;
+    const JNINativeMethod * const m_methods;
+    const jint m_count;
+    const Registration m_reg;
+    friend void jniInit(JavaVM *, const JniInitOptions &);
 };
 
 /*
  * Each instantiation of this template produces a singleton object of type C which
- * will be initialized by djinni::jniInit(). For example:
+ * will be initialized by djinni::jniInit(), or on first use if JniInitOptions::lazyClassInit
+ * is set. For example:
  *
  * struct JavaFooInfo {
  *     jmethodID foo;
@@ -233,18 +361,29 @@ class JniClass {
 public:
     static const C & get() {
         (void)s_initializer; // ensure that initializer is actually instantiated
-        assert(s_singleton);
-        return *s_singleton;
+        // Once initialized, this is a single load.
+        if (const C * singleton = s_singleton.load(std::memory_order_acquire)) {
+            return *singleton;
+        }
+        allocate();
+        return *s_singleton.load(std::memory_order_acquire);
     }
 
 private:
     static const JniClassInitializer s_initializer;
-    static std::unique_ptr<C> s_singleton;
+    static std::atomic<const C *> s_singleton;
+    static std::unique_ptr<C> s_owner;
+    static std::once_flag s_once;
 
+    // Called by jniInit in eager mode, and by the first get() in lazy mode. If C's
+    // constructor throws, the next call tries again.
     static void allocate() {
-        // We can't use make_unique here, because C will have a private constructor and
-        // list JniClass as a friend; so we have to allocate it by hand.
-        s_singleton = std::unique_ptr<C>(new C());
+        std::call_once(s_once, [] {
+            // We can't use make_unique here, because C will have a private constructor and
+            // list JniClass as a friend; so we have to allocate it by hand.
+            s_owner = std::unique_ptr<C>(new C());
+            s_singleton.store(s_owner.get(), std::memory_order_release);
+        });
     }
 };
 
@@ -252,7 +391,13 @@ template <class C>
 const JniClassInitializer JniClass<C>::s_initializer ( allocate );
 
 template <class C>
-std::unique_ptr<C> JniClass<C>::s_singleton;
+std::atomic<const C *> JniClass<C>::s_singleton { nullptr };
+
+template <class C>
+std::unique_ptr<C> JniClass<C>::s_owner;
+
+template <class C>
+std::once_flag JniClass<C>::s_once;
 
 /*
  * Exception-checking helpers. These will throw if an exception is pending.
@@ -287,24 +432,30 @@ jfieldID jniGetFieldID(jclass clazz, const char * name, const char * sig);
  *
  * As long as the C++ FooListener has references, the Java FooListener is kept alive.
  *
- * We use a custom unordered_map with Java objects (jobject) as keys, and JNI object
- * identity and hashing functions. This means that as long as a key is in the map,
- * we must have some other GlobalRef keeping it alive. To ensure safety, the Entry
- * destructor removes *itself* from the map - destruction order guarantees that this
- * will happen before the contained global reference becomes invalid (by destruction of
- * the GlobalRefGuard).
+ * The cache is a sharded hash table with Java objects (jobject) as keys, compared by JNI
+ * object identity. Keys are hashed by System.identityHashCode, computed once per lookup
+ * before any shard lock is taken. Generated Java interfaces also have a field that caches
+ * the identity hash, so after the first conversion of an object, hashing it is a plain field
+ * read rather than a call into Java. As long as a key is in the map, we must have some other
+ * GlobalRef keeping it alive. To ensure safety, the Entry destructor removes *itself* from
+ * the map - destruction order guarantees that this will happen before the contained global
+ * reference becomes invalid (by destruction of the GlobalRefGuard).
  */
 
+class JavaProxyCacheEntry;
+
 /*
  * Look up an entry in the global JNI wrapper cache. If none is found, create one with factory,
  * save it, and return it.
  *
- * The contract of `factory` is: The parameter to factory is a local ref. The factory returns
- * a shared_ptr to the object (JniImplFooListener, in the diagram above), as well as the
- * jobject *global* ref contained inside.
+ * identityHashField, if not null, is an int field of obj's class used to cache its identity
+ * hash code. The contract of `factory` is: The parameter to factory is a local ref. The
+ * factory returns a shared_ptr to the object (JniImplFooListener, in the diagram above), as
+ * well as the same object as a JavaProxyCacheEntry.
  */
-std::shared_ptr<void> javaProxyCacheLookup(jobject obj, std::pair<std::shared_ptr<void>,
-                                                                  jobject>(*factory)(jobject));
+std::shared_ptr<void> javaProxyCacheLookup(jobject obj, jfieldID identityHashField,
+                                           std::pair<std::shared_ptr<void>,
+                                                     JavaProxyCacheEntry *>(*factory)(jobject));
 
 class JavaProxyCacheEntry {
 public:
@@ -322,7 +473,11 @@ protected:
     JavaProxyCacheEntry & operator=(const JavaProxyCacheEntry & other) = delete;
 
 private:
+    friend std::shared_ptr<void> javaProxyCacheLookup(
+        jobject, jfieldID, std::pair<std::shared_ptr<void>, JavaProxyCacheEntry *>(*)(jobject));
+
     const GlobalRef<jobject> m_globalRef;
+    jint m_identityHash = 0; // set by javaProxyCacheLookup
 };
 
 template <class T>
@@ -330,20 +485,21 @@ class JavaProxyCache {
 public:
     using Entry = JavaProxyCacheEntry;
 
-    static std::pair<std::shared_ptr<void>, jobject> factory(jobject obj) {
+    static std::pair<std::shared_ptr<void>, JavaProxyCacheEntry *> factory(jobject obj) {
         std::shared_ptr<T> ret = std::make_shared<T>(obj);
-        return { ret, ret->getGlobalRef() };
+        return { ret, ret.get() };
     }
 
     /*
      * Check whether a wrapped T exists for obj. If one is found, return it; if not,
-     * construct a new one with obj, save it, and return it.
+     * construct a new one with obj, save it, and return it. See javaProxyCacheLookup for
+     * identityHashField.
      */
-    static std::shared_ptr<T> get(jobject obj) {
+    static std::shared_ptr<T> get(jobject obj, jfieldID identityHashField = nullptr) {
         static_assert(std::is_base_of<JavaProxyCacheEntry, T>::value,
             "JavaProxyCache can only be used with T if T derives from Entry<T>");
 
-        return std::static_pointer_cast<T>(javaProxyCacheLookup(obj, &factory));
+        return std::static_pointer_cast<T>(javaProxyCacheLookup(obj, identityHashField, &factory));
     }
 };
 
@@ -369,6 +525,10 @@ public:
  * We don't use JNI WeakGlobalRef objects, because they last longer than is safe - a
  * WeakGlobalRef can still be upgraded to a strong reference even during finalization, which
  * leads to use-after-free. Java WeakRefs provide the right lifetime guarantee.
+ *
+ * The map is sharded by C++ object address. A shard's lock is only held for the map operations
+ * themselves: WeakReference.get(), and creating new CppProxy and WeakReference objects, all
+ * call into Java and happen outside of it.
  */
 
 /*
@@ -391,6 +551,8 @@ struct CppProxyClassInfo {
     explicit operator bool() const { return bool(clazz); }
 };
 
+class CppProxyHandleBase;
+
 /*
  * Proxy cache implementation. These functions are used by CppProxyHandle::~CppProxyHandle()
  * and JniInterface::_toJava, respectively. They're declared in a separate class to avoid
@@ -404,33 +566,98 @@ struct CppProxyClassInfo {
 class JniCppProxyCache {
 private:
     template <class T> friend class CppProxyHandle;
-    static void erase(void * key);
+    // Removes handle from the cache, unless a newer handle has already replaced it.
+    static void erase(CppProxyHandleBase * handle);
 
     template <class I, class Self> friend class JniInterface;
+    // factory returns a new CppProxy (as a local ref) and the CppProxyHandle inside it.
     static jobject get(const std::shared_ptr<void> & cppObj,
                        JNIEnv * jniEnv,
                        const CppProxyClassInfo & proxyClass,
-                       jobject (*factory)(const std::shared_ptr<void> &,
-                                          JNIEnv *,
-                                          const CppProxyClassInfo &));
+                       std::pair<jobject, CppProxyHandleBase *> (*factory)(
+                           const std::shared_ptr<void> &,
+                           JNIEnv *,
+                           const CppProxyClassInfo &));
 
     /* This "class" is basically a namespace, to make clear that get() and erase() should only
      * be used by the helper infrastructure below. */
     JniCppProxyCache() = delete;
 };
 
+// One shard of the proxy cache: a hash table chained through CppProxyHandleBase::m_next.
+struct CppProxyCacheShard;
+
+/*
+ * The jlong handle held by a CppProxy points to this base, so that handles can be deleted
+ * without knowing their type: see jniDestroyCppProxyHandles().
+ *
+ * A handle is also its own entry in the proxy cache, rather than being pointed to by a
+ * separately allocated map node. Every CppProxyHandle<T> has the same size, and they are all
+ * allocated from one slab in djinni_support.cpp.
+ */
+class CppProxyHandleBase {
+public:
+    virtual ~CppProxyHandleBase() = default;
+
+    static void * operator new(size_t size);
+    static void operator delete(void * p, size_t size) noexcept;
+
+    static jlong toJava(CppProxyHandleBase * handle) {
+        return static_cast<jlong>(reinterpret_cast<uintptr_t>(handle));
+    }
+    static CppProxyHandleBase * fromJava(jlong handle) {
+        assert(handle);
+        assert(handle > 4096);
+        return reinterpret_cast<CppProxyHandleBase *>(static_cast<uintptr_t>(handle));
+    }
+
+protected:
+    explicit CppProxyHandleBase(void * key) : m_key(key) {}
+
+private:
+    friend class JniCppProxyCache;
+    friend struct CppProxyCacheShard;
+
+    // Cache bookkeeping, guarded by the lock of the shard that m_key belongs to.
+    void * const m_key;                     // the C++ object
+    CppProxyHandleBase * m_next = nullptr;  // next entry in the same bucket
+    GlobalRef<jobject> m_weakRef;           // WeakReference to the CppProxy; set while cached
+};
+
+/*
+ * Delete count CppProxy handles at once. Used by CppProxy classes generated with
+ * --java-batched-release, whose handles are freed by com.dropbox.djinni.NativeRefQueue.
+ */
+void jniDestroyCppProxyHandles(const jlong * handles, size_t count);
+
+/*
+ * Sizes of the two proxy caches, for monitoring. A high-water mark is the largest size seen
+ * since the library was loaded.
+ *
+ * CppProxy entries whose Java object was collected, but whose handle hasn't been released yet
+ * (finalization can lag behind), are removed by an incremental sweep: every new entry pays for
+ * checking one bucket of its shard. cppProxiesSwept counts the entries removed that way.
+ */
+struct JniProxyCacheStats {
+    size_t cppProxies;
+    size_t cppProxiesHighWater;
+    size_t cppProxiesSwept;
+    size_t javaProxies;
+    size_t javaProxiesHighWater;
+};
+JniProxyCacheStats jniProxyCacheStats();
+
 template <class T>
-class CppProxyHandle {
+class CppProxyHandle final : public CppProxyHandleBase {
 public:
-    CppProxyHandle(std::shared_ptr<T> obj) : m_obj(move(obj)) {}
-    ~CppProxyHandle() {
-        JniCppProxyCache::erase(m_obj.get());
+    CppProxyHandle(std::shared_ptr<T> obj) : CppProxyHandleBase(obj.get()), m_obj(move(obj)) {}
+    ~CppProxyHandle() override {
+        // Before m_obj goes away, so that no other thread can find this entry by a reused address.
+        JniCppProxyCache::erase(this);
     }
 
     static const std::shared_ptr<T> & get(jlong handle) {
-        assert(handle);
-        assert(handle > 4096);
-        const auto & ret = reinterpret_cast<const CppProxyHandle<T> *>(handle)->m_obj;
+        const auto & ret = static_cast<const CppProxyHandle<T> *>(fromJava(handle))->m_obj;
         assert(ret);
         return ret;
     }
@@ -487,9 +714,10 @@ public:
         }
 
         // Case 2 - already a Java proxy; we just need to pull the C++ impl out. (This case
-        // is only possible if we were constructed with a cppProxyClassName parameter.)
-        if (m_cppProxyClass
-                && jniEnv->IsSameObject(jniEnv->GetObjectClass(j), m_cppProxyClass.clazz.get())) {
+        // is only possible if we were constructed with a cppProxyClassName parameter.) CppProxy
+        // classes are final, so this is an exact class check, in a single JNI call that
+        // doesn't create a local reference.
+        if (m_cppProxyClass && jniEnv->IsInstanceOf(j, m_cppProxyClass.clazz.get())) {
             jlong handle = jniEnv->GetLongField(j, m_cppProxyClass.idField);
             jniExceptionCheck(jniEnv);
             return CppProxyHandle<I>::get(handle);
@@ -510,11 +738,19 @@ private:
     /*
      * Helpers for _toJava above. The possibility that an object is already a C++-side proxy
      * only exists if the code generator emitted one (if Self::JavaProxy exists).
+     *
+     * Generated JavaProxy classes are final, so comparing the dynamic type is enough. That is
+     * a type_info comparison, where a failing dynamic_cast would walk the object's whole
+     * class hierarchy, which is the common case of passing a C++ implementation to Java.
      */
     template <typename S, typename = typename S::JavaProxy>
     jobject _unwrapJavaProxy(const std::shared_ptr<I> * c) const {
-        if (auto proxy = dynamic_cast<typename S::JavaProxy *>(c->get())) {
-            return proxy->getGlobalRef();
+        using JavaProxy = typename S::JavaProxy;
+#if __cplusplus >= 201402L
+        static_assert(std::is_final<JavaProxy>::value, "JavaProxy classes must be final");
+#endif
+        if (typeid(**c) == typeid(JavaProxy)) {
+            return static_cast<JavaProxy *>(c->get())->getGlobalRef();
         } else {
             return nullptr;
         }
@@ -527,21 +763,20 @@ private:
 
     /*
      * Helper for _toJava above: given a C++ object, allocate a CppProxy on the Java side for
-     * it. This is actually called by jniCppProxyCacheGet, which holds a lock on the global
-     * C++-to-Java proxy map object.
+     * it. This is actually called by JniCppProxyCache::get, outside of any lock.
      */
-    static jobject newCppProxy(const std::shared_ptr<void> & cppObj,
-                               JNIEnv * jniEnv,
-                               const CppProxyClassInfo & proxyClass) {
+    static std::pair<jobject, CppProxyHandleBase *> newCppProxy(
+            const std::shared_ptr<void> & cppObj,
+            JNIEnv * jniEnv,
+            const CppProxyClassInfo & proxyClass) {
         std::unique_ptr<CppProxyHandle<I>> to_encapsulate(
                 new CppProxyHandle<I>(std::static_pointer_cast<I>(cppObj)));
-        jlong handle = static_cast<jlong>(reinterpret_cast<uintptr_t>(to_encapsulate.get()));
+        jlong handle = CppProxyHandleBase::toJava(to_encapsulate.get());
         jobject cppProxy = jniEnv->NewObject(proxyClass.clazz.get(),
                                              proxyClass.constructor,
                                              handle);
         jniExceptionCheck(jniEnv);
-        to_encapsulate.release();
-        return cppProxy;
+        return { cppProxy, to_encapsulate.release() };
     }
 
     /*
@@ -550,7 +785,7 @@ private:
      */
     template <typename S, typename = typename S::JavaProxy>
     std::shared_ptr<I> _getJavaProxy(jobject j) const {
-        return JavaProxyCache<typename S::JavaProxy>::get(j);
+        return JavaProxyCache<typename S::JavaProxy>::get(j, _identityHashField<S>(nullptr));
     }
 
     template <typename S>
@@ -559,6 +794,20 @@ private:
         return nullptr;
     }
 
+    /*
+     * The Java field caching the identity hash of objects passed to _getJavaProxy, if the
+     * code generator emitted one (if Self::field_djinniIdentityHash exists).
+     */
+    template <typename S>
+    jfieldID _identityHashField(decltype(&S::field_djinniIdentityHash)) const {
+        return static_cast<const S &>(*this).field_djinniIdentityHash;
+    }
+
+    template <typename S>
+    jfieldID _identityHashField(...) const {
+        return nullptr;
+    }
+
     const CppProxyClassInfo m_cppProxyClass;
 };
 
@@ -624,13 +873,265 @@ protected:
     JniEnum(const std::string & name);
 
 private:
+    // Helper used by the constructor: GlobalRefs to all constants, indexed by ordinal.
+    std::vector<GlobalRef<jobject>> loadConstants(const std::string & name) const;
+
     const GlobalRef<jclass> m_clazz;
-    const jmethodID m_staticmethValues;
     const jmethodID m_methOrdinal;
+    // java.lang.Enum's ordinal field, if this JVM has one; otherwise we call ordinal().
+    const jfieldID m_fieldOrdinal;
+    const std::vector<GlobalRef<jobject>> m_constants;
+};
+
+/*
+ * Bulk collection transfer, used by the List, Set and Map marshallers in Marshal.hpp.
+ *
+ * Collections with at least kBulkCollectionThreshold elements are flattened to and from an
+ * Object[] by a single call into com.dropbox.djinni.BulkCollections (support-lib/java), after
+ * which each element only costs a Get/SetObjectArrayElement instead of a Java method call.
+ * Maps are flattened to alternating keys and values. If the Java class isn't on the class
+ * path, jniBulkCollectionsAvailable() returns false and the marshallers use the element by
+ * element path for everything.
+ */
+enum class BulkCollection { List, Set, Map };
+
+constexpr jint kBulkCollectionThreshold = 16;
+
+bool jniBulkCollectionsAvailable();
+LocalRef<jobjectArray> jniCollectionToArray(JNIEnv * env, BulkCollection kind, jobject collection);
+LocalRef<jobject> jniCollectionFromArray(JNIEnv * env, BulkCollection kind, jobjectArray array);
+
+/*
+ * Initial capacity of a java.util.HashMap or HashSet that will hold size elements without
+ * rehashing, given the default load factor of 0.75.
+ */
+inline jint jniHashCapacity(size_t size) {
+    return size < 3 ? static_cast<jint>(size + 1) : static_cast<jint>(size / 0.75 + 1.0);
+}
+
+/*
+ * Base class of the generated marshallers for records, which adds the bulk conversions that
+ * the collection marshallers in Marshal.hpp use on the Object[] of a bulk transfer.
+ *
+ * Converting records one at a time costs a JniClass lookup and a local frame per record. Here
+ * the class data is looked up once per range, and the local refs of toCppRange are released
+ * by one frame per kRecordRangeChunk records. fromCppRange releases its refs as it goes, so it
+ * only needs EnsureLocalCapacity for the refs of a single record.
+ *
+ * Self provides kLocalRefsPerRecord, the most local refs one conversion holds at once, and
+ * overloads of toCpp and fromCpp that take its class data and push no local frame.
+ */
+constexpr jint kRecordRangeChunk = 64;
+
+template <class Self>
+class JniRecord {
+public:
+    /*
+     * Converts the count records at j[offset], j[offset + stride], ... and passes each
+     * resulting C++ value to sink.
+     */
+    template <class Sink>
+    static void toCppRange(JNIEnv * jniEnv, jobjectArray j, jint offset, jint stride, jint count,
+                           Sink && sink) {
+        const auto & data = JniClass<Self>::get();
+        for (jint begin = 0; begin < count; begin += kRecordRangeChunk) {
+            const jint end = count - begin > kRecordRangeChunk ? begin + kRecordRangeChunk : count;
+            JniLocalScope jscope(jniEnv, (end - begin) * Self::kLocalRefsPerRecord);
+            for (jint i = begin; i < end; ++i) {
+                const jobject je = jniEnv->GetObjectArrayElement(j, offset + i * stride);
+                sink(Self::toCpp(jniEnv, je, data));
+            }
+        }
+    }
+
+    /*
+     * Converts count C++ values, each returned by a call to source(), and stores them at
+     * j[offset], j[offset + stride], ...
+     */
+    template <class Source>
+    static void fromCppRange(JNIEnv * jniEnv, jint count, Source && source, jobjectArray j,
+                             jint offset, jint stride) {
+        const auto & data = JniClass<Self>::get();
+        if (jniEnv->EnsureLocalCapacity(Self::kLocalRefsPerRecord) != 0) {
+            jniExceptionCheck(jniEnv);
+        }
+        for (jint i = 0; i < count; ++i) {
+            const auto je = Self::fromCpp(jniEnv, source(), data);
+            jniEnv->SetObjectArrayElement(j, offset + i * stride, je.get());
+        }
+    }
+};
+
+template <class T>
+using IsJniRecord = std::is_base_of<JniRecord<T>, T>;
+
+/*
+ * Base class of the generated marshallers for records whose fields are all primitives. Lists
+ * of these cross JNI as one primitive array per field, in a single call to static helpers that
+ * the Java generator adds to the record class, instead of one Java object per element. Self
+ * provides toCppList and fromCppList, which the List marshaller in Marshal.hpp calls.
+ */
+template <class Self>
+class JniPrimitiveRecord : public JniRecord<Self> {};
+
+template <class T>
+using IsJniPrimitiveRecord = std::is_base_of<JniPrimitiveRecord<T>, T>;
+
+/*
+ * Return slots for records that generated CppProxy methods pass as separate primitives (see
+ * --java-scalar-records). Instead of building a Java object with NewObject, the native method
+ * stores each field, widened to a jlong, in a long[] that the Java side gets from
+ * com.dropbox.djinni.ScalarSlot (support-lib/java) and reads back after the call. Floating
+ * point fields are stored as their raw bits.
+ */
+inline jlong jniScalarBits(jboolean v) { return v ? 1 : 0; }
+inline jlong jniScalarBits(jbyte v) { return v; }
+inline jlong jniScalarBits(jshort v) { return v; }
+inline jlong jniScalarBits(jint v) { return v; }
+inline jlong jniScalarBits(jlong v) { return v; }
+inline jlong jniScalarBits(jfloat v) {
+    jint bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+inline jlong jniScalarBits(jdouble v) {
+    jlong bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+void jniSetScalarSlot(JNIEnv * env, jlongArray slot, std::initializer_list<jlong> values);
+
+/*
+ * Conversions for the IDL "buffer" type, used by the Buffer marshaller in Marshal.hpp. Neither
+ * copies the bytes.
+ *
+ * jniBufferToCpp() takes the bytes of a direct java.nio.ByteBuffer from its position to its
+ * limit, and keeps it alive from C++ through a global ref until the last copy of the returned
+ * SharedBuffer goes away. jniBufferFromCpp()
+ * wraps the SharedBuffer's memory in a new direct ByteBuffer, and keeps the memory alive until
+ * that ByteBuffer is collected or passed to NativeBuffers.release() (support-lib/java).
+ */
+class SharedBuffer;
+
+SharedBuffer jniBufferToCpp(JNIEnv * env, jobject buffer);
+LocalRef<jobject> jniBufferFromCpp(JNIEnv * env, const SharedBuffer & buffer);
+
+/*
+ * java.util.concurrent.CompletableFuture support for the Future marshaller in Marshal.hpp.
+ *
+ * jniCompleteFuture() completes future with value. jniFailFutureFromCurrent() must be called in
+ * a catch block, and completes future with the current C++ exception translated as by
+ * jniSetPendingFromCurrent(); it leaves no exception pending.
+ *
+ * jniListenToFuture() calls listener once future completes, on the completing thread, with
+ * either its value or the exception it failed with. It goes through
+ * com.dropbox.djinni.NativeFutureHandler (support-lib/java), and never blocks. If the listener
+ * can't be registered, it is called right away with the exception that prevented it.
+ */
+LocalRef<jobject> jniNewCompletableFuture(JNIEnv * env);
+void jniCompleteFuture(JNIEnv * env, jobject future, jobject value);
+void jniFailFutureFromCurrent(JNIEnv * env, jobject future) noexcept;
+
+using FutureListener = std::function<void(JNIEnv * env, jobject value, jthrowable error)>;
+void jniListenToFuture(JNIEnv * env, jobject future, FutureListener listener);
+
+/*
+ * Delivers calls to `oneway` and `coalesce` methods of Java-implemented interfaces.
+ *
+ * The generated JavaProxy copies the C++ arguments into a call and posts it here instead of
+ * calling into Java, so the calling thread never touches the JVM and needn't be attached. Calls
+ * are pushed onto a lock-free list, which one dispatcher thread (started, and attached, by the
+ * first post) takes whole: it converts the arguments and makes the calls back to back, in the
+ * order each thread posted them. A producer only takes a lock to wake the dispatcher when the
+ * list was empty.
+ *
+ * The queue is bounded by JniInitOptions::onewayQueueDepth. Nothing reports back to the caller:
+ * a call that throws in Java has its exception printed (ExceptionDescribe) and cleared.
+ */
+class JniOnewayQueue {
+public:
+    using Call = std::function<void(JNIEnv * env)>;
+
+    // Returns false if call was dropped under OnewayDropPolicy::DropNewest, or out of memory.
+    static bool post(Call call) noexcept;
+
+    // Like post(), but call isn't made before due, and doesn't count against onewayQueueDepth,
+    // so it's only dropped if memory runs out. For JniCoalescedCall, which has at most one call
+    // waiting at a time.
+    static bool postAt(std::chrono::steady_clock::time_point due, Call call) noexcept;
+
+    // Blocks until every call this thread posted earlier has been delivered, or dropped. Calls
+    // from postAt() that aren't due yet aren't waited for. Must not be called from a oneway
+    // method, which would wait for itself.
+    static void flush();
+
+    // Calls discarded so far, under either policy.
+    static uint64_t droppedCount() noexcept;
+
+    // JniInitOptions::coalesceInterval.
+    static std::chrono::steady_clock::duration coalesceInterval() noexcept;
+
+private:
+    JniOnewayQueue() = delete;
+};
+
+/*
+ * The arguments of a `coalesce` method of a Java-implemented interface, waiting to be delivered.
+ *
+ * The generated JavaProxy has one per coalesce method. Each call put()s its arguments in place of
+ * any that haven't been delivered yet, with a single atomic exchange, so callers never wait for
+ * each other or for Java. Only the call that finds nothing waiting schedules a delivery; when the
+ * dispatcher thread runs it, it take()s whatever is newest by then. However fast updates come,
+ * Java is called at most once per JniInitOptions::coalesceInterval, and never has more than one
+ * call to a method queued up, so marshalling is only done for updates that are delivered.
+ */
+template <class... Args>
+class JniCoalescedCall {
+public:
+    using Values = std::tuple<Args...>;
+
+    JniCoalescedCall() = default;
+    JniCoalescedCall(const JniCoalescedCall &) = delete;
+    JniCoalescedCall & operator=(const JniCoalescedCall &) = delete;
+    ~JniCoalescedCall() { delete m_pending.load(std::memory_order_relaxed); }
+
+    // Makes these the arguments to deliver. Returns true if nothing was waiting before, in which
+    // case the caller must schedule() the delivery.
+    template <class... T>
+    bool put(T &&... args) {
+        Values * const replaced = m_pending.exchange(new Values(std::forward<T>(args)...),
+                                                     std::memory_order_acq_rel);
+        delete replaced;
+        return replaced == nullptr;
+    }
+
+    // Posts call, which must take() and deliver the arguments, to the dispatcher thread, to run
+    // no sooner than coalesceInterval after the last delivery.
+    void schedule(JniOnewayQueue::Call call) {
+        const auto due = std::chrono::steady_clock::time_point(
+            std::chrono::steady_clock::duration(m_nextDue.load(std::memory_order_relaxed)));
+        if (!JniOnewayQueue::postAt(due, std::move(call))) {
+            // Nothing will take these now, so let the next put() schedule again.
+            delete m_pending.exchange(nullptr, std::memory_order_acquire);
+        }
+    }
+
+    // Takes the newest arguments, leaving nothing waiting.
+    std::unique_ptr<Values> take() {
+        const auto next = std::chrono::steady_clock::now() + JniOnewayQueue::coalesceInterval();
+        m_nextDue.store(next.time_since_epoch().count(), std::memory_order_relaxed);
+        return std::unique_ptr<Values>(m_pending.exchange(nullptr, std::memory_order_acquire));
+    }
+
+private:
+    std::atomic<Values *> m_pending { nullptr };
+    // When the next delivery may start, in steady_clock ticks.
+    std::atomic<std::chrono::steady_clock::rep> m_nextDue { 0 };
 };
 
-#define DJINNI_FUNCTION_PROLOGUE0(env_)
-#define DJINNI_FUNCTION_PROLOGUE1(env_, arg1_)
+#define DJINNI_FUNCTION_PROLOGUE0(env_) ::djinni::JniDeferredGlobalRefs::drain(env_)
+#define DJINNI_FUNCTION_PROLOGUE1(env_, arg1_) ::djinni::JniDeferredGlobalRefs::drain(env_)
 
 /*
  * Helper for JNI_TRANSLATE_EXCEPTIONS_RETURN.
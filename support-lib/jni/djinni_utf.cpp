@@ -0,0 +1,606 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "djinni_utf.hpp"
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+#  define DJINNI_UTF_SSE2 1
+#  include <emmintrin.h>
+// AVX2 needs per-function target attributes and __builtin_cpu_supports for dispatch.
+#  if defined(__GNUC__) || defined(__clang__)
+#    define DJINNI_UTF_AVX2 1
+#    include <immintrin.h>
+#  endif
+#endif
+
+namespace djinni {
+
+/*
+ * UTF-8 and UTF-16 conversion functions from miniutf: https://github.com/dropbox/miniutf
+ *
+ * These are kept as they were so that the reference transcoder below is exactly the
+ * implementation djinni has always shipped.
+ */
+
+struct offset_pt {
+    int offset;
+    char32_t pt;
+};
+
+static constexpr const offset_pt invalid_pt = { -1, 0 };
+
+/*
+ * Decode a codepoint starting at str[i], and return the number of code units (bytes, for
+ * UTF-8) consumed and the result. If no valid codepoint is at str[i], return invalid_pt.
+ */
+static offset_pt utf8_decode_check(const std::string & str, std::string::size_type i) {
+    uint32_t b0, b1, b2, b3;
+
+    b0 = static_cast<unsigned char>(str[i]);
+
+    if (b0 < 0x80) {
+        // 1-byte character
+        return { 1, b0 };
+    } else if (b0 < 0xC0) {
+        // Unexpected continuation byte
+        return invalid_pt;
+    } else if (b0 < 0xE0) {
+        // 2-byte character
+        if (((b1 = str[i+1]) & 0xC0) != 0x80)
+            return invalid_pt;
+
+        char32_t pt = (b0 & 0x1F) << 6 | (b1 & 0x3F);
+        if (pt < 0x80)
+            return invalid_pt;
+
+        return { 2, pt };
+    } else if (b0 < 0xF0) {
+        // 3-byte character
+        if (((b1 = str[i+1]) & 0xC0) != 0x80)
+            return invalid_pt;
+        if (((b2 = str[i+2]) & 0xC0) != 0x80)
+            return invalid_pt;
+
+        char32_t pt = (b0 & 0x0F) << 12 | (b1 & 0x3F) << 6 | (b2 & 0x3F);
+        if (pt < 0x800)
+            return invalid_pt;
+
+        return { 3, pt };
+    } else if (b0 < 0xF8) {
+        // 4-byte character
+        if (((b1 = str[i+1]) & 0xC0) != 0x80)
+            return invalid_pt;
+        if (((b2 = str[i+2]) & 0xC0) != 0x80)
+            return invalid_pt;
+        if (((b3 = str[i+3]) & 0xC0) != 0x80)
+            return invalid_pt;
+
+        char32_t pt = (b0 & 0x0F) << 18 | (b1 & 0x3F) << 12
+                    | (b2 & 0x3F) << 6  | (b3 & 0x3F);
+        if (pt < 0x10000 || pt >= 0x110000)
+            return invalid_pt;
+
+        return { 4, pt };
+    } else {
+        // Codepoint out of range
+        return invalid_pt;
+    }
+}
+
+static char32_t utf8_decode(const std::string & str, std::string::size_type & i) {
+    offset_pt res = utf8_decode_check(str, i);
+    if (res.offset < 0) {
+        i += 1;
+        return 0xFFFD;
+    } else {
+        i += res.offset;
+        return res.pt;
+    }
+}
+
+static void utf16_encode(char32_t pt, std::u16string & out) {
+    if (pt < 0x10000) {
+        out += static_cast<char16_t>(pt);
+    } else if (pt < 0x110000) {
+        out += { static_cast<char16_t>(((pt - 0x10000) >> 10) + 0xD800),
+                 static_cast<char16_t>((pt & 0x3FF) + 0xDC00) };
+    } else {
+        out += 0xFFFD;
+    }
+}
+
+// UTF-16 decode helpers.
+static inline bool is_high_surrogate(char16_t c) { return (c >= 0xD800) && (c < 0xDC00); }
+static inline bool is_low_surrogate(char16_t c)  { return (c >= 0xDC00) && (c < 0xE000); }
+
+/*
+ * Like utf8_decode_check, but for UTF-16.
+ */
+static offset_pt utf16_decode_check(const std::u16string & str, std::u16string::size_type i) {
+    if (is_high_surrogate(str[i]) && is_low_surrogate(str[i+1])) {
+        // High surrogate followed by low surrogate
+        char32_t pt = (((str[i] - 0xD800) << 10) | (str[i+1] - 0xDC00)) + 0x10000;
+        return { 2, pt };
+    } else if (is_high_surrogate(str[i]) || is_low_surrogate(str[i])) {
+        // High surrogate *not* followed by low surrogate, or unpaired low surrogate
+        return invalid_pt;
+    } else {
+        return { 1, str[i] };
+    }
+}
+
+static char32_t utf16_decode(const std::u16string & str, std::u16string::size_type & i) {
+    offset_pt res = utf16_decode_check(str, i);
+    if (res.offset < 0) {
+        i += 1;
+        return 0xFFFD;
+    } else {
+        i += res.offset;
+        return res.pt;
+    }
+}
+
+static void utf8_encode(char32_t pt, std::string & out) {
+    if (pt < 0x80) {
+        out += static_cast<char>(pt);
+    } else if (pt < 0x800) {
+        out += { static_cast<char>((pt >> 6)   | 0xC0),
+                 static_cast<char>((pt & 0x3F) | 0x80) };
+    } else if (pt < 0x10000) {
+        out += { static_cast<char>((pt >> 12)         | 0xE0),
+                 static_cast<char>(((pt >> 6) & 0x3F) | 0x80),
+                 static_cast<char>((pt & 0x3F)        | 0x80) };
+    } else if (pt < 0x110000) {
+        out += { static_cast<char>((pt >> 18)          | 0xF0),
+                 static_cast<char>(((pt >> 12) & 0x3F) | 0x80),
+                 static_cast<char>(((pt >> 6)  & 0x3F) | 0x80),
+                 static_cast<char>((pt & 0x3F)         | 0x80) };
+    } else {
+        out += { static_cast<char>(0xEF),
+                 static_cast<char>(0xBF),
+                 static_cast<char>(0xBD) }; // U+FFFD
+    }
+}
+
+static size_t reference_utf8_to_utf16(const char * in, size_t len, char16_t * out) {
+    const std::string str(in, len);
+    std::u16string utf16;
+    utf16.reserve(str.length()); // likely overallocate
+    for (std::string::size_type i = 0; i < str.length(); )
+        utf16_encode(utf8_decode(str, i), utf16);
+    std::memcpy(out, utf16.data(), utf16.length() * sizeof(char16_t));
+    return utf16.length();
+}
+
+static size_t reference_utf16_to_utf8(const char16_t * in, size_t len, char * out) {
+    const std::u16string str(in, len);
+    std::string utf8;
+    utf8.reserve(str.length() * 3 / 2); // estimate
+    for (std::u16string::size_type i = 0; i < str.length(); )
+        utf8_encode(utf16_decode(str, i), utf8);
+    std::memcpy(out, utf8.data(), utf8.length());
+    return utf8.length();
+}
+
+static size_t reference_ascii_prefix(const char * in, size_t len) {
+    size_t i = 0;
+    for (; i < len; ++i) {
+        const unsigned char c = static_cast<unsigned char>(in[i]);
+        if (c == 0 || c >= 0x80)
+            break;
+    }
+    return i;
+}
+
+/*
+ * Pointer-based single code point steps shared by all of the fast transcoders. These behave
+ * exactly like utf8_decode + utf16_encode and utf16_decode + utf8_encode above, with reads
+ * past the end of the input treated like the NUL that std::string would have returned.
+ */
+
+static inline bool is_continuation(const unsigned char * p, const unsigned char * end) {
+    return p < end && (*p & 0xC0) == 0x80;
+}
+
+static inline void utf8_to_utf16_step(const unsigned char *& p, const unsigned char * end,
+                                      char16_t *& out) {
+    const uint32_t b0 = p[0];
+    if (b0 < 0x80) {
+        *out++ = static_cast<char16_t>(b0);
+        p += 1;
+        return;
+    } else if (b0 < 0xC0) {
+        // Unexpected continuation byte
+    } else if (b0 < 0xE0) {
+        if (is_continuation(p + 1, end)) {
+            const char32_t pt = (b0 & 0x1F) << 6 | (p[1] & 0x3F);
+            if (pt >= 0x80) {
+                *out++ = static_cast<char16_t>(pt);
+                p += 2;
+                return;
+            }
+        }
+    } else if (b0 < 0xF0) {
+        if (is_continuation(p + 1, end) && is_continuation(p + 2, end)) {
+            const char32_t pt = (b0 & 0x0F) << 12 | (p[1] & 0x3F) << 6 | (p[2] & 0x3F);
+            if (pt >= 0x800) {
+                *out++ = static_cast<char16_t>(pt);
+                p += 3;
+                return;
+            }
+        }
+    } else if (b0 < 0xF8) {
+        if (is_continuation(p + 1, end) && is_continuation(p + 2, end)
+                && is_continuation(p + 3, end)) {
+            const char32_t pt = (b0 & 0x0F) << 18 | (p[1] & 0x3F) << 12
+                              | (p[2] & 0x3F) << 6  | (p[3] & 0x3F);
+            if (pt >= 0x10000 && pt < 0x110000) {
+                *out++ = static_cast<char16_t>(((pt - 0x10000) >> 10) + 0xD800);
+                *out++ = static_cast<char16_t>((pt & 0x3FF) + 0xDC00);
+                p += 4;
+                return;
+            }
+        }
+    }
+    *out++ = 0xFFFD;
+    p += 1;
+}
+
+static inline void utf16_to_utf8_step(const char16_t *& p, const char16_t * end, char *& out) {
+    const char16_t c = p[0];
+    char32_t pt;
+    if (is_high_surrogate(c) && p + 1 < end && is_low_surrogate(p[1])) {
+        pt = (((c - 0xD800) << 10) | (p[1] - 0xDC00)) + 0x10000;
+        p += 2;
+    } else if (is_high_surrogate(c) || is_low_surrogate(c)) {
+        pt = 0xFFFD;
+        p += 1;
+    } else {
+        pt = c;
+        p += 1;
+    }
+
+    if (pt < 0x80) {
+        *out++ = static_cast<char>(pt);
+    } else if (pt < 0x800) {
+        *out++ = static_cast<char>((pt >> 6)   | 0xC0);
+        *out++ = static_cast<char>((pt & 0x3F) | 0x80);
+    } else if (pt < 0x10000) {
+        *out++ = static_cast<char>((pt >> 12)         | 0xE0);
+        *out++ = static_cast<char>(((pt >> 6) & 0x3F) | 0x80);
+        *out++ = static_cast<char>((pt & 0x3F)        | 0x80);
+    } else {
+        *out++ = static_cast<char>((pt >> 18)          | 0xF0);
+        *out++ = static_cast<char>(((pt >> 12) & 0x3F) | 0x80);
+        *out++ = static_cast<char>(((pt >> 6)  & 0x3F) | 0x80);
+        *out++ = static_cast<char>((pt & 0x3F)         | 0x80);
+    }
+}
+
+size_t utf16ToUtf8Length(const char16_t * in, size_t len) {
+    size_t out = 0;
+    for (size_t i = 0; i < len; ++i) {
+        const char16_t c = in[i];
+        if (c < 0x80) {
+            out += 1;
+        } else if (c < 0x800) {
+            out += 2;
+        } else if (is_high_surrogate(c) && i + 1 < len && is_low_surrogate(in[i+1])) {
+            out += 4;
+            ++i;
+        } else {
+            // Everything else in the BMP, including U+FFFD for unpaired surrogates.
+            out += 3;
+        }
+    }
+    return out;
+}
+
+static inline unsigned count_trailing_zeros(uint32_t x) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long idx;
+    _BitScanForward(&idx, x);
+    return static_cast<unsigned>(idx);
+#else
+    return static_cast<unsigned>(__builtin_ctz(x));
+#endif
+}
+
+/*
+ * Portable transcoder: checks eight bytes (or four code units) at a time for ASCII using
+ * plain 64-bit arithmetic, and falls back to the single code point steps otherwise.
+ */
+
+static size_t scalar_utf8_to_utf16(const char * in, size_t len, char16_t * out) {
+    auto p = reinterpret_cast<const unsigned char *>(in);
+    const auto end = p + len;
+    char16_t * const start = out;
+    while (p < end) {
+        if (end - p >= 8) {
+            uint64_t block;
+            std::memcpy(&block, p, sizeof block);
+            if ((block & UINT64_C(0x8080808080808080)) == 0) {
+                for (int k = 0; k < 8; ++k) {
+                    out[k] = p[k];
+                }
+                p += 8;
+                out += 8;
+                continue;
+            }
+        }
+        utf8_to_utf16_step(p, end, out);
+    }
+    return static_cast<size_t>(out - start);
+}
+
+static size_t scalar_utf16_to_utf8(const char16_t * in, size_t len, char * out) {
+    auto p = in;
+    const auto end = in + len;
+    char * const start = out;
+    while (p < end) {
+        if (end - p >= 4) {
+            uint64_t block;
+            std::memcpy(&block, p, sizeof block);
+            if ((block & UINT64_C(0xFF80FF80FF80FF80)) == 0) {
+                for (int k = 0; k < 4; ++k) {
+                    out[k] = static_cast<char>(p[k]);
+                }
+                p += 4;
+                out += 4;
+                continue;
+            }
+        }
+        utf16_to_utf8_step(p, end, out);
+    }
+    return static_cast<size_t>(out - start);
+}
+
+static size_t scalar_ascii_prefix(const char * in, size_t len) {
+    size_t i = 0;
+    for (; len - i >= 8; i += 8) {
+        uint64_t block;
+        std::memcpy(&block, in + i, sizeof block);
+        const uint64_t has_zero = (block - UINT64_C(0x0101010101010101)) & ~block;
+        if ((block | has_zero) & UINT64_C(0x8080808080808080)) {
+            break;
+        }
+    }
+    return i + reference_ascii_prefix(in + i, len - i);
+}
+
+#ifdef DJINNI_UTF_SSE2
+
+/*
+ * SSE2 transcoder. Whole 16-byte (or 16-unit) blocks of ASCII are widened or narrowed with
+ * single instructions. A block containing anything else has its ASCII prefix handled the
+ * same way and the remainder decoded one code point at a time up to the end of the block.
+ *
+ * Full-block stores may write past the last code unit that is actually produced. That's
+ * safe: output never runs ahead of input (one unit per byte, or at most three bytes per
+ * unit), so every store stays inside the capacity callers are required to provide.
+ */
+
+static size_t sse2_utf8_to_utf16(const char * in, size_t len, char16_t * out) {
+    auto p = reinterpret_cast<const unsigned char *>(in);
+    const auto end = p + len;
+    char16_t * const start = out;
+    const __m128i zero = _mm_setzero_si128();
+    while (end - p >= 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 8), _mm_unpackhi_epi8(v, zero));
+        const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(v));
+        if (mask == 0) {
+            p += 16;
+            out += 16;
+            continue;
+        }
+        const unsigned ascii = count_trailing_zeros(mask);
+        const auto block_end = p + 16;
+        p += ascii;
+        out += ascii;
+        while (p < block_end) {
+            utf8_to_utf16_step(p, end, out);
+        }
+    }
+    while (p < end) {
+        utf8_to_utf16_step(p, end, out);
+    }
+    return static_cast<size_t>(out - start);
+}
+
+static size_t sse2_utf16_to_utf8(const char16_t * in, size_t len, char * out) {
+    auto p = in;
+    const auto end = in + len;
+    char * const start = out;
+    const __m128i non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+    const __m128i zero = _mm_setzero_si128();
+    while (end - p >= 16) {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 8));
+        // One bit per byte; both bytes of a code unit are set iff that unit is ASCII.
+        const uint32_t ascii_mask =
+            static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(lo, non_ascii), zero)))
+            | static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(hi, non_ascii), zero))) << 16;
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(lo, hi));
+        if (ascii_mask == 0xFFFFFFFF) {
+            p += 16;
+            out += 16;
+            continue;
+        }
+        const unsigned ascii = count_trailing_zeros(~ascii_mask) / 2;
+        const auto block_end = p + 16;
+        p += ascii;
+        out += ascii;
+        while (p < block_end) {
+            utf16_to_utf8_step(p, end, out);
+        }
+    }
+    while (p < end) {
+        utf16_to_utf8_step(p, end, out);
+    }
+    return static_cast<size_t>(out - start);
+}
+
+static size_t sse2_ascii_prefix(const char * in, size_t len) {
+    size_t i = 0;
+    const __m128i zero = _mm_setzero_si128();
+    for (; len - i >= 16; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        // Signed compare: 0x01-0x7F are exactly the bytes greater than zero.
+        const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(v, zero)));
+        if (mask != 0xFFFF) {
+            return i + count_trailing_zeros(~mask);
+        }
+    }
+    return i + reference_ascii_prefix(in + i, len - i);
+}
+
+#endif // DJINNI_UTF_SSE2
+
+#ifdef DJINNI_UTF_AVX2
+
+/*
+ * AVX2 transcoder. Same structure as the SSE2 one, with 32-byte (or 32-unit) blocks.
+ */
+
+__attribute__((target("avx2")))
+static size_t avx2_utf8_to_utf16(const char * in, size_t len, char16_t * out) {
+    auto p = reinterpret_cast<const unsigned char *>(in);
+    const auto end = p + len;
+    char16_t * const start = out;
+    while (end - p >= 32) {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), _mm256_cvtepu8_epi16(lo));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 16), _mm256_cvtepu8_epi16(hi));
+        const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(lo))
+                            | static_cast<uint32_t>(_mm_movemask_epi8(hi)) << 16;
+        if (mask == 0) {
+            p += 32;
+            out += 32;
+            continue;
+        }
+        const unsigned ascii = count_trailing_zeros(mask);
+        const auto block_end = p + 32;
+        p += ascii;
+        out += ascii;
+        while (p < block_end) {
+            utf8_to_utf16_step(p, end, out);
+        }
+    }
+    while (p < end) {
+        utf8_to_utf16_step(p, end, out);
+    }
+    return static_cast<size_t>(out - start);
+}
+
+__attribute__((target("avx2")))
+static size_t avx2_utf16_to_utf8(const char16_t * in, size_t len, char * out) {
+    auto p = in;
+    const auto end = in + len;
+    char * const start = out;
+    const __m256i non_ascii = _mm256_set1_epi16(static_cast<short>(0xFF80));
+    const __m256i zero = _mm256_setzero_si256();
+    while (end - p >= 32) {
+        const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 16));
+        // packus interleaves 128-bit lanes; permute them back into order.
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                            _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8));
+        if (_mm256_testz_si256(_mm256_or_si256(lo, hi), non_ascii)) {
+            p += 32;
+            out += 32;
+            continue;
+        }
+        const uint64_t ascii_mask =
+            static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(lo, non_ascii), zero)))
+            | static_cast<uint64_t>(static_cast<uint32_t>(
+                _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(hi, non_ascii), zero)))) << 32;
+        const uint64_t first_non_ascii = ~ascii_mask;
+        const uint32_t low_word = static_cast<uint32_t>(first_non_ascii);
+        const unsigned ascii = (low_word ? count_trailing_zeros(low_word)
+                                         : 32 + count_trailing_zeros(static_cast<uint32_t>(first_non_ascii >> 32))) / 2;
+        const auto block_end = p + 32;
+        p += ascii;
+        out += ascii;
+        while (p < block_end) {
+            utf16_to_utf8_step(p, end, out);
+        }
+    }
+    while (p < end) {
+        utf16_to_utf8_step(p, end, out);
+    }
+    return static_cast<size_t>(out - start);
+}
+
+__attribute__((target("avx2")))
+static size_t avx2_ascii_prefix(const char * in, size_t len) {
+    size_t i = 0;
+    const __m256i zero = _mm256_setzero_si256();
+    for (; len - i >= 32; i += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+        const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, zero)));
+        if (mask != 0xFFFFFFFF) {
+            return i + count_trailing_zeros(~mask);
+        }
+    }
+    return i + reference_ascii_prefix(in + i, len - i);
+}
+
+static bool cpu_supports_avx2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif // DJINNI_UTF_AVX2
+
+static const UtfTranscoder s_reference = { "reference", reference_utf8_to_utf16, reference_utf16_to_utf8, reference_ascii_prefix };
+static const UtfTranscoder s_scalar = { "scalar", scalar_utf8_to_utf16, scalar_utf16_to_utf8, scalar_ascii_prefix };
+#ifdef DJINNI_UTF_SSE2
+static const UtfTranscoder s_sse2 = { "sse2", sse2_utf8_to_utf16, sse2_utf16_to_utf8, sse2_ascii_prefix };
+#endif
+#ifdef DJINNI_UTF_AVX2
+static const UtfTranscoder s_avx2 = { "avx2", avx2_utf8_to_utf16, avx2_utf16_to_utf8, avx2_ascii_prefix };
+#endif
+
+const UtfTranscoder & utfReferenceTranscoder() {
+    return s_reference;
+}
+
+std::vector<const UtfTranscoder *> utfAvailableTranscoders() {
+    std::vector<const UtfTranscoder *> all { &s_reference, &s_scalar };
+#ifdef DJINNI_UTF_SSE2
+    all.push_back(&s_sse2);
+#endif
+#ifdef DJINNI_UTF_AVX2
+    if (cpu_supports_avx2()) {
+        all.push_back(&s_avx2);
+    }
+#endif
+    return all;
+}
+
+const UtfTranscoder & utfTranscoder() {
+    // Thread-safe one-time initialization; the list is ordered from slowest to fastest.
+    static const UtfTranscoder & best = *utfAvailableTranscoders().back();
+    return best;
+}
+
+} // namespace djinni
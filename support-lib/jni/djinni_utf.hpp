@@ -0,0 +1,77 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/*
+ * UTF-8 <-> UTF-16 transcoding used by jniStringFromUTF8 and jniUTF8FromString.
+ *
+ * All transcoders implement the miniutf (https://github.com/dropbox/miniutf) semantics: every
+ * byte that does not start a valid UTF-8 sequence, and every unpaired surrogate in UTF-16
+ * input, is replaced by a single U+FFFD. Vectorized transcoders only differ from the scalar
+ * reference in how fast they get through runs of ASCII.
+ */
+
+namespace djinni {
+
+struct UtfTranscoder {
+    const char * name;
+
+    /*
+     * Transcode len bytes of UTF-8 into out, which must have room for len code units. Returns
+     * the number of code units written.
+     */
+    size_t (*utf8_to_utf16)(const char * in, size_t len, char16_t * out);
+
+    /*
+     * Transcode len UTF-16 code units into out, which must have room for 3 * len bytes, or
+     * for utf16ToUtf8Length(in, len) bytes: nothing is ever written past the end of the
+     * result. Returns the number of bytes written.
+     */
+    size_t (*utf16_to_utf8)(const char16_t * in, size_t len, char * out);
+
+    /*
+     * Number of leading bytes in the range 0x01-0x7F. Those are the only bytes that mean the
+     * same thing in UTF-8 and in the JVM's modified UTF-8, which encodes NUL as two bytes.
+     */
+    size_t (*ascii_prefix)(const char * in, size_t len);
+};
+
+/*
+ * Exact number of bytes the transcoders produce for the given UTF-16 input.
+ */
+size_t utf16ToUtf8Length(const char16_t * in, size_t len);
+
+/*
+ * The miniutf reference implementation, which decodes one code point at a time.
+ */
+const UtfTranscoder & utfReferenceTranscoder();
+
+/*
+ * The fastest transcoder supported by the CPU we're running on. Selected once, on first use.
+ */
+const UtfTranscoder & utfTranscoder();
+
+/*
+ * Every transcoder the running CPU supports, including the reference. Used by tests to
+ * compare each of them against the reference.
+ */
+std::vector<const UtfTranscoder *> utfAvailableTranscoders();
+
+} // namespace djinni
@@ -0,0 +1,231 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Binary encoding of records declared with deriving(serialize). Such records cross JNI as one
+ * byte[] that the generated Java code (com.dropbox.djinni.WireWriter/WireReader in
+ * support-lib/java) and the generated C++ code read and write field by field.
+ *
+ * The format has no field tags or version information, since both sides are generated from
+ * the same IDL:
+ *  - bool: one byte, 0 or 1
+ *  - i8 to i64, f32, f64: fixed width, little-endian
+ *  - lengths and counts: unsigned LEB128 varints
+ *  - string: byte length, then UTF-8
+ *  - binary: length, then the bytes
+ *  - date: i64 milliseconds since the POSIX epoch
+ *  - enum: ordinal as a varint
+ *  - optional: bool presence flag, then the value if present
+ *  - list, set, array: count, then the elements
+ *  - map: count, then key and value for each entry
+ *  - record: its fields in declaration order
+ *
+ * A message is a 4-byte little-endian payload length followed by the payload. The Java side
+ * hands out its per-thread scratch array, which may be longer than the message.
+ */
+
+namespace djinni {
+
+static constexpr size_t kWireHeaderBytes = 4;
+
+// Scratch buffers grown past this size are freed instead of kept for the next message.
+static constexpr size_t kWireScratchRetainBytes = 1 << 20;
+
+/*
+ * A byte buffer that reuses an allocation owned by the calling thread. If the thread's
+ * buffer is already taken by a WireScratch further up the stack, this one gets its own.
+ */
+class WireScratch {
+public:
+    WireScratch() : m_slot(slot()) {
+        if (m_slot.busy) {
+            m_buffer = &m_own;
+        } else {
+            m_slot.busy = true;
+            m_buffer = &m_slot.buffer;
+            m_buffer->clear();
+        }
+    }
+
+    ~WireScratch() {
+        if (m_buffer == &m_slot.buffer) {
+            if (m_buffer->capacity() > kWireScratchRetainBytes) {
+                std::vector<uint8_t>().swap(*m_buffer);
+            }
+            m_slot.busy = false;
+        }
+    }
+
+    WireScratch(const WireScratch &) = delete;
+    WireScratch & operator=(const WireScratch &) = delete;
+
+    std::vector<uint8_t> & buffer() { return *m_buffer; }
+
+private:
+    struct Slot {
+        std::vector<uint8_t> buffer;
+        bool busy = false;
+    };
+
+    static Slot & slot() {
+        static thread_local Slot s;
+        return s;
+    }
+
+    Slot & m_slot;
+    std::vector<uint8_t> m_own;
+    std::vector<uint8_t> * m_buffer;
+};
+
+/*
+ * Appends a message to a scratch buffer. data() and size() include the header, which is
+ * filled in by finish().
+ */
+class WireWriter {
+public:
+    WireWriter() : m_buffer(m_scratch.buffer()) {
+        m_buffer.resize(kWireHeaderBytes);
+    }
+
+    void writeBool(bool v) { m_buffer.push_back(v ? 1 : 0); }
+
+    template <class T>
+    void writeFixed(T v) {
+        static_assert(std::is_arithmetic<T>::value, "only numbers have a fixed width encoding");
+        const size_t pos = m_buffer.size();
+        m_buffer.resize(pos + sizeof(T));
+        store(&m_buffer[pos], v);
+    }
+
+    void writeLength(size_t n) {
+        while (n >= 0x80) {
+            m_buffer.push_back(static_cast<uint8_t>(n | 0x80));
+            n >>= 7;
+        }
+        m_buffer.push_back(static_cast<uint8_t>(n));
+    }
+
+    void writeBytes(const void * data, size_t size) {
+        writeLength(size);
+        const auto bytes = static_cast<const uint8_t *>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+
+    // Fills in the header. Call once, after the last field.
+    void finish() {
+        if (m_buffer.size() - kWireHeaderBytes > static_cast<size_t>(INT32_MAX)) {
+            throw std::length_error("djinni wire message is too large");
+        }
+        store(&m_buffer[0], static_cast<int32_t>(m_buffer.size() - kWireHeaderBytes));
+    }
+
+    const uint8_t * data() const { return m_buffer.data(); }
+    size_t size() const { return m_buffer.size(); }
+
+    template <class T>
+    static void store(uint8_t * p, T v) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        const auto bytes = reinterpret_cast<const uint8_t *>(&v);
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            p[i] = bytes[sizeof(T) - 1 - i];
+        }
+#else
+        std::memcpy(p, &v, sizeof(T));
+#endif
+    }
+
+private:
+    WireScratch m_scratch;
+    std::vector<uint8_t> & m_buffer;
+};
+
+/*
+ * Reads a message payload. Throws std::out_of_range if the payload ends in the middle of a
+ * value, which only happens if the two sides were generated from different IDL.
+ */
+class WireReader {
+public:
+    WireReader(const uint8_t * data, size_t size) : m_pos(data), m_end(data + size) {}
+
+    bool readBool() { return *take(1) != 0; }
+
+    template <class T>
+    T readFixed() {
+        static_assert(std::is_arithmetic<T>::value, "only numbers have a fixed width encoding");
+        return load<T>(take(sizeof(T)));
+    }
+
+    size_t readLength() {
+        size_t n = 0;
+        for (unsigned shift = 0; ; shift += 7) {
+            const uint8_t b = *take(1);
+            if (shift >= 35) {
+                throw std::out_of_range("djinni wire length is malformed");
+            }
+            n |= static_cast<size_t>(b & 0x7f) << shift;
+            if (!(b & 0x80)) {
+                return n;
+            }
+        }
+    }
+
+    // Returns the bytes of a length-prefixed value, which stay valid as long as the message.
+    const uint8_t * readBytes(size_t & size) {
+        size = readLength();
+        return take(size);
+    }
+
+    bool atEnd() const { return m_pos == m_end; }
+
+    template <class T>
+    static T load(const uint8_t * p) {
+        T v;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        const auto bytes = reinterpret_cast<uint8_t *>(&v);
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            bytes[i] = p[sizeof(T) - 1 - i];
+        }
+#else
+        std::memcpy(&v, p, sizeof(T));
+#endif
+        return v;
+    }
+
+private:
+    const uint8_t * take(size_t n) {
+        if (static_cast<size_t>(m_end - m_pos) < n) {
+            throw std::out_of_range("djinni wire message is truncated");
+        }
+        const uint8_t * p = m_pos;
+        m_pos += n;
+        return p;
+    }
+
+    const uint8_t * m_pos;
+    const uint8_t * m_end;
+};
+
+} // namespace djinni
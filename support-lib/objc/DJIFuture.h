@@ -0,0 +1,38 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#import <Foundation/Foundation.h>
+
+/**
+ * The Objective-C type of the IDL "future<T>" type: a value, boxed as in collections, or an
+ * exception that arrives later. Futures from C++ are completed by the C++ thread that
+ * completes them; ones passed to C++ can be completed from any thread.
+ */
+@interface DJIFuture : NSObject
+
+/** A future that isn't completed yet. */
+- (nonnull instancetype)init;
+
+/** Completes the future. Both return NO, and do nothing, if it was already completed. */
+- (BOOL)resolve:(nullable id)value;
+- (BOOL)reject:(nonnull NSException *)exception;
+
+/**
+ * Calls block with the value, or with the exception, once the future is completed: on the
+ * thread that completes it, or right away if it already is.
+ */
+- (void)onComplete:(nonnull void (^)(id _Nullable value, NSException * _Nullable exception))block;
+
+@end
@@ -0,0 +1,72 @@
+//
+// Copyright 2014 Dropbox, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#import "DJIFuture.h"
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+typedef void (^DJIFutureBlock)(id value, NSException * exception);
+
+@implementation DJIFuture {
+    // All guarded by @synchronized(self), and never changed again once _done is set.
+    BOOL _done;
+    id _value;
+    NSException * _exception;
+    NSMutableArray<DJIFutureBlock> * _blocks;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _blocks = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (BOOL)completeWithValue:(id)value exception:(NSException *)exception {
+    NSArray<DJIFutureBlock> * blocks;
+    @synchronized(self) {
+        if (_done) {
+            return NO;
+        }
+        _done = YES;
+        _value = value;
+        _exception = exception;
+        blocks = _blocks;
+        _blocks = nil;
+    }
+    for (DJIFutureBlock block in blocks) {
+        block(value, exception);
+    }
+    return YES;
+}
+
+- (BOOL)resolve:(id)value {
+    return [self completeWithValue:value exception:nil];
+}
+
+- (BOOL)reject:(NSException *)exception {
+    return [self completeWithValue:nil exception:exception];
+}
+
+- (void)onComplete:(DJIFutureBlock)block {
+    @synchronized(self) {
+        if (!_done) {
+            [_blocks addObject:[block copy]];
+            return;
+        }
+    }
+    block(_value, _exception);
+}
+
+@end
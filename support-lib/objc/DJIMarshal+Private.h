@@ -8,8 +8,13 @@
 
 #pragma once
 #import <Foundation/Foundation.h>
+#import "DJIFuture.h"
+#include "djinni_future.hpp"
+#include "djinni_shared_buffer.hpp"
 #include <chrono>
 #include <cstdint>
+#include <exception>
+#include <stdexcept>
 #include <string>
 #include <unordered_set>
 #include <unordered_map>
@@ -159,6 +164,35 @@ struct Binary {
     }
 };
 
+struct Buffer {
+    using CppType = SharedBuffer;
+    using ObjcType = NSData*;
+
+    using Boxed = Buffer;
+
+    // Immutable NSData is shared as is, and kept alive by the SharedBuffer. C++ must not write
+    // to its bytes. NSMutableData can be resized under us, so that gets copied once.
+    static CppType toCpp(ObjcType data) {
+        assert(data);
+        NSData* shared = [data copy];
+        auto bytes = static_cast<uint8_t*>(const_cast<void*>(shared.bytes));
+        std::shared_ptr<void> owner((__bridge void*)shared, [shared](void*) {});
+        return CppType(std::move(owner), bytes, static_cast<size_t>(shared.length));
+    }
+
+    // The NSData holds a copy of the SharedBuffer, which keeps the bytes alive until it's freed.
+    static ObjcType fromCpp(const CppType& buffer) {
+        assert(buffer.size() <= std::numeric_limits<NSUInteger>::max());
+        if (buffer.empty()) {
+            return [NSData data];
+        }
+        CppType ref = buffer;
+        return [[NSData alloc] initWithBytesNoCopy:buffer.data()
+                                            length:static_cast<NSUInteger>(buffer.size())
+                                       deallocator:^(void*, NSUInteger) { (void)ref; }];
+    }
+};
+
 template<template<class> class OptionalType, class T>
 class Optional {
 public:
@@ -270,4 +304,50 @@ public:
     }
 };
 
+// Results are passed on by the thread that completes the future, without waiting for them.
+// Exceptions cross as an NSException or a std::runtime_error with the same message.
+template<class T>
+class Future {
+    using ECppType = typename T::CppType;
+    using EObjcType = typename T::Boxed::ObjcType;
+
+public:
+    using CppType = SharedFuture<ECppType>;
+    using ObjcType = DJIFuture*;
+
+    using Boxed = Future;
+
+    static CppType toCpp(ObjcType future) {
+        assert(future);
+        Promise<ECppType> promise;
+        [future onComplete:^(id value, NSException* exception) {
+            try {
+                if (exception) {
+                    throw std::runtime_error(exception.reason ? exception.reason.UTF8String : "");
+                }
+                promise.setValue(T::Boxed::toCpp(static_cast<EObjcType>(value)));
+            } catch (const std::exception&) {
+                promise.setException(std::current_exception());
+            }
+        }];
+        return promise.getFuture();
+    }
+
+    static ObjcType fromCpp(const CppType& c) {
+        assert(c.valid());
+        DJIFuture* future = [[DJIFuture alloc] init];
+        c.then([future] (const CppType& done) {
+            @autoreleasepool {
+                try {
+                    [future resolve:T::Boxed::fromCpp(done.get())];
+                } catch (const std::exception& e) {
+                    NSString* message = [NSString stringWithUTF8String:e.what()];
+                    [future reject:[NSException exceptionWithName:message reason:message userInfo:nil]];
+                }
+            }
+        });
+        return future;
+    }
+};
+
 } // namespace djinni
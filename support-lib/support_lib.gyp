@@ -5,13 +5,16 @@
             "type": "static_library",
             "sources": [
               "jni/djinni_support.cpp",
+              "jni/djinni_utf.cpp",
             ],
             "include_dirs": [
               "jni",
+              "cpp",
             ],
             "direct_dependent_settings": {
                 "include_dirs": [
                   "jni",
+                  "cpp",
                 ],
             },
         },
@@ -24,13 +27,16 @@
             "sources": [
               "objc/DJIWeakPtrWrapper.mm",
               "objc/DJIError.mm",
+              "objc/DJIFuture.mm",
             ],
             "include_dirs": [
               "objc",
+              "cpp",
             ],
             "direct_dependent_settings": {
                 "include_dirs": [
                   "objc",
+                  "cpp",
                 ],
             },
         },
@@ -0,0 +1,14 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+#pragma once
+
+#include "djinni_future.hpp"
+#include <string>
+
+class AsyncSource {
+public:
+    virtual ~AsyncSource() {}
+
+    virtual ::djinni::SharedFuture<std::string> fetch(const std::string & key) = 0;
+};
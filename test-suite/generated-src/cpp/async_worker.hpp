@@ -0,0 +1,28 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+#pragma once
+
+#include "djinni_future.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class AsyncSource;
+
+/** Completes the futures it returns on a native worker thread, in the order they were made. */
+class AsyncWorker {
+public:
+    virtual ~AsyncWorker() {}
+
+    static std::shared_ptr<AsyncWorker> create();
+
+    /** Completes with a + b. */
+    virtual ::djinni::SharedFuture<int64_t> add(int64_t a, int64_t b) = 0;
+
+    /** Completes with s reversed, or fails if s is empty. */
+    virtual ::djinni::SharedFuture<std::string> reverse(const std::string & s) = 0;
+
+    /** Completes with the length of what source.fetch(key) completes with, without waiting for it. */
+    virtual ::djinni::SharedFuture<int32_t> measure(const std::shared_ptr<AsyncSource> & source, const std::string & key) = 0;
+};
@@ -0,0 +1,16 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from oneway.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/** Receives events from C++ without holding up the threads that produce them. */
+class EventSink {
+public:
+    virtual ~EventSink() {}
+
+    /** Java gets these on the djinni dispatcher thread, in the order each C++ thread made them. */
+    virtual void on_event(const std::string & source, int32_t value) = 0;
+};
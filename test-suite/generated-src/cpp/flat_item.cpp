@@ -0,0 +1,36 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#include "flat_item.hpp"  // my header
+
+
+FlatItem FlatItemView::toCpp() const {
+    return {::djinni::FlatI64::toCpp(serial()),
+            ::djinni::FlatBool::toCpp(flag()),
+            ::djinni::FlatI16::toCpp(rank()),
+            ::djinni::FlatEnum<color>::toCpp(shade()),
+            ::djinni::FlatString::toCpp(name()),
+            ::djinni::FlatOptional<std::experimental::optional, ::djinni::FlatF64>::toCpp(score()),
+            ::djinni::FlatDate::toCpp(created()),
+            ::djinni::FlatBinary::toCpp(thumbnail()),
+            ::djinni::FlatList<::djinni::FlatString>::toCpp(tags())};
+}
+
+std::vector<uint8_t> FlatItemBuilder::build(const FlatItem& value) {
+    ::djinni::FlatBuilder builder;
+    const uint64_t at = builder.allocate(FlatItemView::kSize);
+    write(builder, at, value);
+    return builder.finish(FlatItemView::kLayoutHash, at);
+}
+
+void FlatItemBuilder::write(::djinni::FlatBuilder& builder, uint64_t at, const FlatItem& value) {
+    ::djinni::FlatI64::write(builder, at + 0, value.serial);
+    ::djinni::FlatBool::write(builder, at + 8, value.flag);
+    ::djinni::FlatI16::write(builder, at + 10, value.rank);
+    ::djinni::FlatEnum<color>::write(builder, at + 12, value.shade);
+    ::djinni::FlatString::write(builder, at + 16, value.name);
+    ::djinni::FlatOptional<std::experimental::optional, ::djinni::FlatF64>::write(builder, at + 24, value.score);
+    ::djinni::FlatDate::write(builder, at + 32, value.created);
+    ::djinni::FlatBinary::write(builder, at + 40, value.thumbnail);
+    ::djinni::FlatList<::djinni::FlatString>::write(builder, at + 48, value.tags);
+}
@@ -0,0 +1,102 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#pragma once
+
+#include "color.hpp"
+#include "djinni_flat.hpp"
+#include <chrono>
+#include <cstdint>
+#include <experimental/optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/** Laid out flat for snapshots that are read in place; see FlatRecordTest. */
+struct FlatItem final {
+    int64_t serial;
+    bool flag;
+    int16_t rank;
+    color shade;
+    std::string name;
+    std::experimental::optional<double> score;
+    std::chrono::system_clock::time_point created;
+    std::vector<uint8_t> thumbnail;
+    std::vector<std::string> tags;
+
+    FlatItem(int64_t serial,
+             bool flag,
+             int16_t rank,
+             color shade,
+             std::string name,
+             std::experimental::optional<double> score,
+             std::chrono::system_clock::time_point created,
+             std::vector<uint8_t> thumbnail,
+             std::vector<std::string> tags)
+    : serial(std::move(serial))
+    , flag(std::move(flag))
+    , rank(std::move(rank))
+    , shade(std::move(shade))
+    , name(std::move(name))
+    , score(std::move(score))
+    , created(std::move(created))
+    , thumbnail(std::move(thumbnail))
+    , tags(std::move(tags))
+    {}
+};
+
+/** Reads a FlatItem in place from a flat snapshot, see djinni_flat.hpp. */
+class FlatItemView final {
+public:
+    static constexpr uint64_t kSize = 56;
+    static constexpr uint64_t kLayoutHash = 0x6585f2fb9224370cULL;
+
+    // Throws std::invalid_argument unless data was written by FlatItemBuilder::build().
+    static FlatItemView root(const void * data, size_t size) {
+        const ::djinni::FlatData flatData(data, size);
+        return FlatItemView(flatData, flatData.root(kLayoutHash, kSize));
+    }
+
+    FlatItemView(const ::djinni::FlatData& data, uint64_t at)
+    : m_data(data)
+    , m_at(at)
+    {
+        m_data.bytes(m_at, kSize);
+    }
+
+    ::djinni::FlatI64::View serial() const { return ::djinni::FlatI64::view(m_data, m_at + 0); }
+
+    ::djinni::FlatBool::View flag() const { return ::djinni::FlatBool::view(m_data, m_at + 8); }
+
+    ::djinni::FlatI16::View rank() const { return ::djinni::FlatI16::view(m_data, m_at + 10); }
+
+    ::djinni::FlatEnum<color>::View shade() const { return ::djinni::FlatEnum<color>::view(m_data, m_at + 12); }
+
+    ::djinni::FlatString::View name() const { return ::djinni::FlatString::view(m_data, m_at + 16); }
+
+    ::djinni::FlatOptional<std::experimental::optional, ::djinni::FlatF64>::View score() const { return ::djinni::FlatOptional<std::experimental::optional, ::djinni::FlatF64>::view(m_data, m_at + 24); }
+
+    ::djinni::FlatDate::View created() const { return ::djinni::FlatDate::view(m_data, m_at + 32); }
+
+    ::djinni::FlatBinary::View thumbnail() const { return ::djinni::FlatBinary::view(m_data, m_at + 40); }
+
+    ::djinni::FlatList<::djinni::FlatString>::View tags() const { return ::djinni::FlatList<::djinni::FlatString>::view(m_data, m_at + 48); }
+
+    FlatItem toCpp() const;
+
+private:
+    ::djinni::FlatData m_data;
+    uint64_t m_at;
+};
+
+/** Writes FlatItem records in the layout read by FlatItemView. */
+struct FlatItemBuilder final {
+    using CppType = FlatItem;
+    using View = FlatItemView;
+
+    // A whole snapshot with value as its root record.
+    static std::vector<uint8_t> build(const FlatItem& value);
+
+    // Fills in the record block at the given offset, which holds View::kSize bytes.
+    static void write(::djinni::FlatBuilder& builder, uint64_t at, const FlatItem& value);
+};
@@ -0,0 +1,32 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#include "flat_snapshot.hpp"  // my header
+
+
+FlatSnapshot FlatSnapshotView::toCpp() const {
+    return {::djinni::FlatI32::toCpp(version()),
+            ::djinni::FlatList<::djinni::FlatRecord<FlatItemBuilder>>::toCpp(items()),
+            ::djinni::FlatMap<::djinni::FlatString, ::djinni::FlatI64>::toCpp(by_name()),
+            ::djinni::FlatSet<::djinni::FlatI64>::toCpp(ids()),
+            ::djinni::FlatList<::djinni::FlatF32>::toCpp(weights()),
+            ::djinni::FlatOptional<std::experimental::optional, ::djinni::FlatRecord<FlatItemBuilder>>::toCpp(featured()),
+            ::djinni::FlatOptional<std::experimental::optional, ::djinni::FlatString>::toCpp(note())};
+}
+
+std::vector<uint8_t> FlatSnapshotBuilder::build(const FlatSnapshot& value) {
+    ::djinni::FlatBuilder builder;
+    const uint64_t at = builder.allocate(FlatSnapshotView::kSize);
+    write(builder, at, value);
+    return builder.finish(FlatSnapshotView::kLayoutHash, at);
+}
+
+void FlatSnapshotBuilder::write(::djinni::FlatBuilder& builder, uint64_t at, const FlatSnapshot& value) {
+    ::djinni::FlatI32::write(builder, at + 0, value.version);
+    ::djinni::FlatList<::djinni::FlatRecord<FlatItemBuilder>>::write(builder, at + 8, value.items);
+    ::djinni::FlatMap<::djinni::FlatString, ::djinni::FlatI64>::write(builder, at + 16, value.by_name);
+    ::djinni::FlatSet<::djinni::FlatI64>::write(builder, at + 24, value.ids);
+    ::djinni::FlatList<::djinni::FlatF32>::write(builder, at + 32, value.weights);
+    ::djinni::FlatOptional<std::experimental::optional, ::djinni::FlatRecord<FlatItemBuilder>>::write(builder, at + 40, value.featured);
+    ::djinni::FlatOptional<std::experimental::optional, ::djinni::FlatString>::write(builder, at + 48, value.note);
+}
@@ -0,0 +1,92 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#pragma once
+
+#include "djinni_flat.hpp"
+#include "flat_item.hpp"
+#include <cstdint>
+#include <experimental/optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+struct FlatSnapshot final {
+    int32_t version;
+    std::vector<FlatItem> items;
+    std::unordered_map<std::string, int64_t> by_name;
+    std::unordered_set<int64_t> ids;
+    std::vector<float> weights;
+    std::experimental::optional<FlatItem> featured;
+    std::experimental::optional<std::string> note;
+
+    FlatSnapshot(int32_t version,
+                 std::vector<FlatItem> items,
+                 std::unordered_map<std::string, int64_t> by_name,
+                 std::unordered_set<int64_t> ids,
+                 std::vector<float> weights,
+                 std::experimental::optional<FlatItem> featured,
+                 std::experimental::optional<std::string> note)
+    : version(std::move(version))
+    , items(std::move(items))
+    , by_name(std::move(by_name))
+    , ids(std::move(ids))
+    , weights(std::move(weights))
+    , featured(std::move(featured))
+    , note(std::move(note))
+    {}
+};
+
+/** Reads a FlatSnapshot in place from a flat snapshot, see djinni_flat.hpp. */
+class FlatSnapshotView final {
+public:
+    static constexpr uint64_t kSize = 56;
+    static constexpr uint64_t kLayoutHash = 0xdd93ee15af2673a2ULL;
+
+    // Throws std::invalid_argument unless data was written by FlatSnapshotBuilder::build().
+    static FlatSnapshotView root(const void * data, size_t size) {
+        const ::djinni::FlatData flatData(data, size);
+        return FlatSnapshotView(flatData, flatData.root(kLayoutHash, kSize));
+    }
+
+    FlatSnapshotView(const ::djinni::FlatData& data, uint64_t at)
+    : m_data(data)
+    , m_at(at)
+    {
+        m_data.bytes(m_at, kSize);
+    }
+
+    ::djinni::FlatI32::View version() const { return ::djinni::FlatI32::view(m_data, m_at + 0); }
+
+    ::djinni::FlatList<::djinni::FlatRecord<FlatItemBuilder>>::View items() const { return ::djinni::FlatList<::djinni::FlatRecord<FlatItemBuilder>>::view(m_data, m_at + 8); }
+
+    ::djinni::FlatMap<::djinni::FlatString, ::djinni::FlatI64>::View by_name() const { return ::djinni::FlatMap<::djinni::FlatString, ::djinni::FlatI64>::view(m_data, m_at + 16); }
+
+    ::djinni::FlatSet<::djinni::FlatI64>::View ids() const { return ::djinni::FlatSet<::djinni::FlatI64>::view(m_data, m_at + 24); }
+
+    ::djinni::FlatList<::djinni::FlatF32>::View weights() const { return ::djinni::FlatList<::djinni::FlatF32>::view(m_data, m_at + 32); }
+
+    ::djinni::FlatOptional<std::experimental::optional, ::djinni::FlatRecord<FlatItemBuilder>>::View featured() const { return ::djinni::FlatOptional<std::experimental::optional, ::djinni::FlatRecord<FlatItemBuilder>>::view(m_data, m_at + 40); }
+
+    ::djinni::FlatOptional<std::experimental::optional, ::djinni::FlatString>::View note() const { return ::djinni::FlatOptional<std::experimental::optional, ::djinni::FlatString>::view(m_data, m_at + 48); }
+
+    FlatSnapshot toCpp() const;
+
+private:
+    ::djinni::FlatData m_data;
+    uint64_t m_at;
+};
+
+/** Writes FlatSnapshot records in the layout read by FlatSnapshotView. */
+struct FlatSnapshotBuilder final {
+    using CppType = FlatSnapshot;
+    using View = FlatSnapshotView;
+
+    // A whole snapshot with value as its root record.
+    static std::vector<uint8_t> build(const FlatSnapshot& value);
+
+    // Fills in the record block at the given offset, which holds View::kSize bytes.
+    static void write(::djinni::FlatBuilder& builder, uint64_t at, const FlatSnapshot& value);
+};
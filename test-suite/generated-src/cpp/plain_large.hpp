@@ -0,0 +1,40 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#pragma once
+
+#include "plain_medium.hpp"
+#include "plain_small.hpp"
+#include <cstdint>
+#include <experimental/optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+struct PlainLarge final {
+    PlainMedium header;
+    std::vector<PlainSmall> items;
+    std::unordered_map<std::string, int32_t> attributes;
+    std::unordered_set<int64_t> members;
+    std::vector<uint8_t> payload;
+    std::vector<double> weights;
+    std::experimental::optional<std::string> note;
+
+    PlainLarge(PlainMedium header,
+               std::vector<PlainSmall> items,
+               std::unordered_map<std::string, int32_t> attributes,
+               std::unordered_set<int64_t> members,
+               std::vector<uint8_t> payload,
+               std::vector<double> weights,
+               std::experimental::optional<std::string> note)
+    : header(std::move(header))
+    , items(std::move(items))
+    , attributes(std::move(attributes))
+    , members(std::move(members))
+    , payload(std::move(payload))
+    , weights(std::move(weights))
+    , note(std::move(note))
+    {}
+};
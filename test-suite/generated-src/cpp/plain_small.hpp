@@ -0,0 +1,22 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+struct PlainSmall final {
+    int64_t serial;
+    std::string label;
+    double score;
+
+    PlainSmall(int64_t serial,
+               std::string label,
+               double score)
+    : serial(std::move(serial))
+    , label(std::move(label))
+    , score(std::move(score))
+    {}
+};
@@ -0,0 +1,28 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_list.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+/** Only primitive fields, so lists of these cross JNI as one array per field. */
+struct PointRecord final {
+    int32_t x;
+    int32_t y;
+    int64_t key;
+    double weight;
+    bool visible;
+
+    PointRecord(int32_t x,
+                int32_t y,
+                int64_t key,
+                double weight,
+                bool visible)
+    : x(std::move(x))
+    , y(std::move(y))
+    , key(std::move(key))
+    , weight(std::move(weight))
+    , visible(std::move(visible))
+    {}
+};
@@ -0,0 +1,25 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_array.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+struct PrimitiveArrays final {
+    std::vector<int32_t> ints;
+    std::vector<int64_t> longs;
+    std::vector<double> doubles;
+    std::vector<bool> flags;
+
+    PrimitiveArrays(std::vector<int32_t> ints,
+                    std::vector<int64_t> longs,
+                    std::vector<double> doubles,
+                    std::vector<bool> flags)
+    : ints(std::move(ints))
+    , longs(std::move(longs))
+    , doubles(std::move(doubles))
+    , flags(std::move(flags))
+    {}
+};
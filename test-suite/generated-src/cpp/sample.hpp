@@ -0,0 +1,25 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+/** Only a few primitive fields, so sample_filter passes these across JNI as separate primitives. */
+struct Sample final {
+    int64_t time;
+    double value;
+    float weight;
+    bool valid;
+
+    Sample(int64_t time,
+           double value,
+           float weight,
+           bool valid)
+    : time(std::move(time))
+    , value(std::move(value))
+    , weight(std::move(weight))
+    , valid(std::move(valid))
+    {}
+};
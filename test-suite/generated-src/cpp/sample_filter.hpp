@@ -0,0 +1,19 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#pragma once
+
+#include "sample.hpp"
+#include <memory>
+
+class SampleFilter {
+public:
+    virtual ~SampleFilter() {}
+
+    static std::shared_ptr<SampleFilter> create();
+
+    /** Multiplies value and weight by factor, and clears valid if either is no longer finite. */
+    virtual Sample scale(const Sample & s, double factor) = 0;
+
+    virtual double weighted(const Sample & s) = 0;
+};
@@ -0,0 +1,16 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from coalesce.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/** Receives status updates from C++, which may come faster than Java can handle them. */
+class StatusListener {
+public:
+    virtual ~StatusListener() {}
+
+    /** An update made while another is waiting replaces it, so Java only sees the newest. */
+    virtual void on_status(const std::string & phase, int32_t progress) = 0;
+};
@@ -0,0 +1,31 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+#pragma once
+
+#include "wire_small.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** Keeps a running total and a list of labels. BatchTest records its calls with Tally.Batch. */
+class Tally {
+public:
+    virtual ~Tally() {}
+
+    static std::shared_ptr<Tally> create();
+
+    /** Adds amount to the total and returns the new total. Throws if amount is negative. */
+    virtual int64_t add(int64_t amount) = 0;
+
+    /** Keeps the item's label, and returns how many labels are kept. */
+    virtual int32_t remember(const WireSmall & item) = 0;
+
+    virtual std::vector<std::string> labels() = 0;
+
+    virtual void clear() = 0;
+
+    /** Returns a new tally with the same contents. Not in Tally.Batch, which can't return interfaces. */
+    virtual std::shared_ptr<Tally> fork() = 0;
+};
@@ -5,8 +5,10 @@
 
 #include "assorted_primitives.hpp"
 #include "color.hpp"
+#include "djinni_shared_buffer.hpp"
 #include "map_list_record.hpp"
 #include "nested_collection.hpp"
+#include "primitive_arrays.hpp"
 #include "primitive_list.hpp"
 #include "set_record.hpp"
 #include <cstdint>
@@ -31,6 +33,21 @@ public:
 
     static bool check_primitive_list(const PrimitiveList & pl);
 
+    static PrimitiveArrays get_primitive_arrays();
+
+    static bool check_primitive_arrays(const PrimitiveArrays & pa);
+
+    static std::vector<int64_t> reverse_i64_array(const std::vector<int64_t> & a);
+
+    /** C++ memory is filled with i % 256, and counted by live_buffer_count() until freed */
+    static ::djinni::SharedBuffer make_buffer(int32_t size);
+
+    static int64_t sum_buffer(const ::djinni::SharedBuffer & b);
+
+    static void fill_buffer(const ::djinni::SharedBuffer & b, int8_t value);
+
+    static int32_t live_buffer_count();
+
     static NestedCollection get_nested_collection();
 
     static bool check_nested_collection(const NestedCollection & nc);
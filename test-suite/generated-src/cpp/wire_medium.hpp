@@ -0,0 +1,35 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#pragma once
+
+#include "color.hpp"
+#include <chrono>
+#include <cstdint>
+#include <experimental/optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct WireMedium final {
+    int64_t serial;
+    std::string name;
+    std::vector<std::string> tags;
+    std::experimental::optional<float> rating;
+    color shade;
+    std::chrono::system_clock::time_point created;
+
+    WireMedium(int64_t serial,
+               std::string name,
+               std::vector<std::string> tags,
+               std::experimental::optional<float> rating,
+               color shade,
+               std::chrono::system_clock::time_point created)
+    : serial(std::move(serial))
+    , name(std::move(name))
+    , tags(std::move(tags))
+    , rating(std::move(rating))
+    , shade(std::move(shade))
+    , created(std::move(created))
+    {}
+};
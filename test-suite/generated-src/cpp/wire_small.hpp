@@ -0,0 +1,23 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+/** Crosses JNI as a single byte array; the plain_ records below have the same fields and are marshalled field by field. */
+struct WireSmall final {
+    int64_t serial;
+    std::string label;
+    double score;
+
+    WireSmall(int64_t serial,
+              std::string label,
+              double score)
+    : serial(std::move(serial))
+    , label(std::move(label))
+    , score(std::move(score))
+    {}
+};
@@ -0,0 +1,16 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+package com.dropbox.djinni.test;
+
+import java.util.concurrent.CompletableFuture;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public abstract class AsyncSource {
+    @Nonnull
+    public abstract CompletableFuture<String> fetch(@Nonnull String key);
+
+    // Caches System.identityHashCode(this) for the native proxy cache.
+    private int djinniIdentityHash;
+}
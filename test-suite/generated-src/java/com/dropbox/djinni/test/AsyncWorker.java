@@ -0,0 +1,77 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.NativeRefQueue;
+import java.util.concurrent.CompletableFuture;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Completes the futures it returns on a native worker thread, in the order they were made. */
+public abstract class AsyncWorker implements AutoCloseable {
+    /** Completes with a + b. */
+    @Nonnull
+    public abstract CompletableFuture<Long> add(long a, long b);
+
+    /** Completes with s reversed, or fails if s is empty. */
+    @Nonnull
+    public abstract CompletableFuture<String> reverse(@Nonnull String s);
+
+    /** Completes with the length of what source.fetch(key) completes with, without waiting for it. */
+    @Nonnull
+    public abstract CompletableFuture<Integer> measure(@CheckForNull AsyncSource source, @Nonnull String key);
+
+    @CheckForNull
+    public static native AsyncWorker create();
+
+    /**
+     * Releases the C++ object behind this instance now, instead of after it is garbage
+     * collected. The instance must not be used afterwards. Does nothing for Java implementations.
+     */
+    @Override
+    public void close() {}
+
+    private static final class CppProxy extends AsyncWorker
+    {
+        private final long nativeRef;
+        private final NativeRefQueue.Ref queueRef;
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            this.queueRef = NativeRefQueue.register(this, nativeRef);
+        }
+
+        @Override
+        public void close()
+        {
+            queueRef.release();
+        }
+
+        @Override
+        public CompletableFuture<Long> add(long a, long b)
+        {
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
+            return native_add(this.nativeRef, a, b);
+        }
+        private native CompletableFuture<Long> native_add(long _nativeRef, long a, long b);
+
+        @Override
+        public CompletableFuture<String> reverse(String s)
+        {
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
+            return native_reverse(this.nativeRef, s);
+        }
+        private native CompletableFuture<String> native_reverse(long _nativeRef, String s);
+
+        @Override
+        public CompletableFuture<Integer> measure(AsyncSource source, String key)
+        {
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
+            return native_measure(this.nativeRef, source, key);
+        }
+        private native CompletableFuture<Integer> native_measure(long _nativeRef, AsyncSource source, String key);
+    }
+}
@@ -15,4 +15,7 @@ public abstract class ClientInterface {
 
     @Nonnull
     public abstract String returnStr();
+
+    // Caches System.identityHashCode(this) for the native proxy cache.
+    private int djinniIdentityHash;
 }
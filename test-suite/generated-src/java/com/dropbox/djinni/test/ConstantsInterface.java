@@ -3,11 +3,11 @@
 
 package com.dropbox.djinni.test;
 
-import java.util.concurrent.atomic.AtomicBoolean;
+import com.dropbox.djinni.NativeRefQueue;
 import javax.annotation.CheckForNull;
 import javax.annotation.Nonnull;
 
-public abstract class ConstantsInterface {
+public abstract class ConstantsInterface implements AutoCloseable {
     public static final boolean BOOL_CONSTANT = true;
 
     public static final byte I8_CONSTANT = 1;
@@ -24,33 +24,35 @@ public abstract class ConstantsInterface {
 
     public abstract void dummy();
 
+    /**
+     * Releases the C++ object behind this instance now, instead of after it is garbage
+     * collected. The instance must not be used afterwards. Does nothing for Java implementations.
+     */
+    @Override
+    public void close() {}
+
     private static final class CppProxy extends ConstantsInterface
     {
         private final long nativeRef;
-        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+        private final NativeRefQueue.Ref queueRef;
 
         private CppProxy(long nativeRef)
         {
             if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
             this.nativeRef = nativeRef;
+            this.queueRef = NativeRefQueue.register(this, nativeRef);
         }
 
-        private native void nativeDestroy(long nativeRef);
-        public void destroy()
-        {
-            boolean destroyed = this.destroyed.getAndSet(true);
-            if (!destroyed) nativeDestroy(this.nativeRef);
-        }
-        protected void finalize() throws java.lang.Throwable
+        @Override
+        public void close()
         {
-            destroy();
-            super.finalize();
+            queueRef.release();
         }
 
         @Override
         public void dummy()
         {
-            assert !this.destroyed.get() : "trying to use a destroyed object";
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
             native_dummy(this.nativeRef);
         }
         private native void native_dummy(long _nativeRef);
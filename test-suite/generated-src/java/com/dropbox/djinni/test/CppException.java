@@ -3,43 +3,45 @@
 
 package com.dropbox.djinni.test;
 
-import java.util.concurrent.atomic.AtomicBoolean;
+import com.dropbox.djinni.NativeRefQueue;
 import javax.annotation.CheckForNull;
 import javax.annotation.Nonnull;
 
-public abstract class CppException {
+public abstract class CppException implements AutoCloseable {
     public abstract int throwAnException();
 
     @CheckForNull
     public static native CppException get();
 
+    /**
+     * Releases the C++ object behind this instance now, instead of after it is garbage
+     * collected. The instance must not be used afterwards. Does nothing for Java implementations.
+     */
+    @Override
+    public void close() {}
+
     private static final class CppProxy extends CppException
     {
         private final long nativeRef;
-        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+        private final NativeRefQueue.Ref queueRef;
 
         private CppProxy(long nativeRef)
         {
             if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
             this.nativeRef = nativeRef;
+            this.queueRef = NativeRefQueue.register(this, nativeRef);
         }
 
-        private native void nativeDestroy(long nativeRef);
-        public void destroy()
-        {
-            boolean destroyed = this.destroyed.getAndSet(true);
-            if (!destroyed) nativeDestroy(this.nativeRef);
-        }
-        protected void finalize() throws java.lang.Throwable
+        @Override
+        public void close()
         {
-            destroy();
-            super.finalize();
+            queueRef.release();
         }
 
         @Override
         public int throwAnException()
         {
-            assert !this.destroyed.get() : "trying to use a destroyed object";
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
             return native_throwAnException(this.nativeRef);
         }
         private native int native_throwAnException(long _nativeRef);
@@ -0,0 +1,16 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from oneway.djinni
+
+package com.dropbox.djinni.test;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Receives events from C++ without holding up the threads that produce them. */
+public abstract class EventSink {
+    /** Java gets these on the djinni dispatcher thread, in the order each C++ thread made them. */
+    public abstract void onEvent(@Nonnull String source, int value);
+
+    // Caches System.identityHashCode(this) for the native proxy cache.
+    private int djinniIdentityHash;
+}
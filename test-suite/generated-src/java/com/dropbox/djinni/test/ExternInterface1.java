@@ -3,38 +3,40 @@
 
 package com.dropbox.djinni.test;
 
-import java.util.concurrent.atomic.AtomicBoolean;
+import com.dropbox.djinni.NativeRefQueue;
 
-public abstract class ExternInterface1 {
+public abstract class ExternInterface1 implements AutoCloseable {
     public abstract com.dropbox.djinni.test.ClientReturnedRecord foo(com.dropbox.djinni.test.ClientInterface i);
 
+    /**
+     * Releases the C++ object behind this instance now, instead of after it is garbage
+     * collected. The instance must not be used afterwards. Does nothing for Java implementations.
+     */
+    @Override
+    public void close() {}
+
     private static final class CppProxy extends ExternInterface1
     {
         private final long nativeRef;
-        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+        private final NativeRefQueue.Ref queueRef;
 
         private CppProxy(long nativeRef)
         {
             if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
             this.nativeRef = nativeRef;
+            this.queueRef = NativeRefQueue.register(this, nativeRef);
         }
 
-        private native void nativeDestroy(long nativeRef);
-        public void destroy()
-        {
-            boolean destroyed = this.destroyed.getAndSet(true);
-            if (!destroyed) nativeDestroy(this.nativeRef);
-        }
-        protected void finalize() throws java.lang.Throwable
+        @Override
+        public void close()
         {
-            destroy();
-            super.finalize();
+            queueRef.release();
         }
 
         @Override
         public com.dropbox.djinni.test.ClientReturnedRecord foo(com.dropbox.djinni.test.ClientInterface i)
         {
-            assert !this.destroyed.get() : "trying to use a destroyed object";
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
             return native_foo(this.nativeRef, i);
         }
         private native com.dropbox.djinni.test.ClientReturnedRecord native_foo(long _nativeRef, com.dropbox.djinni.test.ClientInterface i);
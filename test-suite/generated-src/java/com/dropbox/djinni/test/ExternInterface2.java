@@ -5,4 +5,7 @@ package com.dropbox.djinni.test;
 
 public abstract class ExternInterface2 {
     public abstract ExternRecordWithDerivings foo(com.dropbox.djinni.test.TestHelpers i);
+
+    // Caches System.identityHashCode(this) for the native proxy cache.
+    private int djinniIdentityHash;
 }
@@ -0,0 +1,95 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import java.util.Date;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Laid out flat for snapshots that are read in place; see FlatRecordTest. */
+public final class FlatItem {
+
+
+    /*package*/ final long mSerial;
+
+    /*package*/ final boolean mFlag;
+
+    /*package*/ final short mRank;
+
+    /*package*/ final Color mShade;
+
+    /*package*/ final String mName;
+
+    /*package*/ final Double mScore;
+
+    /*package*/ final Date mCreated;
+
+    /*package*/ final byte[] mThumbnail;
+
+    /*package*/ final ArrayList<String> mTags;
+
+    public FlatItem(
+            long serial,
+            boolean flag,
+            short rank,
+            @Nonnull Color shade,
+            @Nonnull String name,
+            @CheckForNull Double score,
+            @Nonnull Date created,
+            @Nonnull byte[] thumbnail,
+            @Nonnull ArrayList<String> tags) {
+        this.mSerial = serial;
+        this.mFlag = flag;
+        this.mRank = rank;
+        this.mShade = shade;
+        this.mName = name;
+        this.mScore = score;
+        this.mCreated = created;
+        this.mThumbnail = thumbnail;
+        this.mTags = tags;
+    }
+
+    public long getSerial() {
+        return mSerial;
+    }
+
+    public boolean getFlag() {
+        return mFlag;
+    }
+
+    public short getRank() {
+        return mRank;
+    }
+
+    @Nonnull
+    public Color getShade() {
+        return mShade;
+    }
+
+    @Nonnull
+    public String getName() {
+        return mName;
+    }
+
+    @CheckForNull
+    public Double getScore() {
+        return mScore;
+    }
+
+    @Nonnull
+    public Date getCreated() {
+        return mCreated;
+    }
+
+    @Nonnull
+    public byte[] getThumbnail() {
+        return mThumbnail;
+    }
+
+    @Nonnull
+    public ArrayList<String> getTags() {
+        return mTags;
+    }
+}
@@ -0,0 +1,79 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.HashSet;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public final class FlatSnapshot {
+
+
+    /*package*/ final int mVersion;
+
+    /*package*/ final ArrayList<FlatItem> mItems;
+
+    /*package*/ final HashMap<String, Long> mByName;
+
+    /*package*/ final HashSet<Long> mIds;
+
+    /*package*/ final ArrayList<Float> mWeights;
+
+    /*package*/ final FlatItem mFeatured;
+
+    /*package*/ final String mNote;
+
+    public FlatSnapshot(
+            int version,
+            @Nonnull ArrayList<FlatItem> items,
+            @Nonnull HashMap<String, Long> byName,
+            @Nonnull HashSet<Long> ids,
+            @Nonnull ArrayList<Float> weights,
+            @CheckForNull FlatItem featured,
+            @CheckForNull String note) {
+        this.mVersion = version;
+        this.mItems = items;
+        this.mByName = byName;
+        this.mIds = ids;
+        this.mWeights = weights;
+        this.mFeatured = featured;
+        this.mNote = note;
+    }
+
+    public int getVersion() {
+        return mVersion;
+    }
+
+    @Nonnull
+    public ArrayList<FlatItem> getItems() {
+        return mItems;
+    }
+
+    @Nonnull
+    public HashMap<String, Long> getByName() {
+        return mByName;
+    }
+
+    @Nonnull
+    public HashSet<Long> getIds() {
+        return mIds;
+    }
+
+    @Nonnull
+    public ArrayList<Float> getWeights() {
+        return mWeights;
+    }
+
+    @CheckForNull
+    public FlatItem getFeatured() {
+        return mFeatured;
+    }
+
+    @CheckForNull
+    public String getNote() {
+        return mNote;
+    }
+}
@@ -0,0 +1,80 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.HashSet;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public final class PlainLarge {
+
+
+    /*package*/ final PlainMedium mHeader;
+
+    /*package*/ final ArrayList<PlainSmall> mItems;
+
+    /*package*/ final HashMap<String, Integer> mAttributes;
+
+    /*package*/ final HashSet<Long> mMembers;
+
+    /*package*/ final byte[] mPayload;
+
+    /*package*/ final double[] mWeights;
+
+    /*package*/ final String mNote;
+
+    public PlainLarge(
+            @Nonnull PlainMedium header,
+            @Nonnull ArrayList<PlainSmall> items,
+            @Nonnull HashMap<String, Integer> attributes,
+            @Nonnull HashSet<Long> members,
+            @Nonnull byte[] payload,
+            @Nonnull double[] weights,
+            @CheckForNull String note) {
+        this.mHeader = header;
+        this.mItems = items;
+        this.mAttributes = attributes;
+        this.mMembers = members;
+        this.mPayload = payload;
+        this.mWeights = weights;
+        this.mNote = note;
+    }
+
+    @Nonnull
+    public PlainMedium getHeader() {
+        return mHeader;
+    }
+
+    @Nonnull
+    public ArrayList<PlainSmall> getItems() {
+        return mItems;
+    }
+
+    @Nonnull
+    public HashMap<String, Integer> getAttributes() {
+        return mAttributes;
+    }
+
+    @Nonnull
+    public HashSet<Long> getMembers() {
+        return mMembers;
+    }
+
+    @Nonnull
+    public byte[] getPayload() {
+        return mPayload;
+    }
+
+    @Nonnull
+    public double[] getWeights() {
+        return mWeights;
+    }
+
+    @CheckForNull
+    public String getNote() {
+        return mNote;
+    }
+}
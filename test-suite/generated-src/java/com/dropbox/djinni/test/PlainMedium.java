@@ -0,0 +1,69 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import java.util.Date;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public final class PlainMedium {
+
+
+    /*package*/ final long mSerial;
+
+    /*package*/ final String mName;
+
+    /*package*/ final ArrayList<String> mTags;
+
+    /*package*/ final Float mRating;
+
+    /*package*/ final Color mShade;
+
+    /*package*/ final Date mCreated;
+
+    public PlainMedium(
+            long serial,
+            @Nonnull String name,
+            @Nonnull ArrayList<String> tags,
+            @CheckForNull Float rating,
+            @Nonnull Color shade,
+            @Nonnull Date created) {
+        this.mSerial = serial;
+        this.mName = name;
+        this.mTags = tags;
+        this.mRating = rating;
+        this.mShade = shade;
+        this.mCreated = created;
+    }
+
+    public long getSerial() {
+        return mSerial;
+    }
+
+    @Nonnull
+    public String getName() {
+        return mName;
+    }
+
+    @Nonnull
+    public ArrayList<String> getTags() {
+        return mTags;
+    }
+
+    @CheckForNull
+    public Float getRating() {
+        return mRating;
+    }
+
+    @Nonnull
+    public Color getShade() {
+        return mShade;
+    }
+
+    @Nonnull
+    public Date getCreated() {
+        return mCreated;
+    }
+}
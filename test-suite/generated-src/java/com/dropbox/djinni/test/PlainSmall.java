@@ -0,0 +1,39 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+package com.dropbox.djinni.test;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public final class PlainSmall {
+
+
+    /*package*/ final long mSerial;
+
+    /*package*/ final String mLabel;
+
+    /*package*/ final double mScore;
+
+    public PlainSmall(
+            long serial,
+            @Nonnull String label,
+            double score) {
+        this.mSerial = serial;
+        this.mLabel = label;
+        this.mScore = score;
+    }
+
+    public long getSerial() {
+        return mSerial;
+    }
+
+    @Nonnull
+    public String getLabel() {
+        return mLabel;
+    }
+
+    public double getScore() {
+        return mScore;
+    }
+}
@@ -0,0 +1,75 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_list.djinni
+
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Only primitive fields, so lists of these cross JNI as one array per field. */
+public final class PointRecord {
+
+
+    /*package*/ final int mX;
+
+    /*package*/ final int mY;
+
+    /*package*/ final long mKey;
+
+    /*package*/ final double mWeight;
+
+    /*package*/ final boolean mVisible;
+
+    public PointRecord(
+            int x,
+            int y,
+            long key,
+            double weight,
+            boolean visible) {
+        this.mX = x;
+        this.mY = y;
+        this.mKey = key;
+        this.mWeight = weight;
+        this.mVisible = visible;
+    }
+
+    public int getX() {
+        return mX;
+    }
+
+    public int getY() {
+        return mY;
+    }
+
+    public long getKey() {
+        return mKey;
+    }
+
+    public double getWeight() {
+        return mWeight;
+    }
+
+    public boolean getVisible() {
+        return mVisible;
+    }
+
+    /*package*/ static ArrayList<PointRecord> fromColumns(int[] xColumn, int[] yColumn, long[] keyColumn, double[] weightColumn, boolean[] visibleColumn) {
+        ArrayList<PointRecord> list = new ArrayList<PointRecord>(xColumn.length);
+        for (int i = 0; i < xColumn.length; ++i) {
+            list.add(new PointRecord(xColumn[i], yColumn[i], keyColumn[i], weightColumn[i], visibleColumn[i]));
+        }
+        return list;
+    }
+
+    /*package*/ static void toColumns(ArrayList<PointRecord> list, int[] xColumn, int[] yColumn, long[] keyColumn, double[] weightColumn, boolean[] visibleColumn) {
+        for (int i = 0; i < xColumn.length; ++i) {
+            PointRecord element = list.get(i);
+            xColumn[i] = element.mX;
+            yColumn[i] = element.mY;
+            keyColumn[i] = element.mKey;
+            weightColumn[i] = element.mWeight;
+            visibleColumn[i] = element.mVisible;
+        }
+    }
+}
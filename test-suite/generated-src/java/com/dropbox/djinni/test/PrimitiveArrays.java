@@ -0,0 +1,50 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_array.djinni
+
+package com.dropbox.djinni.test;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public final class PrimitiveArrays {
+
+
+    /*package*/ final int[] mInts;
+
+    /*package*/ final long[] mLongs;
+
+    /*package*/ final double[] mDoubles;
+
+    /*package*/ final boolean[] mFlags;
+
+    public PrimitiveArrays(
+            @Nonnull int[] ints,
+            @Nonnull long[] longs,
+            @Nonnull double[] doubles,
+            @Nonnull boolean[] flags) {
+        this.mInts = ints;
+        this.mLongs = longs;
+        this.mDoubles = doubles;
+        this.mFlags = flags;
+    }
+
+    @Nonnull
+    public int[] getInts() {
+        return mInts;
+    }
+
+    @Nonnull
+    public long[] getLongs() {
+        return mLongs;
+    }
+
+    @Nonnull
+    public double[] getDoubles() {
+        return mDoubles;
+    }
+
+    @Nonnull
+    public boolean[] getFlags() {
+        return mFlags;
+    }
+}
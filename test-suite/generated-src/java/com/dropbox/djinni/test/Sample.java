@@ -0,0 +1,66 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Only a few primitive fields, so sample_filter passes these across JNI as separate primitives. */
+public final class Sample {
+
+
+    /*package*/ final long mTime;
+
+    /*package*/ final double mValue;
+
+    /*package*/ final float mWeight;
+
+    /*package*/ final boolean mValid;
+
+    public Sample(
+            long time,
+            double value,
+            float weight,
+            boolean valid) {
+        this.mTime = time;
+        this.mValue = value;
+        this.mWeight = weight;
+        this.mValid = valid;
+    }
+
+    public long getTime() {
+        return mTime;
+    }
+
+    public double getValue() {
+        return mValue;
+    }
+
+    public float getWeight() {
+        return mWeight;
+    }
+
+    public boolean getValid() {
+        return mValid;
+    }
+
+    /*package*/ static ArrayList<Sample> fromColumns(long[] timeColumn, double[] valueColumn, float[] weightColumn, boolean[] validColumn) {
+        ArrayList<Sample> list = new ArrayList<Sample>(timeColumn.length);
+        for (int i = 0; i < timeColumn.length; ++i) {
+            list.add(new Sample(timeColumn[i], valueColumn[i], weightColumn[i], validColumn[i]));
+        }
+        return list;
+    }
+
+    /*package*/ static void toColumns(ArrayList<Sample> list, long[] timeColumn, double[] valueColumn, float[] weightColumn, boolean[] validColumn) {
+        for (int i = 0; i < timeColumn.length; ++i) {
+            Sample element = list.get(i);
+            timeColumn[i] = element.mTime;
+            valueColumn[i] = element.mValue;
+            weightColumn[i] = element.mWeight;
+            validColumn[i] = element.mValid;
+        }
+    }
+}
@@ -0,0 +1,64 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.NativeRefQueue;
+import com.dropbox.djinni.ScalarSlot;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public abstract class SampleFilter implements AutoCloseable {
+    /** Multiplies value and weight by factor, and clears valid if either is no longer finite. */
+    @Nonnull
+    public abstract Sample scale(@Nonnull Sample s, double factor);
+
+    public abstract double weighted(@Nonnull Sample s);
+
+    @CheckForNull
+    public static native SampleFilter create();
+
+    /**
+     * Releases the C++ object behind this instance now, instead of after it is garbage
+     * collected. The instance must not be used afterwards. Does nothing for Java implementations.
+     */
+    @Override
+    public void close() {}
+
+    private static final class CppProxy extends SampleFilter
+    {
+        private final long nativeRef;
+        private final NativeRefQueue.Ref queueRef;
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            this.queueRef = NativeRefQueue.register(this, nativeRef);
+        }
+
+        @Override
+        public void close()
+        {
+            queueRef.release();
+        }
+
+        @Override
+        public Sample scale(Sample s, double factor)
+        {
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
+            long[] _slot = ScalarSlot.get();
+            native_scale(this.nativeRef, s.getTime(), s.getValue(), s.getWeight(), s.getValid(), factor, _slot);
+            return new Sample(_slot[0], Double.longBitsToDouble(_slot[1]), Float.intBitsToFloat((int)_slot[2]), _slot[3] != 0);
+        }
+        private native void native_scale(long _nativeRef, long s_time, double s_value, float s_weight, boolean s_valid, double factor, long[] _slot);
+
+        @Override
+        public double weighted(Sample s)
+        {
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
+            return native_weighted(this.nativeRef, s.getTime(), s.getValue(), s.getWeight(), s.getValid());
+        }
+        private native double native_weighted(long _nativeRef, long s_time, double s_value, float s_weight, boolean s_valid);
+    }
+}
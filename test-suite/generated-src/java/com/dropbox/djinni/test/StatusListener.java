@@ -0,0 +1,16 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from coalesce.djinni
+
+package com.dropbox.djinni.test;
+
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Receives status updates from C++, which may come faster than Java can handle them. */
+public abstract class StatusListener {
+    /** An update made while another is waiting replaces it, so Java only sees the newest. */
+    public abstract void onStatus(@Nonnull String phase, int progress);
+
+    // Caches System.identityHashCode(this) for the native proxy cache.
+    private int djinniIdentityHash;
+}
@@ -0,0 +1,182 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.CallBatch;
+import com.dropbox.djinni.NativeRefQueue;
+import com.dropbox.djinni.WireReader;
+import com.dropbox.djinni.WireWriter;
+import java.util.ArrayList;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Keeps a running total and a list of labels. BatchTest records its calls with Tally.Batch. */
+public abstract class Tally implements AutoCloseable {
+    /** Adds amount to the total and returns the new total. Throws if amount is negative. */
+    public abstract long add(long amount);
+
+    /** Keeps the item's label, and returns how many labels are kept. */
+    public abstract int remember(@Nonnull WireSmall item);
+
+    @Nonnull
+    public abstract ArrayList<String> labels();
+
+    public abstract void clear();
+
+    /** Returns a new tally with the same contents. Not in Tally.Batch, which can't return interfaces. */
+    @CheckForNull
+    public abstract Tally fork();
+
+    @CheckForNull
+    public static native Tally create();
+
+    /**
+     * Releases the C++ object behind this instance now, instead of after it is garbage
+     * collected. The instance must not be used afterwards. Does nothing for Java implementations.
+     */
+    @Override
+    public void close() {}
+
+    /**
+     * Records calls to a Tally, which execute() makes in order with a single call into
+     * native code. Only methods whose arguments and result can be serialized can be recorded.
+     */
+    public static final class Batch extends CallBatch
+    {
+        private final CppProxy target;
+
+        public Batch(@Nonnull Tally target)
+        {
+            this.target = (CppProxy)target;
+        }
+
+        /** Adds amount to the total and returns the new total. Throws if amount is negative. */
+        @Nonnull
+        public CallBatch.Result<Long> add(long amount)
+        {
+            WireWriter writer = djinniRecord(0);
+            writer.writeI64(amount);
+            return djinniExpect(new CallBatch.Result<Long>() {
+                @Override
+                protected Long read(WireReader reader)
+                {
+                    long value = reader.readI64();
+                    return value;
+                }
+            });
+        }
+
+        /** Keeps the item's label, and returns how many labels are kept. */
+        @Nonnull
+        public CallBatch.Result<Integer> remember(@Nonnull WireSmall item)
+        {
+            WireWriter writer = djinniRecord(1);
+            item.writeWire(writer);
+            return djinniExpect(new CallBatch.Result<Integer>() {
+                @Override
+                protected Integer read(WireReader reader)
+                {
+                    int value = reader.readI32();
+                    return value;
+                }
+            });
+        }
+
+        @Nonnull
+        public CallBatch.Result<ArrayList<String>> labels()
+        {
+            djinniRecord(2);
+            return djinniExpect(new CallBatch.Result<ArrayList<String>>() {
+                @Override
+                protected ArrayList<String> read(WireReader reader)
+                {
+                    int valueSize = reader.readLength();
+                    ArrayList<String> value = new ArrayList<String>(valueSize);
+                    for (int valueIndex = 0; valueIndex < valueSize; ++valueIndex) {
+                        String valueElem = reader.readString();
+                        value.add(valueElem);
+                    }
+                    return value;
+                }
+            });
+        }
+
+        public void clear()
+        {
+            djinniRecord(3);
+        }
+
+        @Override
+        protected byte[] djinniExecute(byte[] calls)
+        {
+            return target.djinniExecuteBatch(calls);
+        }
+    }
+
+    private static final class CppProxy extends Tally
+    {
+        private final long nativeRef;
+        private final NativeRefQueue.Ref queueRef;
+
+        private CppProxy(long nativeRef)
+        {
+            if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
+            this.nativeRef = nativeRef;
+            this.queueRef = NativeRefQueue.register(this, nativeRef);
+        }
+
+        @Override
+        public void close()
+        {
+            queueRef.release();
+        }
+
+        @Override
+        public long add(long amount)
+        {
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
+            return native_add(this.nativeRef, amount);
+        }
+        private native long native_add(long _nativeRef, long amount);
+
+        @Override
+        public int remember(WireSmall item)
+        {
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
+            return native_remember(this.nativeRef, item);
+        }
+        private native int native_remember(long _nativeRef, WireSmall item);
+
+        @Override
+        public ArrayList<String> labels()
+        {
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
+            return native_labels(this.nativeRef);
+        }
+        private native ArrayList<String> native_labels(long _nativeRef);
+
+        @Override
+        public void clear()
+        {
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
+            native_clear(this.nativeRef);
+        }
+        private native void native_clear(long _nativeRef);
+
+        @Override
+        public Tally fork()
+        {
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
+            return native_fork(this.nativeRef);
+        }
+        private native Tally native_fork(long _nativeRef);
+
+        private byte[] djinniExecuteBatch(byte[] calls)
+        {
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
+            return native_djinniExecuteBatch(this.nativeRef, calls);
+        }
+        private native byte[] native_djinniExecuteBatch(long _nativeRef, byte[] calls);
+    }
+}
@@ -3,11 +3,11 @@
 
 package com.dropbox.djinni.test;
 
-import java.util.concurrent.atomic.AtomicBoolean;
+import com.dropbox.djinni.NativeRefQueue;
 import javax.annotation.CheckForNull;
 import javax.annotation.Nonnull;
 
-public abstract class TestDuration {
+public abstract class TestDuration implements AutoCloseable {
     @Nonnull
     public static native String hoursString(@Nonnull java.time.Duration dt);
 
@@ -67,27 +67,29 @@ public abstract class TestDuration {
 
     public static native long unbox(@CheckForNull java.time.Duration dt);
 
+    /**
+     * Releases the C++ object behind this instance now, instead of after it is garbage
+     * collected. The instance must not be used afterwards. Does nothing for Java implementations.
+     */
+    @Override
+    public void close() {}
+
     private static final class CppProxy extends TestDuration
     {
         private final long nativeRef;
-        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+        private final NativeRefQueue.Ref queueRef;
 
         private CppProxy(long nativeRef)
         {
             if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
             this.nativeRef = nativeRef;
+            this.queueRef = NativeRefQueue.register(this, nativeRef);
         }
 
-        private native void nativeDestroy(long nativeRef);
-        public void destroy()
-        {
-            boolean destroyed = this.destroyed.getAndSet(true);
-            if (!destroyed) nativeDestroy(this.nativeRef);
-        }
-        protected void finalize() throws java.lang.Throwable
+        @Override
+        public void close()
         {
-            destroy();
-            super.finalize();
+            queueRef.release();
         }
     }
 }
@@ -3,12 +3,13 @@
 
 package com.dropbox.djinni.test;
 
+import com.dropbox.djinni.NativeRefQueue;
+import java.nio.ByteBuffer;
 import java.util.HashMap;
-import java.util.concurrent.atomic.AtomicBoolean;
 import javax.annotation.CheckForNull;
 import javax.annotation.Nonnull;
 
-public abstract class TestHelpers {
+public abstract class TestHelpers implements AutoCloseable {
     @Nonnull
     public static native SetRecord getSetRecord();
 
@@ -19,6 +20,24 @@ public abstract class TestHelpers {
 
     public static native boolean checkPrimitiveList(@Nonnull PrimitiveList pl);
 
+    @Nonnull
+    public static native PrimitiveArrays getPrimitiveArrays();
+
+    public static native boolean checkPrimitiveArrays(@Nonnull PrimitiveArrays pa);
+
+    @Nonnull
+    public static native long[] reverseI64Array(@Nonnull long[] a);
+
+    /** C++ memory is filled with i % 256, and counted by live_buffer_count() until freed */
+    @Nonnull
+    public static native ByteBuffer makeBuffer(int size);
+
+    public static native long sumBuffer(@Nonnull ByteBuffer b);
+
+    public static native void fillBuffer(@Nonnull ByteBuffer b, byte value);
+
+    public static native int liveBufferCount();
+
     @Nonnull
     public static native NestedCollection getNestedCollection();
 
@@ -69,27 +88,29 @@ public abstract class TestHelpers {
     @Nonnull
     public static native byte[] idBinary(@Nonnull byte[] b);
 
+    /**
+     * Releases the C++ object behind this instance now, instead of after it is garbage
+     * collected. The instance must not be used afterwards. Does nothing for Java implementations.
+     */
+    @Override
+    public void close() {}
+
     private static final class CppProxy extends TestHelpers
     {
         private final long nativeRef;
-        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+        private final NativeRefQueue.Ref queueRef;
 
         private CppProxy(long nativeRef)
         {
             if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
             this.nativeRef = nativeRef;
+            this.queueRef = NativeRefQueue.register(this, nativeRef);
         }
 
-        private native void nativeDestroy(long nativeRef);
-        public void destroy()
-        {
-            boolean destroyed = this.destroyed.getAndSet(true);
-            if (!destroyed) nativeDestroy(this.nativeRef);
-        }
-        protected void finalize() throws java.lang.Throwable
+        @Override
+        public void close()
         {
-            destroy();
-            super.finalize();
+            queueRef.release();
         }
     }
 }
@@ -3,41 +3,46 @@
 
 package com.dropbox.djinni.test;
 
-import java.util.concurrent.atomic.AtomicBoolean;
+import com.dropbox.djinni.NativeRefQueue;
 import javax.annotation.CheckForNull;
 import javax.annotation.Nonnull;
 
-public abstract class Token {
+public abstract class Token implements AutoCloseable {
     @Nonnull
     public abstract String whoami();
 
+    /**
+     * Releases the C++ object behind this instance now, instead of after it is garbage
+     * collected. The instance must not be used afterwards. Does nothing for Java implementations.
+     */
+    @Override
+    public void close() {}
+
+    // Caches System.identityHashCode(this) for the native proxy cache.
+    private int djinniIdentityHash;
+
     private static final class CppProxy extends Token
     {
         private final long nativeRef;
-        private final AtomicBoolean destroyed = new AtomicBoolean(false);
+        private final NativeRefQueue.Ref queueRef;
 
         private CppProxy(long nativeRef)
         {
             if (nativeRef == 0) throw new RuntimeException("nativeRef is zero");
             this.nativeRef = nativeRef;
+            this.queueRef = NativeRefQueue.register(this, nativeRef);
         }
 
-        private native void nativeDestroy(long nativeRef);
-        public void destroy()
-        {
-            boolean destroyed = this.destroyed.getAndSet(true);
-            if (!destroyed) nativeDestroy(this.nativeRef);
-        }
-        protected void finalize() throws java.lang.Throwable
+        @Override
+        public void close()
         {
-            destroy();
-            super.finalize();
+            queueRef.release();
         }
 
         @Override
         public String whoami()
         {
-            assert !this.destroyed.get() : "trying to use a destroyed object";
+            assert !this.queueRef.isReleased() : "trying to use a destroyed object";
             return native_whoami(this.nativeRef);
         }
         private native String native_whoami(long _nativeRef);
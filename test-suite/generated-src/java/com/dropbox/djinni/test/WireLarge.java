@@ -0,0 +1,155 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.WireReader;
+import com.dropbox.djinni.WireWriter;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.HashSet;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public final class WireLarge {
+
+
+    /*package*/ final WireMedium mHeader;
+
+    /*package*/ final ArrayList<WireSmall> mItems;
+
+    /*package*/ final HashMap<String, Integer> mAttributes;
+
+    /*package*/ final HashSet<Long> mMembers;
+
+    /*package*/ final byte[] mPayload;
+
+    /*package*/ final double[] mWeights;
+
+    /*package*/ final String mNote;
+
+    public WireLarge(
+            @Nonnull WireMedium header,
+            @Nonnull ArrayList<WireSmall> items,
+            @Nonnull HashMap<String, Integer> attributes,
+            @Nonnull HashSet<Long> members,
+            @Nonnull byte[] payload,
+            @Nonnull double[] weights,
+            @CheckForNull String note) {
+        this.mHeader = header;
+        this.mItems = items;
+        this.mAttributes = attributes;
+        this.mMembers = members;
+        this.mPayload = payload;
+        this.mWeights = weights;
+        this.mNote = note;
+    }
+
+    @Nonnull
+    public WireMedium getHeader() {
+        return mHeader;
+    }
+
+    @Nonnull
+    public ArrayList<WireSmall> getItems() {
+        return mItems;
+    }
+
+    @Nonnull
+    public HashMap<String, Integer> getAttributes() {
+        return mAttributes;
+    }
+
+    @Nonnull
+    public HashSet<Long> getMembers() {
+        return mMembers;
+    }
+
+    @Nonnull
+    public byte[] getPayload() {
+        return mPayload;
+    }
+
+    @Nonnull
+    public double[] getWeights() {
+        return mWeights;
+    }
+
+    @CheckForNull
+    public String getNote() {
+        return mNote;
+    }
+
+    /*package*/ byte[] toWire() {
+        WireWriter writer = WireWriter.begin();
+        writeWire(writer);
+        return writer.finish();
+    }
+
+    /*package*/ static WireLarge fromWire(byte[] message) {
+        return readWire(new WireReader(message));
+    }
+
+    /*package*/ void writeWire(WireWriter writer) {
+        this.mHeader.writeWire(writer);
+        writer.writeLength(this.mItems.size());
+        for (WireSmall itemsElem : this.mItems) {
+            itemsElem.writeWire(writer);
+        }
+        writer.writeLength(this.mAttributes.size());
+        for (java.util.Map.Entry<String, Integer> attributesEntry : this.mAttributes.entrySet()) {
+            writer.writeString(attributesEntry.getKey());
+            writer.writeI32(attributesEntry.getValue());
+        }
+        writer.writeLength(this.mMembers.size());
+        for (long membersElem : this.mMembers) {
+            writer.writeI64(membersElem);
+        }
+        writer.writeBinary(this.mPayload);
+        writer.writeLength(this.mWeights.length);
+        for (double weightsElem : this.mWeights) {
+            writer.writeF64(weightsElem);
+        }
+        if (this.mNote == null) {
+            writer.writeBool(false);
+        } else {
+            writer.writeBool(true);
+            writer.writeString(this.mNote);
+        }
+    }
+
+    /*package*/ static WireLarge readWire(WireReader reader) {
+        WireMedium header = WireMedium.readWire(reader);
+        int itemsSize = reader.readLength();
+        ArrayList<WireSmall> items = new ArrayList<WireSmall>(itemsSize);
+        for (int itemsIndex = 0; itemsIndex < itemsSize; ++itemsIndex) {
+            WireSmall itemsElem = WireSmall.readWire(reader);
+            items.add(itemsElem);
+        }
+        int attributesSize = reader.readLength();
+        HashMap<String, Integer> attributes = new HashMap<String, Integer>(attributesSize);
+        for (int attributesIndex = 0; attributesIndex < attributesSize; ++attributesIndex) {
+            String attributesKey = reader.readString();
+            int attributesValue = reader.readI32();
+            attributes.put(attributesKey, attributesValue);
+        }
+        int membersSize = reader.readLength();
+        HashSet<Long> members = new HashSet<Long>(membersSize);
+        for (int membersIndex = 0; membersIndex < membersSize; ++membersIndex) {
+            long membersElem = reader.readI64();
+            members.add(membersElem);
+        }
+        byte[] payload = reader.readBinary();
+        double[] weights = new double[reader.readLength()];
+        for (int weightsIndex = 0; weightsIndex < weights.length; ++weightsIndex) {
+            double weightsElem = reader.readF64();
+            weights[weightsIndex] = weightsElem;
+        }
+        String note = null;
+        if (reader.readBool()) {
+            String noteValue = reader.readString();
+            note = noteValue;
+        }
+        return new WireLarge(header, items, attributes, members, payload, weights, note);
+    }
+}
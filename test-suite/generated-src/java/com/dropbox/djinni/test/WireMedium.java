@@ -0,0 +1,117 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.WireReader;
+import com.dropbox.djinni.WireWriter;
+import java.util.ArrayList;
+import java.util.Date;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+public final class WireMedium {
+
+
+    /*package*/ final long mSerial;
+
+    /*package*/ final String mName;
+
+    /*package*/ final ArrayList<String> mTags;
+
+    /*package*/ final Float mRating;
+
+    /*package*/ final Color mShade;
+
+    /*package*/ final Date mCreated;
+
+    public WireMedium(
+            long serial,
+            @Nonnull String name,
+            @Nonnull ArrayList<String> tags,
+            @CheckForNull Float rating,
+            @Nonnull Color shade,
+            @Nonnull Date created) {
+        this.mSerial = serial;
+        this.mName = name;
+        this.mTags = tags;
+        this.mRating = rating;
+        this.mShade = shade;
+        this.mCreated = created;
+    }
+
+    public long getSerial() {
+        return mSerial;
+    }
+
+    @Nonnull
+    public String getName() {
+        return mName;
+    }
+
+    @Nonnull
+    public ArrayList<String> getTags() {
+        return mTags;
+    }
+
+    @CheckForNull
+    public Float getRating() {
+        return mRating;
+    }
+
+    @Nonnull
+    public Color getShade() {
+        return mShade;
+    }
+
+    @Nonnull
+    public Date getCreated() {
+        return mCreated;
+    }
+
+    /*package*/ byte[] toWire() {
+        WireWriter writer = WireWriter.begin();
+        writeWire(writer);
+        return writer.finish();
+    }
+
+    /*package*/ static WireMedium fromWire(byte[] message) {
+        return readWire(new WireReader(message));
+    }
+
+    /*package*/ void writeWire(WireWriter writer) {
+        writer.writeI64(this.mSerial);
+        writer.writeString(this.mName);
+        writer.writeLength(this.mTags.size());
+        for (String tagsElem : this.mTags) {
+            writer.writeString(tagsElem);
+        }
+        if (this.mRating == null) {
+            writer.writeBool(false);
+        } else {
+            writer.writeBool(true);
+            writer.writeF32(this.mRating);
+        }
+        writer.writeLength(this.mShade.ordinal());
+        writer.writeDate(this.mCreated);
+    }
+
+    /*package*/ static WireMedium readWire(WireReader reader) {
+        long serial = reader.readI64();
+        String name = reader.readString();
+        int tagsSize = reader.readLength();
+        ArrayList<String> tags = new ArrayList<String>(tagsSize);
+        for (int tagsIndex = 0; tagsIndex < tagsSize; ++tagsIndex) {
+            String tagsElem = reader.readString();
+            tags.add(tagsElem);
+        }
+        Float rating = null;
+        if (reader.readBool()) {
+            float ratingValue = reader.readF32();
+            rating = ratingValue;
+        }
+        Color shade = Color.values()[reader.readLength()];
+        Date created = reader.readDate();
+        return new WireMedium(serial, name, tags, rating, shade, created);
+    }
+}
@@ -0,0 +1,65 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+package com.dropbox.djinni.test;
+
+import com.dropbox.djinni.WireReader;
+import com.dropbox.djinni.WireWriter;
+import javax.annotation.CheckForNull;
+import javax.annotation.Nonnull;
+
+/** Crosses JNI as a single byte array; the plain_ records below have the same fields and are marshalled field by field. */
+public final class WireSmall {
+
+
+    /*package*/ final long mSerial;
+
+    /*package*/ final String mLabel;
+
+    /*package*/ final double mScore;
+
+    public WireSmall(
+            long serial,
+            @Nonnull String label,
+            double score) {
+        this.mSerial = serial;
+        this.mLabel = label;
+        this.mScore = score;
+    }
+
+    public long getSerial() {
+        return mSerial;
+    }
+
+    @Nonnull
+    public String getLabel() {
+        return mLabel;
+    }
+
+    public double getScore() {
+        return mScore;
+    }
+
+    /*package*/ byte[] toWire() {
+        WireWriter writer = WireWriter.begin();
+        writeWire(writer);
+        return writer.finish();
+    }
+
+    /*package*/ static WireSmall fromWire(byte[] message) {
+        return readWire(new WireReader(message));
+    }
+
+    /*package*/ void writeWire(WireWriter writer) {
+        writer.writeI64(this.mSerial);
+        writer.writeString(this.mLabel);
+        writer.writeF64(this.mScore);
+    }
+
+    /*package*/ static WireSmall readWire(WireReader reader) {
+        long serial = reader.readI64();
+        String label = reader.readString();
+        double score = reader.readF64();
+        return new WireSmall(serial, label, score);
+    }
+}
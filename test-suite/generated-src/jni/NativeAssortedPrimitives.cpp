@@ -11,7 +11,10 @@ NativeAssortedPrimitives::NativeAssortedPrimitives() = default;
 NativeAssortedPrimitives::~NativeAssortedPrimitives() = default;
 
 auto NativeAssortedPrimitives::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeAssortedPrimitives>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeAssortedPrimitives>::get());
+}
+
+auto NativeAssortedPrimitives::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeAssortedPrimitives& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::Bool::fromCpp(jniEnv, c.b)),
                                                            ::djinni::get(::djinni::I8::fromCpp(jniEnv, c.eight)),
@@ -32,9 +35,12 @@ auto NativeAssortedPrimitives::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::dj
 }
 
 auto NativeAssortedPrimitives::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 15);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeAssortedPrimitives>::get());
+}
+
+auto NativeAssortedPrimitives::toCpp(JNIEnv* jniEnv, JniType j, const NativeAssortedPrimitives& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeAssortedPrimitives>::get();
     return {::djinni::Bool::toCpp(jniEnv, jniEnv->GetBooleanField(j, data.field_mB)),
             ::djinni::I8::toCpp(jniEnv, jniEnv->GetByteField(j, data.field_mEight)),
             ::djinni::I16::toCpp(jniEnv, jniEnv->GetShortField(j, data.field_mSixteen)),
@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeAssortedPrimitives final {
+class NativeAssortedPrimitives final : public ::djinni::JniRecord<NativeAssortedPrimitives> {
 public:
     using CppType = ::AssortedPrimitives;
     using JniType = jobject;
 
     using Boxed = NativeAssortedPrimitives;
 
+    static constexpr jint kLocalRefsPerRecord = 15;
+
     ~NativeAssortedPrimitives();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeAssortedPrimitives& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeAssortedPrimitives& data);
 
 private:
     NativeAssortedPrimitives();
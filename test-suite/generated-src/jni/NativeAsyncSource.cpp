@@ -0,0 +1,27 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+#include "NativeAsyncSource.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeAsyncSource::NativeAsyncSource() : ::djinni::JniInterface<::AsyncSource, NativeAsyncSource>() {}
+
+NativeAsyncSource::~NativeAsyncSource() = default;
+
+NativeAsyncSource::JavaProxy::JavaProxy(JniType j) : JavaProxyCacheEntry(j) { }
+
+NativeAsyncSource::JavaProxy::~JavaProxy() = default;
+
+::djinni::SharedFuture<std::string> NativeAsyncSource::JavaProxy::fetch(const std::string & c_key) {
+    auto jniEnv = ::djinni::jniGetThreadEnv();
+    ::djinni::JniLocalScope jscope(jniEnv, 10);
+    const auto& data = ::djinni::JniClass<::djinni_generated::NativeAsyncSource>::get();
+    auto jret = jniEnv->CallObjectMethod(getGlobalRef(), data.method_fetch,
+                                         ::djinni::get(::djinni::String::fromCpp(jniEnv, c_key)));
+    ::djinni::jniExceptionCheck(jniEnv);
+    return ::djinni::Future<::djinni::String>::toCpp(jniEnv, jret);
+}
+
+}  // namespace djinni_generated
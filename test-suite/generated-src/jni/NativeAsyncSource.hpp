@@ -0,0 +1,47 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+#pragma once
+
+#include "async_source.hpp"
+#include "djinni_support.hpp"
+
+namespace djinni_generated {
+
+class NativeAsyncSource final : ::djinni::JniInterface<::AsyncSource, NativeAsyncSource> {
+public:
+    using CppType = std::shared_ptr<::AsyncSource>;
+    using JniType = jobject;
+
+    using Boxed = NativeAsyncSource;
+
+    ~NativeAsyncSource();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeAsyncSource>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeAsyncSource>::get()._toJava(jniEnv, c)}; }
+
+private:
+    NativeAsyncSource();
+    friend ::djinni::JniClass<NativeAsyncSource>;
+    friend ::djinni::JniInterface<::AsyncSource, NativeAsyncSource>;
+
+    class JavaProxy final : ::djinni::JavaProxyCacheEntry, public ::AsyncSource
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        ::djinni::SharedFuture<std::string> fetch(const std::string & key) override;
+
+    private:
+        using ::djinni::JavaProxyCacheEntry::getGlobalRef;
+        friend ::djinni::JniInterface<::AsyncSource, ::djinni_generated::NativeAsyncSource>;
+        friend ::djinni::JavaProxyCache<JavaProxy>;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/AsyncSource") };
+    const jfieldID field_djinniIdentityHash { ::djinni::jniGetFieldID(clazz.get(), "djinniIdentityHash", "I") };
+    const jmethodID method_fetch { ::djinni::jniGetMethodID(clazz.get(), "fetch", "(Ljava/lang/String;)Ljava/util/concurrent/CompletableFuture;") };
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,69 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+#include "NativeAsyncWorker.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeAsyncSource.hpp"
+#include "NativeAsyncWorker.hpp"
+
+namespace djinni_generated {
+
+NativeAsyncWorker::NativeAsyncWorker() : ::djinni::JniInterface<::AsyncWorker, NativeAsyncWorker>("com/dropbox/djinni/test/AsyncWorker$CppProxy") {}
+
+NativeAsyncWorker::~NativeAsyncWorker() = default;
+
+
+static jobject JNICALL Java_com_dropbox_djinni_test_AsyncWorker_create(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto r = ::AsyncWorker::create();
+        return ::djinni::release(::djinni_generated::NativeAsyncWorker::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static jobject JNICALL Java_com_dropbox_djinni_test_AsyncWorker_00024CppProxy_native_1add(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jlong j_a, jlong j_b)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::CppProxyHandle<::AsyncWorker>::get(nativeRef);
+        auto r = ref->add(::djinni::I64::toCpp(jniEnv, j_a),
+                          ::djinni::I64::toCpp(jniEnv, j_b));
+        return ::djinni::release(::djinni::Future<::djinni::I64>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static jobject JNICALL Java_com_dropbox_djinni_test_AsyncWorker_00024CppProxy_native_1reverse(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jstring j_s)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::CppProxyHandle<::AsyncWorker>::get(nativeRef);
+        auto r = ref->reverse(::djinni::String::toCpp(jniEnv, j_s));
+        return ::djinni::release(::djinni::Future<::djinni::String>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static jobject JNICALL Java_com_dropbox_djinni_test_AsyncWorker_00024CppProxy_native_1measure(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_source, jstring j_key)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::CppProxyHandle<::AsyncWorker>::get(nativeRef);
+        auto r = ref->measure(::djinni_generated::NativeAsyncSource::toCpp(jniEnv, j_source),
+                              ::djinni::String::toCpp(jniEnv, j_key));
+        return ::djinni::release(::djinni::Future<::djinni::I32>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static const JNINativeMethod s_staticNatives[] = {
+    { const_cast<char*>("create"), const_cast<char*>("()Lcom/dropbox/djinni/test/AsyncWorker;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_AsyncWorker_create) },
+};
+static const ::djinni::JniNativeMethods s_staticNatives_registration("com/dropbox/djinni/test/AsyncWorker", s_staticNatives);
+
+static const JNINativeMethod s_cppProxyNatives[] = {
+    { const_cast<char*>("native_add"), const_cast<char*>("(JJJ)Ljava/util/concurrent/CompletableFuture;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_AsyncWorker_00024CppProxy_native_1add) },
+    { const_cast<char*>("native_reverse"), const_cast<char*>("(JLjava/lang/String;)Ljava/util/concurrent/CompletableFuture;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_AsyncWorker_00024CppProxy_native_1reverse) },
+    { const_cast<char*>("native_measure"), const_cast<char*>("(JLcom/dropbox/djinni/test/AsyncSource;Ljava/lang/String;)Ljava/util/concurrent/CompletableFuture;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_AsyncWorker_00024CppProxy_native_1measure) },
+};
+static const ::djinni::JniNativeMethods s_cppProxyNatives_registration("com/dropbox/djinni/test/AsyncWorker$CppProxy", s_cppProxyNatives);
+
+}  // namespace djinni_generated
@@ -0,0 +1,30 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+#pragma once
+
+#include "async_worker.hpp"
+#include "djinni_support.hpp"
+
+namespace djinni_generated {
+
+class NativeAsyncWorker final : ::djinni::JniInterface<::AsyncWorker, NativeAsyncWorker> {
+public:
+    using CppType = std::shared_ptr<::AsyncWorker>;
+    using JniType = jobject;
+
+    using Boxed = NativeAsyncWorker;
+
+    ~NativeAsyncWorker();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeAsyncWorker>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeAsyncWorker>::get()._toJava(jniEnv, c)}; }
+
+private:
+    NativeAsyncWorker();
+    friend ::djinni::JniClass<NativeAsyncWorker>;
+    friend ::djinni::JniInterface<::AsyncWorker, NativeAsyncWorker>;
+
+};
+
+}  // namespace djinni_generated
@@ -11,7 +11,10 @@ NativeClientReturnedRecord::NativeClientReturnedRecord() = default;
 NativeClientReturnedRecord::~NativeClientReturnedRecord() = default;
 
 auto NativeClientReturnedRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeClientReturnedRecord>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeClientReturnedRecord>::get());
+}
+
+auto NativeClientReturnedRecord::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeClientReturnedRecord& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.record_id)),
                                                            ::djinni::get(::djinni::String::fromCpp(jniEnv, c.content)),
@@ -21,9 +24,12 @@ auto NativeClientReturnedRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::
 }
 
 auto NativeClientReturnedRecord::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 4);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeClientReturnedRecord>::get());
+}
+
+auto NativeClientReturnedRecord::toCpp(JNIEnv* jniEnv, JniType j, const NativeClientReturnedRecord& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeClientReturnedRecord>::get();
     return {::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mRecordId)),
             ::djinni::String::toCpp(jniEnv, (jstring)jniEnv->GetObjectField(j, data.field_mContent)),
             ::djinni::Optional<std::experimental::optional, ::djinni::String>::toCpp(jniEnv, (jstring)jniEnv->GetObjectField(j, data.field_mMisc))};
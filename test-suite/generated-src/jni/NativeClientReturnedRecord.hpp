@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeClientReturnedRecord final {
+class NativeClientReturnedRecord final : public ::djinni::JniRecord<NativeClientReturnedRecord> {
 public:
     using CppType = ::ClientReturnedRecord;
     using JniType = jobject;
 
     using Boxed = NativeClientReturnedRecord;
 
+    static constexpr jint kLocalRefsPerRecord = 4;
+
     ~NativeClientReturnedRecord();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeClientReturnedRecord& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeClientReturnedRecord& data);
 
 private:
     NativeClientReturnedRecord();
@@ -11,7 +11,10 @@ NativeConstants::NativeConstants() = default;
 NativeConstants::~NativeConstants() = default;
 
 auto NativeConstants::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeConstants>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeConstants>::get());
+}
+
+auto NativeConstants::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeConstants& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::I32::fromCpp(jniEnv, c.some_integer)),
                                                            ::djinni::get(::djinni::String::fromCpp(jniEnv, c.some_string)))};
@@ -20,9 +23,12 @@ auto NativeConstants::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::Loc
 }
 
 auto NativeConstants::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 3);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeConstants>::get());
+}
+
+auto NativeConstants::toCpp(JNIEnv* jniEnv, JniType j, const NativeConstants& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeConstants>::get();
     return {::djinni::I32::toCpp(jniEnv, jniEnv->GetIntField(j, data.field_mSomeInteger)),
             ::djinni::String::toCpp(jniEnv, (jstring)jniEnv->GetObjectField(j, data.field_mSomeString))};
 }
@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeConstants final {
+class NativeConstants final : public ::djinni::JniRecord<NativeConstants> {
 public:
     using CppType = ::Constants;
     using JniType = jobject;
 
     using Boxed = NativeConstants;
 
+    static constexpr jint kLocalRefsPerRecord = 3;
+
     ~NativeConstants();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeConstants& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeConstants& data);
 
 private:
     NativeConstants();
@@ -11,15 +11,7 @@ NativeConstantsInterface::NativeConstantsInterface() : ::djinni::JniInterface<::
 NativeConstantsInterface::~NativeConstantsInterface() = default;
 
 
-CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_ConstantsInterface_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
-{
-    try {
-        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
-        delete reinterpret_cast<djinni::CppProxyHandle<::ConstantsInterface>*>(nativeRef);
-    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
-}
-
-CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_ConstantsInterface_00024CppProxy_native_1dummy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+static void JNICALL Java_com_dropbox_djinni_test_ConstantsInterface_00024CppProxy_native_1dummy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
@@ -28,4 +20,9 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_ConstantsInterface_00024Cpp
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
+static const JNINativeMethod s_cppProxyNatives[] = {
+    { const_cast<char*>("native_dummy"), const_cast<char*>("(J)V"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_ConstantsInterface_00024CppProxy_native_1dummy) },
+};
+static const ::djinni::JniNativeMethods s_cppProxyNatives_registration("com/dropbox/djinni/test/ConstantsInterface$CppProxy", s_cppProxyNatives);
+
 }  // namespace djinni_generated
@@ -12,15 +12,7 @@ NativeCppException::NativeCppException() : ::djinni::JniInterface<::CppException
 NativeCppException::~NativeCppException() = default;
 
 
-CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CppException_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
-{
-    try {
-        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
-        delete reinterpret_cast<djinni::CppProxyHandle<::CppException>*>(nativeRef);
-    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
-}
-
-CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_CppException_00024CppProxy_native_1throwAnException(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+static jint JNICALL Java_com_dropbox_djinni_test_CppException_00024CppProxy_native_1throwAnException(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
@@ -30,7 +22,7 @@ CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_CppException_00024CppProxy_
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_CppException_get(JNIEnv* jniEnv, jobject /*this*/)
+static jobject JNICALL Java_com_dropbox_djinni_test_CppException_get(JNIEnv* jniEnv, jobject /*this*/)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -39,4 +31,14 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_CppException_get(JNIEnv*
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+static const JNINativeMethod s_staticNatives[] = {
+    { const_cast<char*>("get"), const_cast<char*>("()Lcom/dropbox/djinni/test/CppException;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_CppException_get) },
+};
+static const ::djinni::JniNativeMethods s_staticNatives_registration("com/dropbox/djinni/test/CppException", s_staticNatives);
+
+static const JNINativeMethod s_cppProxyNatives[] = {
+    { const_cast<char*>("native_throwAnException"), const_cast<char*>("(J)I"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_CppException_00024CppProxy_native_1throwAnException) },
+};
+static const ::djinni::JniNativeMethods s_cppProxyNatives_registration("com/dropbox/djinni/test/CppException$CppProxy", s_cppProxyNatives);
+
 }  // namespace djinni_generated
@@ -11,7 +11,10 @@ NativeDateRecord::NativeDateRecord() = default;
 NativeDateRecord::~NativeDateRecord() = default;
 
 auto NativeDateRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeDateRecord>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeDateRecord>::get());
+}
+
+auto NativeDateRecord::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeDateRecord& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::Date::fromCpp(jniEnv, c.created_at)))};
     ::djinni::jniExceptionCheck(jniEnv);
@@ -19,9 +22,12 @@ auto NativeDateRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::Lo
 }
 
 auto NativeDateRecord::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 2);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeDateRecord>::get());
+}
+
+auto NativeDateRecord::toCpp(JNIEnv* jniEnv, JniType j, const NativeDateRecord& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeDateRecord>::get();
     return {::djinni::Date::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mCreatedAt))};
 }
 
@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeDateRecord final {
+class NativeDateRecord final : public ::djinni::JniRecord<NativeDateRecord> {
 public:
     using CppType = ::DateRecord;
     using JniType = jobject;
 
     using Boxed = NativeDateRecord;
 
+    static constexpr jint kLocalRefsPerRecord = 2;
+
     ~NativeDateRecord();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeDateRecord& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeDateRecord& data);
 
 private:
     NativeDateRecord();
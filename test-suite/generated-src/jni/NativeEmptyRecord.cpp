@@ -10,17 +10,26 @@ NativeEmptyRecord::NativeEmptyRecord() = default;
 NativeEmptyRecord::~NativeEmptyRecord() = default;
 
 auto NativeEmptyRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeEmptyRecord>::get());
+}
+
+auto NativeEmptyRecord::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeEmptyRecord& data) -> ::djinni::LocalRef<JniType> {
     (void)c; // Suppress warnings in release builds for empty records
-    const auto& data = ::djinni::JniClass<NativeEmptyRecord>::get();
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor)};
     ::djinni::jniExceptionCheck(jniEnv);
     return r;
 }
 
 auto NativeEmptyRecord::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 1);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeEmptyRecord>::get());
+}
+
+auto NativeEmptyRecord::toCpp(JNIEnv* jniEnv, JniType j, const NativeEmptyRecord& data) -> CppType {
     assert(j != nullptr);
     (void)j; // Suppress warnings in release builds for empty records
+    (void)data;
+    (void)jniEnv;
     return {};
 }
 
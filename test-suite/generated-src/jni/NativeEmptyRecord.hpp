@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeEmptyRecord final {
+class NativeEmptyRecord final : public ::djinni::JniRecord<NativeEmptyRecord> {
 public:
     using CppType = ::EmptyRecord;
     using JniType = jobject;
 
     using Boxed = NativeEmptyRecord;
 
+    static constexpr jint kLocalRefsPerRecord = 1;
+
     ~NativeEmptyRecord();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeEmptyRecord& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeEmptyRecord& data);
 
 private:
     NativeEmptyRecord();
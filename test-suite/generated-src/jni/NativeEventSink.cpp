@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from oneway.djinni
+
+#include "NativeEventSink.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeEventSink::NativeEventSink() : ::djinni::JniInterface<::EventSink, NativeEventSink>() {}
+
+NativeEventSink::~NativeEventSink() = default;
+
+NativeEventSink::JavaProxy::JavaProxy(JniType j) : JavaProxyCacheEntry(j) { }
+
+NativeEventSink::JavaProxy::~JavaProxy() = default;
+
+void NativeEventSink::JavaProxy::on_event(const std::string & c_source, int32_t c_value) {
+    auto self = shared_from_this();
+    ::djinni::JniOnewayQueue::post([self, c_source, c_value](JNIEnv* jniEnv) {
+        ::djinni::JniLocalScope jscope(jniEnv, 10);
+        const auto& data = ::djinni::JniClass<::djinni_generated::NativeEventSink>::get();
+        jniEnv->CallVoidMethod(self->getGlobalRef(), data.method_onEvent,
+                               ::djinni::get(::djinni::String::fromCpp(jniEnv, c_source)),
+                               ::djinni::get(::djinni::I32::fromCpp(jniEnv, c_value)));
+        ::djinni::jniExceptionCheck(jniEnv);
+    });
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,47 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from oneway.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "event_sink.hpp"
+
+namespace djinni_generated {
+
+class NativeEventSink final : ::djinni::JniInterface<::EventSink, NativeEventSink> {
+public:
+    using CppType = std::shared_ptr<::EventSink>;
+    using JniType = jobject;
+
+    using Boxed = NativeEventSink;
+
+    ~NativeEventSink();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeEventSink>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeEventSink>::get()._toJava(jniEnv, c)}; }
+
+private:
+    NativeEventSink();
+    friend ::djinni::JniClass<NativeEventSink>;
+    friend ::djinni::JniInterface<::EventSink, NativeEventSink>;
+
+    class JavaProxy final : ::djinni::JavaProxyCacheEntry, public ::EventSink, public std::enable_shared_from_this<JavaProxy>
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        void on_event(const std::string & source, int32_t value) override;
+
+    private:
+        using ::djinni::JavaProxyCacheEntry::getGlobalRef;
+        friend ::djinni::JniInterface<::EventSink, ::djinni_generated::NativeEventSink>;
+        friend ::djinni::JavaProxyCache<JavaProxy>;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/EventSink") };
+    const jfieldID field_djinniIdentityHash { ::djinni::jniGetFieldID(clazz.get(), "djinniIdentityHash", "I") };
+    const jmethodID method_onEvent { ::djinni::jniGetMethodID(clazz.get(), "onEvent", "(Ljava/lang/String;I)V") };
+};
+
+}  // namespace djinni_generated
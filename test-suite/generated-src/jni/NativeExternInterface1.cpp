@@ -12,15 +12,7 @@ NativeExternInterface1::NativeExternInterface1() : ::djinni::JniInterface<::Exte
 NativeExternInterface1::~NativeExternInterface1() = default;
 
 
-CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_ExternInterface1_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
-{
-    try {
-        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
-        delete reinterpret_cast<djinni::CppProxyHandle<::ExternInterface1>*>(nativeRef);
-    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
-}
-
-CJNIEXPORT ::djinni_generated::NativeClientReturnedRecord::JniType JNICALL Java_com_dropbox_djinni_test_ExternInterface1_00024CppProxy_native_1foo(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, ::djinni_generated::NativeClientInterface::JniType j_i)
+static ::djinni_generated::NativeClientReturnedRecord::JniType JNICALL Java_com_dropbox_djinni_test_ExternInterface1_00024CppProxy_native_1foo(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, ::djinni_generated::NativeClientInterface::JniType j_i)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
@@ -30,4 +22,9 @@ CJNIEXPORT ::djinni_generated::NativeClientReturnedRecord::JniType JNICALL Java_
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+static const JNINativeMethod s_cppProxyNatives[] = {
+    { const_cast<char*>("native_foo"), const_cast<char*>("(JLcom/dropbox/djinni/test/ClientInterface;)Lcom/dropbox/djinni/test/ClientReturnedRecord;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_ExternInterface1_00024CppProxy_native_1foo) },
+};
+static const ::djinni::JniNativeMethods s_cppProxyNatives_registration("com/dropbox/djinni/test/ExternInterface1$CppProxy", s_cppProxyNatives);
+
 }  // namespace djinni_generated
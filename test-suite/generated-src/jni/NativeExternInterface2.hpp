@@ -40,6 +40,7 @@ private:
     };
 
     const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/ExternInterface2") };
+    const jfieldID field_djinniIdentityHash { ::djinni::jniGetFieldID(clazz.get(), "djinniIdentityHash", "I") };
     const jmethodID method_foo { ::djinni::jniGetMethodID(clazz.get(), "foo", "(Lcom/dropbox/djinni/test/TestHelpers;)Lcom/dropbox/djinni/test/ExternRecordWithDerivings;") };
 };
 
@@ -12,7 +12,10 @@ NativeExternRecordWithDerivings::NativeExternRecordWithDerivings() = default;
 NativeExternRecordWithDerivings::~NativeExternRecordWithDerivings() = default;
 
 auto NativeExternRecordWithDerivings::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeExternRecordWithDerivings>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeExternRecordWithDerivings>::get());
+}
+
+auto NativeExternRecordWithDerivings::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeExternRecordWithDerivings& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni_generated::NativeRecordWithDerivings::fromCpp(jniEnv, c.member)),
                                                            ::djinni::get(::djinni_generated::NativeColor::fromCpp(jniEnv, c.e)))};
@@ -21,9 +24,12 @@ auto NativeExternRecordWithDerivings::fromCpp(JNIEnv* jniEnv, const CppType& c)
 }
 
 auto NativeExternRecordWithDerivings::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 3);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeExternRecordWithDerivings>::get());
+}
+
+auto NativeExternRecordWithDerivings::toCpp(JNIEnv* jniEnv, JniType j, const NativeExternRecordWithDerivings& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeExternRecordWithDerivings>::get();
     return {::djinni_generated::NativeRecordWithDerivings::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mMember)),
             ::djinni_generated::NativeColor::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mE))};
 }
@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeExternRecordWithDerivings final {
+class NativeExternRecordWithDerivings final : public ::djinni::JniRecord<NativeExternRecordWithDerivings> {
 public:
     using CppType = ::ExternRecordWithDerivings;
     using JniType = jobject;
 
     using Boxed = NativeExternRecordWithDerivings;
 
+    static constexpr jint kLocalRefsPerRecord = 3;
+
     ~NativeExternRecordWithDerivings();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeExternRecordWithDerivings& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeExternRecordWithDerivings& data);
 
 private:
     NativeExternRecordWithDerivings();
@@ -0,0 +1,51 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#include "NativeFlatItem.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeColor.hpp"
+
+namespace djinni_generated {
+
+NativeFlatItem::NativeFlatItem() = default;
+
+NativeFlatItem::~NativeFlatItem() = default;
+
+auto NativeFlatItem::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeFlatItem>::get());
+}
+
+auto NativeFlatItem::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeFlatItem& data) -> ::djinni::LocalRef<JniType> {
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.serial)),
+                                                           ::djinni::get(::djinni::Bool::fromCpp(jniEnv, c.flag)),
+                                                           ::djinni::get(::djinni::I16::fromCpp(jniEnv, c.rank)),
+                                                           ::djinni::get(::djinni_generated::NativeColor::fromCpp(jniEnv, c.shade)),
+                                                           ::djinni::get(::djinni::String::fromCpp(jniEnv, c.name)),
+                                                           ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni::F64>::fromCpp(jniEnv, c.score)),
+                                                           ::djinni::get(::djinni::Date::fromCpp(jniEnv, c.created)),
+                                                           ::djinni::get(::djinni::Binary::fromCpp(jniEnv, c.thumbnail)),
+                                                           ::djinni::get(::djinni::List<::djinni::String>::fromCpp(jniEnv, c.tags)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeFlatItem::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeFlatItem>::get());
+}
+
+auto NativeFlatItem::toCpp(JNIEnv* jniEnv, JniType j, const NativeFlatItem& data) -> CppType {
+    assert(j != nullptr);
+    return {::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mSerial)),
+            ::djinni::Bool::toCpp(jniEnv, jniEnv->GetBooleanField(j, data.field_mFlag)),
+            ::djinni::I16::toCpp(jniEnv, jniEnv->GetShortField(j, data.field_mRank)),
+            ::djinni_generated::NativeColor::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mShade)),
+            ::djinni::String::toCpp(jniEnv, (jstring)jniEnv->GetObjectField(j, data.field_mName)),
+            ::djinni::Optional<std::experimental::optional, ::djinni::F64>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mScore)),
+            ::djinni::Date::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mCreated)),
+            ::djinni::Binary::toCpp(jniEnv, (jbyteArray)jniEnv->GetObjectField(j, data.field_mThumbnail)),
+            ::djinni::List<::djinni::String>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mTags))};
+}
+
+}  // namespace djinni_generated
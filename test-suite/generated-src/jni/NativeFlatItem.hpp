@@ -0,0 +1,44 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "flat_item.hpp"
+
+namespace djinni_generated {
+
+class NativeFlatItem final : public ::djinni::JniRecord<NativeFlatItem> {
+public:
+    using CppType = ::FlatItem;
+    using JniType = jobject;
+
+    using Boxed = NativeFlatItem;
+
+    static constexpr jint kLocalRefsPerRecord = 10;
+
+    ~NativeFlatItem();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeFlatItem& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeFlatItem& data);
+
+private:
+    NativeFlatItem();
+    friend ::djinni::JniClass<NativeFlatItem>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/FlatItem") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(JZSLcom/dropbox/djinni/test/Color;Ljava/lang/String;Ljava/lang/Double;Ljava/util/Date;[BLjava/util/ArrayList;)V") };
+    const jfieldID field_mSerial { ::djinni::jniGetFieldID(clazz.get(), "mSerial", "J") };
+    const jfieldID field_mFlag { ::djinni::jniGetFieldID(clazz.get(), "mFlag", "Z") };
+    const jfieldID field_mRank { ::djinni::jniGetFieldID(clazz.get(), "mRank", "S") };
+    const jfieldID field_mShade { ::djinni::jniGetFieldID(clazz.get(), "mShade", "Lcom/dropbox/djinni/test/Color;") };
+    const jfieldID field_mName { ::djinni::jniGetFieldID(clazz.get(), "mName", "Ljava/lang/String;") };
+    const jfieldID field_mScore { ::djinni::jniGetFieldID(clazz.get(), "mScore", "Ljava/lang/Double;") };
+    const jfieldID field_mCreated { ::djinni::jniGetFieldID(clazz.get(), "mCreated", "Ljava/util/Date;") };
+    const jfieldID field_mThumbnail { ::djinni::jniGetFieldID(clazz.get(), "mThumbnail", "[B") };
+    const jfieldID field_mTags { ::djinni::jniGetFieldID(clazz.get(), "mTags", "Ljava/util/ArrayList;") };
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,47 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#include "NativeFlatSnapshot.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeFlatItem.hpp"
+
+namespace djinni_generated {
+
+NativeFlatSnapshot::NativeFlatSnapshot() = default;
+
+NativeFlatSnapshot::~NativeFlatSnapshot() = default;
+
+auto NativeFlatSnapshot::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeFlatSnapshot>::get());
+}
+
+auto NativeFlatSnapshot::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeFlatSnapshot& data) -> ::djinni::LocalRef<JniType> {
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::I32::fromCpp(jniEnv, c.version)),
+                                                           ::djinni::get(::djinni::List<::djinni_generated::NativeFlatItem>::fromCpp(jniEnv, c.items)),
+                                                           ::djinni::get(::djinni::Map<::djinni::String, ::djinni::I64>::fromCpp(jniEnv, c.by_name)),
+                                                           ::djinni::get(::djinni::Set<::djinni::I64>::fromCpp(jniEnv, c.ids)),
+                                                           ::djinni::get(::djinni::List<::djinni::F32>::fromCpp(jniEnv, c.weights)),
+                                                           ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni_generated::NativeFlatItem>::fromCpp(jniEnv, c.featured)),
+                                                           ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni::String>::fromCpp(jniEnv, c.note)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeFlatSnapshot::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeFlatSnapshot>::get());
+}
+
+auto NativeFlatSnapshot::toCpp(JNIEnv* jniEnv, JniType j, const NativeFlatSnapshot& data) -> CppType {
+    assert(j != nullptr);
+    return {::djinni::I32::toCpp(jniEnv, jniEnv->GetIntField(j, data.field_mVersion)),
+            ::djinni::List<::djinni_generated::NativeFlatItem>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mItems)),
+            ::djinni::Map<::djinni::String, ::djinni::I64>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mByName)),
+            ::djinni::Set<::djinni::I64>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mIds)),
+            ::djinni::List<::djinni::F32>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mWeights)),
+            ::djinni::Optional<std::experimental::optional, ::djinni_generated::NativeFlatItem>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mFeatured)),
+            ::djinni::Optional<std::experimental::optional, ::djinni::String>::toCpp(jniEnv, (jstring)jniEnv->GetObjectField(j, data.field_mNote))};
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,42 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "flat_snapshot.hpp"
+
+namespace djinni_generated {
+
+class NativeFlatSnapshot final : public ::djinni::JniRecord<NativeFlatSnapshot> {
+public:
+    using CppType = ::FlatSnapshot;
+    using JniType = jobject;
+
+    using Boxed = NativeFlatSnapshot;
+
+    static constexpr jint kLocalRefsPerRecord = 8;
+
+    ~NativeFlatSnapshot();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeFlatSnapshot& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeFlatSnapshot& data);
+
+private:
+    NativeFlatSnapshot();
+    friend ::djinni::JniClass<NativeFlatSnapshot>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/FlatSnapshot") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(ILjava/util/ArrayList;Ljava/util/HashMap;Ljava/util/HashSet;Ljava/util/ArrayList;Lcom/dropbox/djinni/test/FlatItem;Ljava/lang/String;)V") };
+    const jfieldID field_mVersion { ::djinni::jniGetFieldID(clazz.get(), "mVersion", "I") };
+    const jfieldID field_mItems { ::djinni::jniGetFieldID(clazz.get(), "mItems", "Ljava/util/ArrayList;") };
+    const jfieldID field_mByName { ::djinni::jniGetFieldID(clazz.get(), "mByName", "Ljava/util/HashMap;") };
+    const jfieldID field_mIds { ::djinni::jniGetFieldID(clazz.get(), "mIds", "Ljava/util/HashSet;") };
+    const jfieldID field_mWeights { ::djinni::jniGetFieldID(clazz.get(), "mWeights", "Ljava/util/ArrayList;") };
+    const jfieldID field_mFeatured { ::djinni::jniGetFieldID(clazz.get(), "mFeatured", "Lcom/dropbox/djinni/test/FlatItem;") };
+    const jfieldID field_mNote { ::djinni::jniGetFieldID(clazz.get(), "mNote", "Ljava/lang/String;") };
+};
+
+}  // namespace djinni_generated
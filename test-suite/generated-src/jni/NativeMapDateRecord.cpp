@@ -11,7 +11,10 @@ NativeMapDateRecord::NativeMapDateRecord() = default;
 NativeMapDateRecord::~NativeMapDateRecord() = default;
 
 auto NativeMapDateRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeMapDateRecord>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeMapDateRecord>::get());
+}
+
+auto NativeMapDateRecord::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeMapDateRecord& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::Map<::djinni::String, ::djinni::Date>::fromCpp(jniEnv, c.dates_by_id)))};
     ::djinni::jniExceptionCheck(jniEnv);
@@ -19,9 +22,12 @@ auto NativeMapDateRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni:
 }
 
 auto NativeMapDateRecord::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 2);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeMapDateRecord>::get());
+}
+
+auto NativeMapDateRecord::toCpp(JNIEnv* jniEnv, JniType j, const NativeMapDateRecord& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeMapDateRecord>::get();
     return {::djinni::Map<::djinni::String, ::djinni::Date>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mDatesById))};
 }
 
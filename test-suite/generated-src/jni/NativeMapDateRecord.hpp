@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeMapDateRecord final {
+class NativeMapDateRecord final : public ::djinni::JniRecord<NativeMapDateRecord> {
 public:
     using CppType = ::MapDateRecord;
     using JniType = jobject;
 
     using Boxed = NativeMapDateRecord;
 
+    static constexpr jint kLocalRefsPerRecord = 2;
+
     ~NativeMapDateRecord();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeMapDateRecord& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeMapDateRecord& data);
 
 private:
     NativeMapDateRecord();
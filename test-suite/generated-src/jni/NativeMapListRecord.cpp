@@ -11,7 +11,10 @@ NativeMapListRecord::NativeMapListRecord() = default;
 NativeMapListRecord::~NativeMapListRecord() = default;
 
 auto NativeMapListRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeMapListRecord>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeMapListRecord>::get());
+}
+
+auto NativeMapListRecord::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeMapListRecord& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::List<::djinni::Map<::djinni::String, ::djinni::I64>>::fromCpp(jniEnv, c.map_list)))};
     ::djinni::jniExceptionCheck(jniEnv);
@@ -19,9 +22,12 @@ auto NativeMapListRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni:
 }
 
 auto NativeMapListRecord::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 2);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeMapListRecord>::get());
+}
+
+auto NativeMapListRecord::toCpp(JNIEnv* jniEnv, JniType j, const NativeMapListRecord& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeMapListRecord>::get();
     return {::djinni::List<::djinni::Map<::djinni::String, ::djinni::I64>>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mMapList))};
 }
 
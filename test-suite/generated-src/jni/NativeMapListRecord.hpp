@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeMapListRecord final {
+class NativeMapListRecord final : public ::djinni::JniRecord<NativeMapListRecord> {
 public:
     using CppType = ::MapListRecord;
     using JniType = jobject;
 
     using Boxed = NativeMapListRecord;
 
+    static constexpr jint kLocalRefsPerRecord = 2;
+
     ~NativeMapListRecord();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeMapListRecord& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeMapListRecord& data);
 
 private:
     NativeMapListRecord();
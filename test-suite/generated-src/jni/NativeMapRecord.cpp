@@ -11,7 +11,10 @@ NativeMapRecord::NativeMapRecord() = default;
 NativeMapRecord::~NativeMapRecord() = default;
 
 auto NativeMapRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeMapRecord>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeMapRecord>::get());
+}
+
+auto NativeMapRecord::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeMapRecord& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::Map<::djinni::String, ::djinni::I64>::fromCpp(jniEnv, c.map)),
                                                            ::djinni::get(::djinni::Map<::djinni::I32, ::djinni::I32>::fromCpp(jniEnv, c.imap)))};
@@ -20,9 +23,12 @@ auto NativeMapRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::Loc
 }
 
 auto NativeMapRecord::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 3);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeMapRecord>::get());
+}
+
+auto NativeMapRecord::toCpp(JNIEnv* jniEnv, JniType j, const NativeMapRecord& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeMapRecord>::get();
     return {::djinni::Map<::djinni::String, ::djinni::I64>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mMap)),
             ::djinni::Map<::djinni::I32, ::djinni::I32>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mImap))};
 }
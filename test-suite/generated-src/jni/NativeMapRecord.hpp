@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeMapRecord final {
+class NativeMapRecord final : public ::djinni::JniRecord<NativeMapRecord> {
 public:
     using CppType = ::MapRecord;
     using JniType = jobject;
 
     using Boxed = NativeMapRecord;
 
+    static constexpr jint kLocalRefsPerRecord = 3;
+
     ~NativeMapRecord();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeMapRecord& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeMapRecord& data);
 
 private:
     NativeMapRecord();
@@ -11,7 +11,10 @@ NativeNestedCollection::NativeNestedCollection() = default;
 NativeNestedCollection::~NativeNestedCollection() = default;
 
 auto NativeNestedCollection::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeNestedCollection>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeNestedCollection>::get());
+}
+
+auto NativeNestedCollection::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeNestedCollection& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::List<::djinni::Set<::djinni::String>>::fromCpp(jniEnv, c.set_list)))};
     ::djinni::jniExceptionCheck(jniEnv);
@@ -19,9 +22,12 @@ auto NativeNestedCollection::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djin
 }
 
 auto NativeNestedCollection::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 2);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeNestedCollection>::get());
+}
+
+auto NativeNestedCollection::toCpp(JNIEnv* jniEnv, JniType j, const NativeNestedCollection& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeNestedCollection>::get();
     return {::djinni::List<::djinni::Set<::djinni::String>>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mSetList))};
 }
 
@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeNestedCollection final {
+class NativeNestedCollection final : public ::djinni::JniRecord<NativeNestedCollection> {
 public:
     using CppType = ::NestedCollection;
     using JniType = jobject;
 
     using Boxed = NativeNestedCollection;
 
+    static constexpr jint kLocalRefsPerRecord = 2;
+
     ~NativeNestedCollection();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeNestedCollection& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeNestedCollection& data);
 
 private:
     NativeNestedCollection();
@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#include "NativePlainLarge.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativePlainMedium.hpp"
+#include "NativePlainSmall.hpp"
+
+namespace djinni_generated {
+
+NativePlainLarge::NativePlainLarge() = default;
+
+NativePlainLarge::~NativePlainLarge() = default;
+
+auto NativePlainLarge::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativePlainLarge>::get());
+}
+
+auto NativePlainLarge::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativePlainLarge& data) -> ::djinni::LocalRef<JniType> {
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni_generated::NativePlainMedium::fromCpp(jniEnv, c.header)),
+                                                           ::djinni::get(::djinni::List<::djinni_generated::NativePlainSmall>::fromCpp(jniEnv, c.items)),
+                                                           ::djinni::get(::djinni::Map<::djinni::String, ::djinni::I32>::fromCpp(jniEnv, c.attributes)),
+                                                           ::djinni::get(::djinni::Set<::djinni::I64>::fromCpp(jniEnv, c.members)),
+                                                           ::djinni::get(::djinni::Binary::fromCpp(jniEnv, c.payload)),
+                                                           ::djinni::get(::djinni::Array<::djinni::F64>::fromCpp(jniEnv, c.weights)),
+                                                           ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni::String>::fromCpp(jniEnv, c.note)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativePlainLarge::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativePlainLarge>::get());
+}
+
+auto NativePlainLarge::toCpp(JNIEnv* jniEnv, JniType j, const NativePlainLarge& data) -> CppType {
+    assert(j != nullptr);
+    return {::djinni_generated::NativePlainMedium::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mHeader)),
+            ::djinni::List<::djinni_generated::NativePlainSmall>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mItems)),
+            ::djinni::Map<::djinni::String, ::djinni::I32>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mAttributes)),
+            ::djinni::Set<::djinni::I64>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mMembers)),
+            ::djinni::Binary::toCpp(jniEnv, (jbyteArray)jniEnv->GetObjectField(j, data.field_mPayload)),
+            ::djinni::Array<::djinni::F64>::toCpp(jniEnv, (jdoubleArray)jniEnv->GetObjectField(j, data.field_mWeights)),
+            ::djinni::Optional<std::experimental::optional, ::djinni::String>::toCpp(jniEnv, (jstring)jniEnv->GetObjectField(j, data.field_mNote))};
+}
+
+}  // namespace djinni_generated
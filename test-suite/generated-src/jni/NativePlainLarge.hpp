@@ -0,0 +1,42 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "plain_large.hpp"
+
+namespace djinni_generated {
+
+class NativePlainLarge final : public ::djinni::JniRecord<NativePlainLarge> {
+public:
+    using CppType = ::PlainLarge;
+    using JniType = jobject;
+
+    using Boxed = NativePlainLarge;
+
+    static constexpr jint kLocalRefsPerRecord = 8;
+
+    ~NativePlainLarge();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativePlainLarge& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativePlainLarge& data);
+
+private:
+    NativePlainLarge();
+    friend ::djinni::JniClass<NativePlainLarge>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/PlainLarge") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(Lcom/dropbox/djinni/test/PlainMedium;Ljava/util/ArrayList;Ljava/util/HashMap;Ljava/util/HashSet;[B[DLjava/lang/String;)V") };
+    const jfieldID field_mHeader { ::djinni::jniGetFieldID(clazz.get(), "mHeader", "Lcom/dropbox/djinni/test/PlainMedium;") };
+    const jfieldID field_mItems { ::djinni::jniGetFieldID(clazz.get(), "mItems", "Ljava/util/ArrayList;") };
+    const jfieldID field_mAttributes { ::djinni::jniGetFieldID(clazz.get(), "mAttributes", "Ljava/util/HashMap;") };
+    const jfieldID field_mMembers { ::djinni::jniGetFieldID(clazz.get(), "mMembers", "Ljava/util/HashSet;") };
+    const jfieldID field_mPayload { ::djinni::jniGetFieldID(clazz.get(), "mPayload", "[B") };
+    const jfieldID field_mWeights { ::djinni::jniGetFieldID(clazz.get(), "mWeights", "[D") };
+    const jfieldID field_mNote { ::djinni::jniGetFieldID(clazz.get(), "mNote", "Ljava/lang/String;") };
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,45 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#include "NativePlainMedium.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeColor.hpp"
+
+namespace djinni_generated {
+
+NativePlainMedium::NativePlainMedium() = default;
+
+NativePlainMedium::~NativePlainMedium() = default;
+
+auto NativePlainMedium::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativePlainMedium>::get());
+}
+
+auto NativePlainMedium::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativePlainMedium& data) -> ::djinni::LocalRef<JniType> {
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.serial)),
+                                                           ::djinni::get(::djinni::String::fromCpp(jniEnv, c.name)),
+                                                           ::djinni::get(::djinni::List<::djinni::String>::fromCpp(jniEnv, c.tags)),
+                                                           ::djinni::get(::djinni::Optional<std::experimental::optional, ::djinni::F32>::fromCpp(jniEnv, c.rating)),
+                                                           ::djinni::get(::djinni_generated::NativeColor::fromCpp(jniEnv, c.shade)),
+                                                           ::djinni::get(::djinni::Date::fromCpp(jniEnv, c.created)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativePlainMedium::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativePlainMedium>::get());
+}
+
+auto NativePlainMedium::toCpp(JNIEnv* jniEnv, JniType j, const NativePlainMedium& data) -> CppType {
+    assert(j != nullptr);
+    return {::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mSerial)),
+            ::djinni::String::toCpp(jniEnv, (jstring)jniEnv->GetObjectField(j, data.field_mName)),
+            ::djinni::List<::djinni::String>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mTags)),
+            ::djinni::Optional<std::experimental::optional, ::djinni::F32>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mRating)),
+            ::djinni_generated::NativeColor::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mShade)),
+            ::djinni::Date::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mCreated))};
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,41 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "plain_medium.hpp"
+
+namespace djinni_generated {
+
+class NativePlainMedium final : public ::djinni::JniRecord<NativePlainMedium> {
+public:
+    using CppType = ::PlainMedium;
+    using JniType = jobject;
+
+    using Boxed = NativePlainMedium;
+
+    static constexpr jint kLocalRefsPerRecord = 7;
+
+    ~NativePlainMedium();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativePlainMedium& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativePlainMedium& data);
+
+private:
+    NativePlainMedium();
+    friend ::djinni::JniClass<NativePlainMedium>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/PlainMedium") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(JLjava/lang/String;Ljava/util/ArrayList;Ljava/lang/Float;Lcom/dropbox/djinni/test/Color;Ljava/util/Date;)V") };
+    const jfieldID field_mSerial { ::djinni::jniGetFieldID(clazz.get(), "mSerial", "J") };
+    const jfieldID field_mName { ::djinni::jniGetFieldID(clazz.get(), "mName", "Ljava/lang/String;") };
+    const jfieldID field_mTags { ::djinni::jniGetFieldID(clazz.get(), "mTags", "Ljava/util/ArrayList;") };
+    const jfieldID field_mRating { ::djinni::jniGetFieldID(clazz.get(), "mRating", "Ljava/lang/Float;") };
+    const jfieldID field_mShade { ::djinni::jniGetFieldID(clazz.get(), "mShade", "Lcom/dropbox/djinni/test/Color;") };
+    const jfieldID field_mCreated { ::djinni::jniGetFieldID(clazz.get(), "mCreated", "Ljava/util/Date;") };
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,38 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#include "NativePlainSmall.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativePlainSmall::NativePlainSmall() = default;
+
+NativePlainSmall::~NativePlainSmall() = default;
+
+auto NativePlainSmall::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativePlainSmall>::get());
+}
+
+auto NativePlainSmall::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativePlainSmall& data) -> ::djinni::LocalRef<JniType> {
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.serial)),
+                                                           ::djinni::get(::djinni::String::fromCpp(jniEnv, c.label)),
+                                                           ::djinni::get(::djinni::F64::fromCpp(jniEnv, c.score)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativePlainSmall::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativePlainSmall>::get());
+}
+
+auto NativePlainSmall::toCpp(JNIEnv* jniEnv, JniType j, const NativePlainSmall& data) -> CppType {
+    assert(j != nullptr);
+    return {::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mSerial)),
+            ::djinni::String::toCpp(jniEnv, (jstring)jniEnv->GetObjectField(j, data.field_mLabel)),
+            ::djinni::F64::toCpp(jniEnv, jniEnv->GetDoubleField(j, data.field_mScore))};
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,38 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "plain_small.hpp"
+
+namespace djinni_generated {
+
+class NativePlainSmall final : public ::djinni::JniRecord<NativePlainSmall> {
+public:
+    using CppType = ::PlainSmall;
+    using JniType = jobject;
+
+    using Boxed = NativePlainSmall;
+
+    static constexpr jint kLocalRefsPerRecord = 4;
+
+    ~NativePlainSmall();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativePlainSmall& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativePlainSmall& data);
+
+private:
+    NativePlainSmall();
+    friend ::djinni::JniClass<NativePlainSmall>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/PlainSmall") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(JLjava/lang/String;D)V") };
+    const jfieldID field_mSerial { ::djinni::jniGetFieldID(clazz.get(), "mSerial", "J") };
+    const jfieldID field_mLabel { ::djinni::jniGetFieldID(clazz.get(), "mLabel", "Ljava/lang/String;") };
+    const jfieldID field_mScore { ::djinni::jniGetFieldID(clazz.get(), "mScore", "D") };
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,80 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_list.djinni
+
+#include "NativePointRecord.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativePointRecord::NativePointRecord() = default;
+
+NativePointRecord::~NativePointRecord() = default;
+
+auto NativePointRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativePointRecord>::get());
+}
+
+auto NativePointRecord::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativePointRecord& data) -> ::djinni::LocalRef<JniType> {
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::I32::fromCpp(jniEnv, c.x)),
+                                                           ::djinni::get(::djinni::I32::fromCpp(jniEnv, c.y)),
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.key)),
+                                                           ::djinni::get(::djinni::F64::fromCpp(jniEnv, c.weight)),
+                                                           ::djinni::get(::djinni::Bool::fromCpp(jniEnv, c.visible)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativePointRecord::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativePointRecord>::get());
+}
+
+auto NativePointRecord::toCpp(JNIEnv* jniEnv, JniType j, const NativePointRecord& data) -> CppType {
+    assert(j != nullptr);
+    return {::djinni::I32::toCpp(jniEnv, jniEnv->GetIntField(j, data.field_mX)),
+            ::djinni::I32::toCpp(jniEnv, jniEnv->GetIntField(j, data.field_mY)),
+            ::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mKey)),
+            ::djinni::F64::toCpp(jniEnv, jniEnv->GetDoubleField(j, data.field_mWeight)),
+            ::djinni::Bool::toCpp(jniEnv, jniEnv->GetBooleanField(j, data.field_mVisible))};
+}
+
+auto NativePointRecord::toCppList(JNIEnv* jniEnv, jobject j, jint size) -> std::vector<CppType> {
+    const auto& data = ::djinni::JniClass<NativePointRecord>::get();
+    auto j_x = ::djinni::Column<::djinni::I32>::create(jniEnv, size);
+    auto j_y = ::djinni::Column<::djinni::I32>::create(jniEnv, size);
+    auto j_key = ::djinni::Column<::djinni::I64>::create(jniEnv, size);
+    auto j_weight = ::djinni::Column<::djinni::F64>::create(jniEnv, size);
+    auto j_visible = ::djinni::Column<::djinni::Bool>::create(jniEnv, size);
+    jniEnv->CallStaticVoidMethod(data.clazz.get(), data.method_toColumns, j, j_x.get(), j_y.get(), j_key.get(), j_weight.get(), j_visible.get());
+    ::djinni::jniExceptionCheck(jniEnv);
+    const auto col_x = ::djinni::Column<::djinni::I32>::toCpp(jniEnv, j_x.get(), size);
+    const auto col_y = ::djinni::Column<::djinni::I32>::toCpp(jniEnv, j_y.get(), size);
+    const auto col_key = ::djinni::Column<::djinni::I64>::toCpp(jniEnv, j_key.get(), size);
+    const auto col_weight = ::djinni::Column<::djinni::F64>::toCpp(jniEnv, j_weight.get(), size);
+    const auto col_visible = ::djinni::Column<::djinni::Bool>::toCpp(jniEnv, j_visible.get(), size);
+    std::vector<CppType> c;
+    c.reserve(size);
+    for (jint i = 0; i < size; ++i) {
+        c.push_back({::djinni::I32::toCpp(jniEnv, col_x[i]),
+                     ::djinni::I32::toCpp(jniEnv, col_y[i]),
+                     ::djinni::I64::toCpp(jniEnv, col_key[i]),
+                     ::djinni::F64::toCpp(jniEnv, col_weight[i]),
+                     ::djinni::Bool::toCpp(jniEnv, col_visible[i])});
+    }
+    return c;
+}
+
+auto NativePointRecord::fromCppList(JNIEnv* jniEnv, const std::vector<CppType>& c) -> ::djinni::LocalRef<jobject> {
+    const auto& data = ::djinni::JniClass<NativePointRecord>::get();
+    auto r = ::djinni::LocalRef<jobject>{jniEnv->CallStaticObjectMethod(data.clazz.get(), data.method_fromColumns,
+                                                                        ::djinni::get(::djinni::Column<::djinni::I32>::fromCpp(jniEnv, c, [](const CppType& e) { return e.x; })),
+                                                                        ::djinni::get(::djinni::Column<::djinni::I32>::fromCpp(jniEnv, c, [](const CppType& e) { return e.y; })),
+                                                                        ::djinni::get(::djinni::Column<::djinni::I64>::fromCpp(jniEnv, c, [](const CppType& e) { return e.key; })),
+                                                                        ::djinni::get(::djinni::Column<::djinni::F64>::fromCpp(jniEnv, c, [](const CppType& e) { return e.weight; })),
+                                                                        ::djinni::get(::djinni::Column<::djinni::Bool>::fromCpp(jniEnv, c, [](const CppType& e) { return e.visible; })))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,44 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_list.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "point_record.hpp"
+
+namespace djinni_generated {
+
+class NativePointRecord final : public ::djinni::JniPrimitiveRecord<NativePointRecord> {
+public:
+    using CppType = ::PointRecord;
+    using JniType = jobject;
+
+    using Boxed = NativePointRecord;
+
+    static constexpr jint kLocalRefsPerRecord = 6;
+
+    ~NativePointRecord();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativePointRecord& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativePointRecord& data);
+    static std::vector<CppType> toCppList(JNIEnv* jniEnv, jobject j, jint size);
+    static ::djinni::LocalRef<jobject> fromCppList(JNIEnv* jniEnv, const std::vector<CppType>& c);
+
+private:
+    NativePointRecord();
+    friend ::djinni::JniClass<NativePointRecord>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/PointRecord") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(IIJDZ)V") };
+    const jfieldID field_mX { ::djinni::jniGetFieldID(clazz.get(), "mX", "I") };
+    const jfieldID field_mY { ::djinni::jniGetFieldID(clazz.get(), "mY", "I") };
+    const jfieldID field_mKey { ::djinni::jniGetFieldID(clazz.get(), "mKey", "J") };
+    const jfieldID field_mWeight { ::djinni::jniGetFieldID(clazz.get(), "mWeight", "D") };
+    const jfieldID field_mVisible { ::djinni::jniGetFieldID(clazz.get(), "mVisible", "Z") };
+    const jmethodID method_fromColumns { ::djinni::jniGetStaticMethodID(clazz.get(), "fromColumns", "([I[I[J[D[Z)Ljava/util/ArrayList;") };
+    const jmethodID method_toColumns { ::djinni::jniGetStaticMethodID(clazz.get(), "toColumns", "(Ljava/util/ArrayList;[I[I[J[D[Z)V") };
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,40 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_array.djinni
+
+#include "NativePrimitiveArrays.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativePrimitiveArrays::NativePrimitiveArrays() = default;
+
+NativePrimitiveArrays::~NativePrimitiveArrays() = default;
+
+auto NativePrimitiveArrays::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativePrimitiveArrays>::get());
+}
+
+auto NativePrimitiveArrays::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativePrimitiveArrays& data) -> ::djinni::LocalRef<JniType> {
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::Array<::djinni::I32>::fromCpp(jniEnv, c.ints)),
+                                                           ::djinni::get(::djinni::Array<::djinni::I64>::fromCpp(jniEnv, c.longs)),
+                                                           ::djinni::get(::djinni::Array<::djinni::F64>::fromCpp(jniEnv, c.doubles)),
+                                                           ::djinni::get(::djinni::Array<::djinni::Bool>::fromCpp(jniEnv, c.flags)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativePrimitiveArrays::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativePrimitiveArrays>::get());
+}
+
+auto NativePrimitiveArrays::toCpp(JNIEnv* jniEnv, JniType j, const NativePrimitiveArrays& data) -> CppType {
+    assert(j != nullptr);
+    return {::djinni::Array<::djinni::I32>::toCpp(jniEnv, (jintArray)jniEnv->GetObjectField(j, data.field_mInts)),
+            ::djinni::Array<::djinni::I64>::toCpp(jniEnv, (jlongArray)jniEnv->GetObjectField(j, data.field_mLongs)),
+            ::djinni::Array<::djinni::F64>::toCpp(jniEnv, (jdoubleArray)jniEnv->GetObjectField(j, data.field_mDoubles)),
+            ::djinni::Array<::djinni::Bool>::toCpp(jniEnv, (jbooleanArray)jniEnv->GetObjectField(j, data.field_mFlags))};
+}
+
+}  // namespace djinni_generated
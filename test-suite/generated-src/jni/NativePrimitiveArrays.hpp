@@ -0,0 +1,39 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_array.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "primitive_arrays.hpp"
+
+namespace djinni_generated {
+
+class NativePrimitiveArrays final : public ::djinni::JniRecord<NativePrimitiveArrays> {
+public:
+    using CppType = ::PrimitiveArrays;
+    using JniType = jobject;
+
+    using Boxed = NativePrimitiveArrays;
+
+    static constexpr jint kLocalRefsPerRecord = 5;
+
+    ~NativePrimitiveArrays();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativePrimitiveArrays& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativePrimitiveArrays& data);
+
+private:
+    NativePrimitiveArrays();
+    friend ::djinni::JniClass<NativePrimitiveArrays>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/PrimitiveArrays") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "([I[J[D[Z)V") };
+    const jfieldID field_mInts { ::djinni::jniGetFieldID(clazz.get(), "mInts", "[I") };
+    const jfieldID field_mLongs { ::djinni::jniGetFieldID(clazz.get(), "mLongs", "[J") };
+    const jfieldID field_mDoubles { ::djinni::jniGetFieldID(clazz.get(), "mDoubles", "[D") };
+    const jfieldID field_mFlags { ::djinni::jniGetFieldID(clazz.get(), "mFlags", "[Z") };
+};
+
+}  // namespace djinni_generated
@@ -11,7 +11,10 @@ NativePrimitiveList::NativePrimitiveList() = default;
 NativePrimitiveList::~NativePrimitiveList() = default;
 
 auto NativePrimitiveList::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativePrimitiveList>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativePrimitiveList>::get());
+}
+
+auto NativePrimitiveList::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativePrimitiveList& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::List<::djinni::I64>::fromCpp(jniEnv, c.list)))};
     ::djinni::jniExceptionCheck(jniEnv);
@@ -19,9 +22,12 @@ auto NativePrimitiveList::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni:
 }
 
 auto NativePrimitiveList::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 2);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativePrimitiveList>::get());
+}
+
+auto NativePrimitiveList::toCpp(JNIEnv* jniEnv, JniType j, const NativePrimitiveList& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativePrimitiveList>::get();
     return {::djinni::List<::djinni::I64>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mList))};
 }
 
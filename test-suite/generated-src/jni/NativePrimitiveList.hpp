@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativePrimitiveList final {
+class NativePrimitiveList final : public ::djinni::JniRecord<NativePrimitiveList> {
 public:
     using CppType = ::PrimitiveList;
     using JniType = jobject;
 
     using Boxed = NativePrimitiveList;
 
+    static constexpr jint kLocalRefsPerRecord = 2;
+
     ~NativePrimitiveList();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativePrimitiveList& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativePrimitiveList& data);
 
 private:
     NativePrimitiveList();
@@ -11,7 +11,10 @@ NativeRecordWithDerivings::NativeRecordWithDerivings() = default;
 NativeRecordWithDerivings::~NativeRecordWithDerivings() = default;
 
 auto NativeRecordWithDerivings::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeRecordWithDerivings>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeRecordWithDerivings>::get());
+}
+
+auto NativeRecordWithDerivings::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeRecordWithDerivings& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::I32::fromCpp(jniEnv, c.key1)),
                                                            ::djinni::get(::djinni::String::fromCpp(jniEnv, c.key2)))};
@@ -20,9 +23,12 @@ auto NativeRecordWithDerivings::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::d
 }
 
 auto NativeRecordWithDerivings::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 3);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeRecordWithDerivings>::get());
+}
+
+auto NativeRecordWithDerivings::toCpp(JNIEnv* jniEnv, JniType j, const NativeRecordWithDerivings& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeRecordWithDerivings>::get();
     return {::djinni::I32::toCpp(jniEnv, jniEnv->GetIntField(j, data.field_mKey1)),
             ::djinni::String::toCpp(jniEnv, (jstring)jniEnv->GetObjectField(j, data.field_mKey2))};
 }
@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeRecordWithDerivings final {
+class NativeRecordWithDerivings final : public ::djinni::JniRecord<NativeRecordWithDerivings> {
 public:
     using CppType = ::RecordWithDerivings;
     using JniType = jobject;
 
     using Boxed = NativeRecordWithDerivings;
 
+    static constexpr jint kLocalRefsPerRecord = 3;
+
     ~NativeRecordWithDerivings();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeRecordWithDerivings& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeRecordWithDerivings& data);
 
 private:
     NativeRecordWithDerivings();
@@ -12,7 +12,10 @@ NativeRecordWithDurationAndDerivings::NativeRecordWithDurationAndDerivings() = d
 NativeRecordWithDurationAndDerivings::~NativeRecordWithDurationAndDerivings() = default;
 
 auto NativeRecordWithDurationAndDerivings::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeRecordWithDurationAndDerivings>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeRecordWithDurationAndDerivings>::get());
+}
+
+auto NativeRecordWithDurationAndDerivings::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeRecordWithDurationAndDerivings& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::Duration<::djinni::F64, ::djinni::Duration_ns>::fromCpp(jniEnv, c.dt)))};
     ::djinni::jniExceptionCheck(jniEnv);
@@ -20,9 +23,12 @@ auto NativeRecordWithDurationAndDerivings::fromCpp(JNIEnv* jniEnv, const CppType
 }
 
 auto NativeRecordWithDurationAndDerivings::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 2);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeRecordWithDurationAndDerivings>::get());
+}
+
+auto NativeRecordWithDurationAndDerivings::toCpp(JNIEnv* jniEnv, JniType j, const NativeRecordWithDurationAndDerivings& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeRecordWithDurationAndDerivings>::get();
     return {::djinni::Duration<::djinni::F64, ::djinni::Duration_ns>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mDt))};
 }
 
@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeRecordWithDurationAndDerivings final {
+class NativeRecordWithDurationAndDerivings final : public ::djinni::JniRecord<NativeRecordWithDurationAndDerivings> {
 public:
     using CppType = ::RecordWithDurationAndDerivings;
     using JniType = jobject;
 
     using Boxed = NativeRecordWithDurationAndDerivings;
 
+    static constexpr jint kLocalRefsPerRecord = 2;
+
     ~NativeRecordWithDurationAndDerivings();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeRecordWithDurationAndDerivings& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeRecordWithDurationAndDerivings& data);
 
 private:
     NativeRecordWithDurationAndDerivings();
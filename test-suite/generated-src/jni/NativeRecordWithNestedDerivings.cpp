@@ -12,7 +12,10 @@ NativeRecordWithNestedDerivings::NativeRecordWithNestedDerivings() = default;
 NativeRecordWithNestedDerivings::~NativeRecordWithNestedDerivings() = default;
 
 auto NativeRecordWithNestedDerivings::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeRecordWithNestedDerivings>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeRecordWithNestedDerivings>::get());
+}
+
+auto NativeRecordWithNestedDerivings::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeRecordWithNestedDerivings& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::I32::fromCpp(jniEnv, c.key)),
                                                            ::djinni::get(::djinni_generated::NativeRecordWithDerivings::fromCpp(jniEnv, c.rec)))};
@@ -21,9 +24,12 @@ auto NativeRecordWithNestedDerivings::fromCpp(JNIEnv* jniEnv, const CppType& c)
 }
 
 auto NativeRecordWithNestedDerivings::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 3);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeRecordWithNestedDerivings>::get());
+}
+
+auto NativeRecordWithNestedDerivings::toCpp(JNIEnv* jniEnv, JniType j, const NativeRecordWithNestedDerivings& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeRecordWithNestedDerivings>::get();
     return {::djinni::I32::toCpp(jniEnv, jniEnv->GetIntField(j, data.field_mKey)),
             ::djinni_generated::NativeRecordWithDerivings::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mRec))};
 }
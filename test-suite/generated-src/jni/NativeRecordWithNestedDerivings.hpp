@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeRecordWithNestedDerivings final {
+class NativeRecordWithNestedDerivings final : public ::djinni::JniRecord<NativeRecordWithNestedDerivings> {
 public:
     using CppType = ::RecordWithNestedDerivings;
     using JniType = jobject;
 
     using Boxed = NativeRecordWithNestedDerivings;
 
+    static constexpr jint kLocalRefsPerRecord = 3;
+
     ~NativeRecordWithNestedDerivings();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeRecordWithNestedDerivings& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeRecordWithNestedDerivings& data);
 
 private:
     NativeRecordWithNestedDerivings();
@@ -0,0 +1,74 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#include "NativeSample.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeSample::NativeSample() = default;
+
+NativeSample::~NativeSample() = default;
+
+auto NativeSample::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeSample>::get());
+}
+
+auto NativeSample::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeSample& data) -> ::djinni::LocalRef<JniType> {
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
+                                                           ::djinni::get(::djinni::I64::fromCpp(jniEnv, c.time)),
+                                                           ::djinni::get(::djinni::F64::fromCpp(jniEnv, c.value)),
+                                                           ::djinni::get(::djinni::F32::fromCpp(jniEnv, c.weight)),
+                                                           ::djinni::get(::djinni::Bool::fromCpp(jniEnv, c.valid)))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeSample::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeSample>::get());
+}
+
+auto NativeSample::toCpp(JNIEnv* jniEnv, JniType j, const NativeSample& data) -> CppType {
+    assert(j != nullptr);
+    return {::djinni::I64::toCpp(jniEnv, jniEnv->GetLongField(j, data.field_mTime)),
+            ::djinni::F64::toCpp(jniEnv, jniEnv->GetDoubleField(j, data.field_mValue)),
+            ::djinni::F32::toCpp(jniEnv, jniEnv->GetFloatField(j, data.field_mWeight)),
+            ::djinni::Bool::toCpp(jniEnv, jniEnv->GetBooleanField(j, data.field_mValid))};
+}
+
+auto NativeSample::toCppList(JNIEnv* jniEnv, jobject j, jint size) -> std::vector<CppType> {
+    const auto& data = ::djinni::JniClass<NativeSample>::get();
+    auto j_time = ::djinni::Column<::djinni::I64>::create(jniEnv, size);
+    auto j_value = ::djinni::Column<::djinni::F64>::create(jniEnv, size);
+    auto j_weight = ::djinni::Column<::djinni::F32>::create(jniEnv, size);
+    auto j_valid = ::djinni::Column<::djinni::Bool>::create(jniEnv, size);
+    jniEnv->CallStaticVoidMethod(data.clazz.get(), data.method_toColumns, j, j_time.get(), j_value.get(), j_weight.get(), j_valid.get());
+    ::djinni::jniExceptionCheck(jniEnv);
+    const auto col_time = ::djinni::Column<::djinni::I64>::toCpp(jniEnv, j_time.get(), size);
+    const auto col_value = ::djinni::Column<::djinni::F64>::toCpp(jniEnv, j_value.get(), size);
+    const auto col_weight = ::djinni::Column<::djinni::F32>::toCpp(jniEnv, j_weight.get(), size);
+    const auto col_valid = ::djinni::Column<::djinni::Bool>::toCpp(jniEnv, j_valid.get(), size);
+    std::vector<CppType> c;
+    c.reserve(size);
+    for (jint i = 0; i < size; ++i) {
+        c.push_back({::djinni::I64::toCpp(jniEnv, col_time[i]),
+                     ::djinni::F64::toCpp(jniEnv, col_value[i]),
+                     ::djinni::F32::toCpp(jniEnv, col_weight[i]),
+                     ::djinni::Bool::toCpp(jniEnv, col_valid[i])});
+    }
+    return c;
+}
+
+auto NativeSample::fromCppList(JNIEnv* jniEnv, const std::vector<CppType>& c) -> ::djinni::LocalRef<jobject> {
+    const auto& data = ::djinni::JniClass<NativeSample>::get();
+    auto r = ::djinni::LocalRef<jobject>{jniEnv->CallStaticObjectMethod(data.clazz.get(), data.method_fromColumns,
+                                                                        ::djinni::get(::djinni::Column<::djinni::I64>::fromCpp(jniEnv, c, [](const CppType& e) { return e.time; })),
+                                                                        ::djinni::get(::djinni::Column<::djinni::F64>::fromCpp(jniEnv, c, [](const CppType& e) { return e.value; })),
+                                                                        ::djinni::get(::djinni::Column<::djinni::F32>::fromCpp(jniEnv, c, [](const CppType& e) { return e.weight; })),
+                                                                        ::djinni::get(::djinni::Column<::djinni::Bool>::fromCpp(jniEnv, c, [](const CppType& e) { return e.valid; })))};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+}  // namespace djinni_generated
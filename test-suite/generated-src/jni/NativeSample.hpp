@@ -0,0 +1,43 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "sample.hpp"
+
+namespace djinni_generated {
+
+class NativeSample final : public ::djinni::JniPrimitiveRecord<NativeSample> {
+public:
+    using CppType = ::Sample;
+    using JniType = jobject;
+
+    using Boxed = NativeSample;
+
+    static constexpr jint kLocalRefsPerRecord = 5;
+
+    ~NativeSample();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeSample& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeSample& data);
+    static std::vector<CppType> toCppList(JNIEnv* jniEnv, jobject j, jint size);
+    static ::djinni::LocalRef<jobject> fromCppList(JNIEnv* jniEnv, const std::vector<CppType>& c);
+
+private:
+    NativeSample();
+    friend ::djinni::JniClass<NativeSample>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/Sample") };
+    const jmethodID jconstructor { ::djinni::jniGetMethodID(clazz.get(), "<init>", "(JDFZ)V") };
+    const jfieldID field_mTime { ::djinni::jniGetFieldID(clazz.get(), "mTime", "J") };
+    const jfieldID field_mValue { ::djinni::jniGetFieldID(clazz.get(), "mValue", "D") };
+    const jfieldID field_mWeight { ::djinni::jniGetFieldID(clazz.get(), "mWeight", "F") };
+    const jfieldID field_mValid { ::djinni::jniGetFieldID(clazz.get(), "mValid", "Z") };
+    const jmethodID method_fromColumns { ::djinni::jniGetStaticMethodID(clazz.get(), "fromColumns", "([J[D[F[Z)Ljava/util/ArrayList;") };
+    const jmethodID method_toColumns { ::djinni::jniGetStaticMethodID(clazz.get(), "toColumns", "(Ljava/util/ArrayList;[J[D[F[Z)V") };
+};
+
+}  // namespace djinni_generated
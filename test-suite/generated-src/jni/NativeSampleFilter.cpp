@@ -0,0 +1,62 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#include "NativeSampleFilter.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeSample.hpp"
+#include "NativeSampleFilter.hpp"
+
+namespace djinni_generated {
+
+NativeSampleFilter::NativeSampleFilter() : ::djinni::JniInterface<::SampleFilter, NativeSampleFilter>("com/dropbox/djinni/test/SampleFilter$CppProxy") {}
+
+NativeSampleFilter::~NativeSampleFilter() = default;
+
+
+static jobject JNICALL Java_com_dropbox_djinni_test_SampleFilter_create(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto r = ::SampleFilter::create();
+        return ::djinni::release(::djinni_generated::NativeSampleFilter::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static void JNICALL Java_com_dropbox_djinni_test_SampleFilter_00024CppProxy_native_1scale(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jlong j_s_time, jdouble j_s_value, jfloat j_s_weight, jboolean j_s_valid, jdouble j_factor, jlongArray j__slot)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::CppProxyHandle<::SampleFilter>::get(nativeRef);
+        auto r = ref->scale(::Sample{::djinni::I64::toCpp(jniEnv, j_s_time), ::djinni::F64::toCpp(jniEnv, j_s_value), ::djinni::F32::toCpp(jniEnv, j_s_weight), ::djinni::Bool::toCpp(jniEnv, j_s_valid)},
+                            ::djinni::F64::toCpp(jniEnv, j_factor));
+        ::djinni::jniSetScalarSlot(jniEnv, j__slot, {
+            ::djinni::jniScalarBits(::djinni::I64::fromCpp(jniEnv, r.time)),
+            ::djinni::jniScalarBits(::djinni::F64::fromCpp(jniEnv, r.value)),
+            ::djinni::jniScalarBits(::djinni::F32::fromCpp(jniEnv, r.weight)),
+            ::djinni::jniScalarBits(::djinni::Bool::fromCpp(jniEnv, r.valid)),
+        });
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+static jdouble JNICALL Java_com_dropbox_djinni_test_SampleFilter_00024CppProxy_native_1weighted(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jlong j_s_time, jdouble j_s_value, jfloat j_s_weight, jboolean j_s_valid)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::CppProxyHandle<::SampleFilter>::get(nativeRef);
+        auto r = ref->weighted(::Sample{::djinni::I64::toCpp(jniEnv, j_s_time), ::djinni::F64::toCpp(jniEnv, j_s_value), ::djinni::F32::toCpp(jniEnv, j_s_weight), ::djinni::Bool::toCpp(jniEnv, j_s_valid)});
+        return ::djinni::release(::djinni::F64::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static const JNINativeMethod s_staticNatives[] = {
+    { const_cast<char*>("create"), const_cast<char*>("()Lcom/dropbox/djinni/test/SampleFilter;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_SampleFilter_create) },
+};
+static const ::djinni::JniNativeMethods s_staticNatives_registration("com/dropbox/djinni/test/SampleFilter", s_staticNatives);
+
+static const JNINativeMethod s_cppProxyNatives[] = {
+    { const_cast<char*>("native_scale"), const_cast<char*>("(JJDFZD[J)V"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_SampleFilter_00024CppProxy_native_1scale) },
+    { const_cast<char*>("native_weighted"), const_cast<char*>("(JJDFZ)D"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_SampleFilter_00024CppProxy_native_1weighted) },
+};
+static const ::djinni::JniNativeMethods s_cppProxyNatives_registration("com/dropbox/djinni/test/SampleFilter$CppProxy", s_cppProxyNatives);
+
+}  // namespace djinni_generated
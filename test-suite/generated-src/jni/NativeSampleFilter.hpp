@@ -0,0 +1,30 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "sample_filter.hpp"
+
+namespace djinni_generated {
+
+class NativeSampleFilter final : ::djinni::JniInterface<::SampleFilter, NativeSampleFilter> {
+public:
+    using CppType = std::shared_ptr<::SampleFilter>;
+    using JniType = jobject;
+
+    using Boxed = NativeSampleFilter;
+
+    ~NativeSampleFilter();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeSampleFilter>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeSampleFilter>::get()._toJava(jniEnv, c)}; }
+
+private:
+    NativeSampleFilter();
+    friend ::djinni::JniClass<NativeSampleFilter>;
+    friend ::djinni::JniInterface<::SampleFilter, NativeSampleFilter>;
+
+};
+
+}  // namespace djinni_generated
@@ -11,7 +11,10 @@ NativeSetRecord::NativeSetRecord() = default;
 NativeSetRecord::~NativeSetRecord() = default;
 
 auto NativeSetRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
-    const auto& data = ::djinni::JniClass<NativeSetRecord>::get();
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeSetRecord>::get());
+}
+
+auto NativeSetRecord::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeSetRecord& data) -> ::djinni::LocalRef<JniType> {
     auto r = ::djinni::LocalRef<JniType>{jniEnv->NewObject(data.clazz.get(), data.jconstructor,
                                                            ::djinni::get(::djinni::Set<::djinni::String>::fromCpp(jniEnv, c.set)),
                                                            ::djinni::get(::djinni::Set<::djinni::I32>::fromCpp(jniEnv, c.iset)))};
@@ -20,9 +23,12 @@ auto NativeSetRecord::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::Loc
 }
 
 auto NativeSetRecord::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
-    ::djinni::JniLocalScope jscope(jniEnv, 3);
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeSetRecord>::get());
+}
+
+auto NativeSetRecord::toCpp(JNIEnv* jniEnv, JniType j, const NativeSetRecord& data) -> CppType {
     assert(j != nullptr);
-    const auto& data = ::djinni::JniClass<NativeSetRecord>::get();
     return {::djinni::Set<::djinni::String>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mSet)),
             ::djinni::Set<::djinni::I32>::toCpp(jniEnv, jniEnv->GetObjectField(j, data.field_mIset))};
 }
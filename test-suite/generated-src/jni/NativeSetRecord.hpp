@@ -8,17 +8,21 @@
 
 namespace djinni_generated {
 
-class NativeSetRecord final {
+class NativeSetRecord final : public ::djinni::JniRecord<NativeSetRecord> {
 public:
     using CppType = ::SetRecord;
     using JniType = jobject;
 
     using Boxed = NativeSetRecord;
 
+    static constexpr jint kLocalRefsPerRecord = 3;
+
     ~NativeSetRecord();
 
     static CppType toCpp(JNIEnv* jniEnv, JniType j);
     static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeSetRecord& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeSetRecord& data);
 
 private:
     NativeSetRecord();
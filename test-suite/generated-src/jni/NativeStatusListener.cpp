@@ -0,0 +1,38 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from coalesce.djinni
+
+#include "NativeStatusListener.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeStatusListener::NativeStatusListener() : ::djinni::JniInterface<::StatusListener, NativeStatusListener>() {}
+
+NativeStatusListener::~NativeStatusListener() = default;
+
+NativeStatusListener::JavaProxy::JavaProxy(JniType j) : JavaProxyCacheEntry(j) { }
+
+NativeStatusListener::JavaProxy::~JavaProxy() = default;
+
+void NativeStatusListener::JavaProxy::on_status(const std::string & c_phase, int32_t c_progress) {
+    if (!m_coalesced_on_status.put(c_phase, c_progress)) {
+        return;
+    }
+    auto self = shared_from_this();
+    m_coalesced_on_status.schedule([self](JNIEnv* jniEnv) {
+        const auto c_args = self->m_coalesced_on_status.take();
+        if (!c_args) {
+            return;
+        }
+        const auto& c_phase = std::get<0>(*c_args);
+        const auto& c_progress = std::get<1>(*c_args);
+        ::djinni::JniLocalScope jscope(jniEnv, 10);
+        const auto& data = ::djinni::JniClass<::djinni_generated::NativeStatusListener>::get();
+        jniEnv->CallVoidMethod(self->getGlobalRef(), data.method_onStatus,
+                               ::djinni::get(::djinni::String::fromCpp(jniEnv, c_phase)),
+                               ::djinni::get(::djinni::I32::fromCpp(jniEnv, c_progress)));
+        ::djinni::jniExceptionCheck(jniEnv);
+    });
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from coalesce.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "status_listener.hpp"
+
+namespace djinni_generated {
+
+class NativeStatusListener final : ::djinni::JniInterface<::StatusListener, NativeStatusListener> {
+public:
+    using CppType = std::shared_ptr<::StatusListener>;
+    using JniType = jobject;
+
+    using Boxed = NativeStatusListener;
+
+    ~NativeStatusListener();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeStatusListener>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeStatusListener>::get()._toJava(jniEnv, c)}; }
+
+private:
+    NativeStatusListener();
+    friend ::djinni::JniClass<NativeStatusListener>;
+    friend ::djinni::JniInterface<::StatusListener, NativeStatusListener>;
+
+    class JavaProxy final : ::djinni::JavaProxyCacheEntry, public ::StatusListener, public std::enable_shared_from_this<JavaProxy>
+    {
+    public:
+        JavaProxy(JniType j);
+        ~JavaProxy();
+
+        void on_status(const std::string & phase, int32_t progress) override;
+
+    private:
+        using ::djinni::JavaProxyCacheEntry::getGlobalRef;
+        friend ::djinni::JniInterface<::StatusListener, ::djinni_generated::NativeStatusListener>;
+        friend ::djinni::JavaProxyCache<JavaProxy>;
+        ::djinni::JniCoalescedCall<std::string, int32_t> m_coalesced_on_status;
+    };
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/StatusListener") };
+    const jfieldID field_djinniIdentityHash { ::djinni::jniGetFieldID(clazz.get(), "djinniIdentityHash", "I") };
+    const jmethodID method_onStatus { ::djinni::jniGetMethodID(clazz.get(), "onStatus", "(Ljava/lang/String;I)V") };
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,120 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+#include "NativeTally.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeTally.hpp"
+#include "NativeWireSmall.hpp"
+
+namespace djinni_generated {
+
+NativeTally::NativeTally() : ::djinni::JniInterface<::Tally, NativeTally>("com/dropbox/djinni/test/Tally$CppProxy") {}
+
+NativeTally::~NativeTally() = default;
+
+
+static jobject JNICALL Java_com_dropbox_djinni_test_Tally_create(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto r = ::Tally::create();
+        return ::djinni::release(::djinni_generated::NativeTally::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static jlong JNICALL Java_com_dropbox_djinni_test_Tally_00024CppProxy_native_1add(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jlong j_amount)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::CppProxyHandle<::Tally>::get(nativeRef);
+        auto r = ref->add(::djinni::I64::toCpp(jniEnv, j_amount));
+        return ::djinni::release(::djinni::I64::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static jint JNICALL Java_com_dropbox_djinni_test_Tally_00024CppProxy_native_1remember(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jobject j_item)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::CppProxyHandle<::Tally>::get(nativeRef);
+        auto r = ref->remember(::djinni_generated::NativeWireSmall::toCpp(jniEnv, j_item));
+        return ::djinni::release(::djinni::I32::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static jobject JNICALL Java_com_dropbox_djinni_test_Tally_00024CppProxy_native_1labels(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::CppProxyHandle<::Tally>::get(nativeRef);
+        auto r = ref->labels();
+        return ::djinni::release(::djinni::List<::djinni::String>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static void JNICALL Java_com_dropbox_djinni_test_Tally_00024CppProxy_native_1clear(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::CppProxyHandle<::Tally>::get(nativeRef);
+        ref->clear();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+static jobject JNICALL Java_com_dropbox_djinni_test_Tally_00024CppProxy_native_1fork(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::CppProxyHandle<::Tally>::get(nativeRef);
+        auto r = ref->fork();
+        return ::djinni::release(::djinni_generated::NativeTally::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static jbyteArray JNICALL Java_com_dropbox_djinni_test_Tally_00024CppProxy_native_1djinniExecuteBatch(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef, jbyteArray j_calls)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
+        const auto& ref = ::djinni::CppProxyHandle<::Tally>::get(nativeRef);
+        return ::djinni::jniExecuteBatch(jniEnv, j_calls, [&](::djinni::WireReader& reader, ::djinni::WireWriter& writer, size_t method) {
+            switch (method) {
+                case 0: {
+                    auto c_amount = ::djinni::Wire<::djinni::I64>::read(reader);
+                    ::djinni::Wire<::djinni::I64>::write(writer, ref->add(c_amount));
+                    return;
+                }
+                case 1: {
+                    auto c_item = ::djinni::Wire<::djinni_generated::NativeWireSmall>::read(reader);
+                    ::djinni::Wire<::djinni::I32>::write(writer, ref->remember(c_item));
+                    return;
+                }
+                case 2: {
+                    ::djinni::Wire<::djinni::List<::djinni::String>>::write(writer, ref->labels());
+                    return;
+                }
+                case 3: {
+                    ref->clear();
+                    return;
+                }
+            }
+            throw std::out_of_range("unknown batch method");
+        }).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static const JNINativeMethod s_staticNatives[] = {
+    { const_cast<char*>("create"), const_cast<char*>("()Lcom/dropbox/djinni/test/Tally;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_Tally_create) },
+};
+static const ::djinni::JniNativeMethods s_staticNatives_registration("com/dropbox/djinni/test/Tally", s_staticNatives);
+
+static const JNINativeMethod s_cppProxyNatives[] = {
+    { const_cast<char*>("native_add"), const_cast<char*>("(JJ)J"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_Tally_00024CppProxy_native_1add) },
+    { const_cast<char*>("native_remember"), const_cast<char*>("(JLcom/dropbox/djinni/test/WireSmall;)I"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_Tally_00024CppProxy_native_1remember) },
+    { const_cast<char*>("native_labels"), const_cast<char*>("(J)Ljava/util/ArrayList;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_Tally_00024CppProxy_native_1labels) },
+    { const_cast<char*>("native_clear"), const_cast<char*>("(J)V"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_Tally_00024CppProxy_native_1clear) },
+    { const_cast<char*>("native_fork"), const_cast<char*>("(J)Lcom/dropbox/djinni/test/Tally;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_Tally_00024CppProxy_native_1fork) },
+    { const_cast<char*>("native_djinniExecuteBatch"), const_cast<char*>("(J[B)[B"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_Tally_00024CppProxy_native_1djinniExecuteBatch) },
+};
+static const ::djinni::JniNativeMethods s_cppProxyNatives_registration("com/dropbox/djinni/test/Tally$CppProxy", s_cppProxyNatives);
+
+}  // namespace djinni_generated
@@ -0,0 +1,30 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "tally.hpp"
+
+namespace djinni_generated {
+
+class NativeTally final : ::djinni::JniInterface<::Tally, NativeTally> {
+public:
+    using CppType = std::shared_ptr<::Tally>;
+    using JniType = jobject;
+
+    using Boxed = NativeTally;
+
+    ~NativeTally();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j) { return ::djinni::JniClass<NativeTally>::get()._fromJava(jniEnv, j); }
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c) { return {jniEnv, ::djinni::JniClass<NativeTally>::get()._toJava(jniEnv, c)}; }
+
+private:
+    NativeTally();
+    friend ::djinni::JniClass<NativeTally>;
+    friend ::djinni::JniInterface<::Tally, NativeTally>;
+
+};
+
+}  // namespace djinni_generated
@@ -8,6 +8,7 @@
 #include "NativeColor.hpp"
 #include "NativeMapListRecord.hpp"
 #include "NativeNestedCollection.hpp"
+#include "NativePrimitiveArrays.hpp"
 #include "NativePrimitiveList.hpp"
 #include "NativeSetRecord.hpp"
 #include "NativeToken.hpp"
@@ -19,15 +20,7 @@ NativeTestHelpers::NativeTestHelpers() : ::djinni::JniInterface<::TestHelpers, N
 NativeTestHelpers::~NativeTestHelpers() = default;
 
 
-CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
-{
-    try {
-        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
-        delete reinterpret_cast<djinni::CppProxyHandle<::TestHelpers>*>(nativeRef);
-    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
-}
-
-CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getSetRecord(JNIEnv* jniEnv, jobject /*this*/)
+static jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getSetRecord(JNIEnv* jniEnv, jobject /*this*/)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -36,7 +29,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getSetRecord
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkSetRecord(JNIEnv* jniEnv, jobject /*this*/, jobject j_rec)
+static jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkSetRecord(JNIEnv* jniEnv, jobject /*this*/, jobject j_rec)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -45,7 +38,7 @@ CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkSetRec
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getPrimitiveList(JNIEnv* jniEnv, jobject /*this*/)
+static jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getPrimitiveList(JNIEnv* jniEnv, jobject /*this*/)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -54,7 +47,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getPrimitive
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkPrimitiveList(JNIEnv* jniEnv, jobject /*this*/, jobject j_pl)
+static jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkPrimitiveList(JNIEnv* jniEnv, jobject /*this*/, jobject j_pl)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -63,7 +56,70 @@ CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkPrimit
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getNestedCollection(JNIEnv* jniEnv, jobject /*this*/)
+static jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getPrimitiveArrays(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto r = ::TestHelpers::get_primitive_arrays();
+        return ::djinni::release(::djinni_generated::NativePrimitiveArrays::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkPrimitiveArrays(JNIEnv* jniEnv, jobject /*this*/, jobject j_pa)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto r = ::TestHelpers::check_primitive_arrays(::djinni_generated::NativePrimitiveArrays::toCpp(jniEnv, j_pa));
+        return ::djinni::release(::djinni::Bool::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static jlongArray JNICALL Java_com_dropbox_djinni_test_TestHelpers_reverseI64Array(JNIEnv* jniEnv, jobject /*this*/, jlongArray j_a)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto r = ::TestHelpers::reverse_i64_array(::djinni::Array<::djinni::I64>::toCpp(jniEnv, j_a));
+        return ::djinni::release(::djinni::Array<::djinni::I64>::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_makeBuffer(JNIEnv* jniEnv, jobject /*this*/, jint j_size)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto r = ::TestHelpers::make_buffer(::djinni::I32::toCpp(jniEnv, j_size));
+        return ::djinni::release(::djinni::Buffer::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static jlong JNICALL Java_com_dropbox_djinni_test_TestHelpers_sumBuffer(JNIEnv* jniEnv, jobject /*this*/, jobject j_b)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto r = ::TestHelpers::sum_buffer(::djinni::Buffer::toCpp(jniEnv, j_b));
+        return ::djinni::release(::djinni::I64::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static void JNICALL Java_com_dropbox_djinni_test_TestHelpers_fillBuffer(JNIEnv* jniEnv, jobject /*this*/, jobject j_b, jbyte j_value)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        ::TestHelpers::fill_buffer(::djinni::Buffer::toCpp(jniEnv, j_b),
+                                   ::djinni::I8::toCpp(jniEnv, j_value));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+static jint JNICALL Java_com_dropbox_djinni_test_TestHelpers_liveBufferCount(JNIEnv* jniEnv, jobject /*this*/)
+{
+    try {
+        DJINNI_FUNCTION_PROLOGUE0(jniEnv);
+        auto r = ::TestHelpers::live_buffer_count();
+        return ::djinni::release(::djinni::I32::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
+}
+
+static jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getNestedCollection(JNIEnv* jniEnv, jobject /*this*/)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -72,7 +128,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getNestedCol
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkNestedCollection(JNIEnv* jniEnv, jobject /*this*/, jobject j_nc)
+static jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkNestedCollection(JNIEnv* jniEnv, jobject /*this*/, jobject j_nc)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -81,7 +137,7 @@ CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkNested
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getMap(JNIEnv* jniEnv, jobject /*this*/)
+static jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getMap(JNIEnv* jniEnv, jobject /*this*/)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -90,7 +146,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getMap(JNIEn
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkMap(JNIEnv* jniEnv, jobject /*this*/, jobject j_m)
+static jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkMap(JNIEnv* jniEnv, jobject /*this*/, jobject j_m)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -99,7 +155,7 @@ CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkMap(JN
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getEmptyMap(JNIEnv* jniEnv, jobject /*this*/)
+static jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getEmptyMap(JNIEnv* jniEnv, jobject /*this*/)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -108,7 +164,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getEmptyMap(
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkEmptyMap(JNIEnv* jniEnv, jobject /*this*/, jobject j_m)
+static jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkEmptyMap(JNIEnv* jniEnv, jobject /*this*/, jobject j_m)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -117,7 +173,7 @@ CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkEmptyM
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getMapListRecord(JNIEnv* jniEnv, jobject /*this*/)
+static jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getMapListRecord(JNIEnv* jniEnv, jobject /*this*/)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -126,7 +182,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_getMapListRe
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkMapListRecord(JNIEnv* jniEnv, jobject /*this*/, jobject j_m)
+static jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkMapListRecord(JNIEnv* jniEnv, jobject /*this*/, jobject j_m)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -135,7 +191,7 @@ CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkMapLis
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkClientInterfaceAscii(JNIEnv* jniEnv, jobject /*this*/, jobject j_i)
+static void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkClientInterfaceAscii(JNIEnv* jniEnv, jobject /*this*/, jobject j_i)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -143,7 +199,7 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkClientInte
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
-CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkClientInterfaceNonascii(JNIEnv* jniEnv, jobject /*this*/, jobject j_i)
+static void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkClientInterfaceNonascii(JNIEnv* jniEnv, jobject /*this*/, jobject j_i)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -151,7 +207,7 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkClientInte
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
-CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkEnumMap(JNIEnv* jniEnv, jobject /*this*/, jobject j_m)
+static void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkEnumMap(JNIEnv* jniEnv, jobject /*this*/, jobject j_m)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -159,7 +215,7 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkEnumMap(JN
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
-CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkEnum(JNIEnv* jniEnv, jobject /*this*/, jobject j_c)
+static void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkEnum(JNIEnv* jniEnv, jobject /*this*/, jobject j_c)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -167,7 +223,7 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkEnum(JNIEn
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
-CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_tokenId(JNIEnv* jniEnv, jobject /*this*/, jobject j_t)
+static jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_tokenId(JNIEnv* jniEnv, jobject /*this*/, jobject j_t)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -176,7 +232,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_tokenId(JNIE
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_createCppToken(JNIEnv* jniEnv, jobject /*this*/)
+static jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_createCppToken(JNIEnv* jniEnv, jobject /*this*/)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -185,7 +241,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_createCppTok
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkCppToken(JNIEnv* jniEnv, jobject /*this*/, jobject j_t)
+static void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkCppToken(JNIEnv* jniEnv, jobject /*this*/, jobject j_t)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -193,7 +249,7 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkCppToken(J
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
-CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_TestHelpers_cppTokenId(JNIEnv* jniEnv, jobject /*this*/, jobject j_t)
+static jlong JNICALL Java_com_dropbox_djinni_test_TestHelpers_cppTokenId(JNIEnv* jniEnv, jobject /*this*/, jobject j_t)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -202,7 +258,7 @@ CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_TestHelpers_cppTokenId(JNI
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkTokenType(JNIEnv* jniEnv, jobject /*this*/, jobject j_t, jstring j_type)
+static void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkTokenType(JNIEnv* jniEnv, jobject /*this*/, jobject j_t, jstring j_type)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -211,7 +267,7 @@ CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_TestHelpers_checkTokenType(
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
 }
 
-CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_returnNone(JNIEnv* jniEnv, jobject /*this*/)
+static jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_returnNone(JNIEnv* jniEnv, jobject /*this*/)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -220,7 +276,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_returnNone(J
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_assortedPrimitivesId(JNIEnv* jniEnv, jobject /*this*/, jobject j_i)
+static jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_assortedPrimitivesId(JNIEnv* jniEnv, jobject /*this*/, jobject j_i)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -229,7 +285,7 @@ CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_TestHelpers_assortedPrim
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
-CJNIEXPORT jbyteArray JNICALL Java_com_dropbox_djinni_test_TestHelpers_idBinary(JNIEnv* jniEnv, jobject /*this*/, jbyteArray j_b)
+static jbyteArray JNICALL Java_com_dropbox_djinni_test_TestHelpers_idBinary(JNIEnv* jniEnv, jobject /*this*/, jbyteArray j_b)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE0(jniEnv);
@@ -238,4 +294,39 @@ CJNIEXPORT jbyteArray JNICALL Java_com_dropbox_djinni_test_TestHelpers_idBinary(
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+static const JNINativeMethod s_staticNatives[] = {
+    { const_cast<char*>("getSetRecord"), const_cast<char*>("()Lcom/dropbox/djinni/test/SetRecord;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_getSetRecord) },
+    { const_cast<char*>("checkSetRecord"), const_cast<char*>("(Lcom/dropbox/djinni/test/SetRecord;)Z"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkSetRecord) },
+    { const_cast<char*>("getPrimitiveList"), const_cast<char*>("()Lcom/dropbox/djinni/test/PrimitiveList;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_getPrimitiveList) },
+    { const_cast<char*>("checkPrimitiveList"), const_cast<char*>("(Lcom/dropbox/djinni/test/PrimitiveList;)Z"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkPrimitiveList) },
+    { const_cast<char*>("getPrimitiveArrays"), const_cast<char*>("()Lcom/dropbox/djinni/test/PrimitiveArrays;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_getPrimitiveArrays) },
+    { const_cast<char*>("checkPrimitiveArrays"), const_cast<char*>("(Lcom/dropbox/djinni/test/PrimitiveArrays;)Z"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkPrimitiveArrays) },
+    { const_cast<char*>("reverseI64Array"), const_cast<char*>("([J)[J"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_reverseI64Array) },
+    { const_cast<char*>("makeBuffer"), const_cast<char*>("(I)Ljava/nio/ByteBuffer;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_makeBuffer) },
+    { const_cast<char*>("sumBuffer"), const_cast<char*>("(Ljava/nio/ByteBuffer;)J"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_sumBuffer) },
+    { const_cast<char*>("fillBuffer"), const_cast<char*>("(Ljava/nio/ByteBuffer;B)V"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_fillBuffer) },
+    { const_cast<char*>("liveBufferCount"), const_cast<char*>("()I"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_liveBufferCount) },
+    { const_cast<char*>("getNestedCollection"), const_cast<char*>("()Lcom/dropbox/djinni/test/NestedCollection;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_getNestedCollection) },
+    { const_cast<char*>("checkNestedCollection"), const_cast<char*>("(Lcom/dropbox/djinni/test/NestedCollection;)Z"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkNestedCollection) },
+    { const_cast<char*>("getMap"), const_cast<char*>("()Ljava/util/HashMap;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_getMap) },
+    { const_cast<char*>("checkMap"), const_cast<char*>("(Ljava/util/HashMap;)Z"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkMap) },
+    { const_cast<char*>("getEmptyMap"), const_cast<char*>("()Ljava/util/HashMap;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_getEmptyMap) },
+    { const_cast<char*>("checkEmptyMap"), const_cast<char*>("(Ljava/util/HashMap;)Z"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkEmptyMap) },
+    { const_cast<char*>("getMapListRecord"), const_cast<char*>("()Lcom/dropbox/djinni/test/MapListRecord;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_getMapListRecord) },
+    { const_cast<char*>("checkMapListRecord"), const_cast<char*>("(Lcom/dropbox/djinni/test/MapListRecord;)Z"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkMapListRecord) },
+    { const_cast<char*>("checkClientInterfaceAscii"), const_cast<char*>("(Lcom/dropbox/djinni/test/ClientInterface;)V"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkClientInterfaceAscii) },
+    { const_cast<char*>("checkClientInterfaceNonascii"), const_cast<char*>("(Lcom/dropbox/djinni/test/ClientInterface;)V"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkClientInterfaceNonascii) },
+    { const_cast<char*>("checkEnumMap"), const_cast<char*>("(Ljava/util/HashMap;)V"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkEnumMap) },
+    { const_cast<char*>("checkEnum"), const_cast<char*>("(Lcom/dropbox/djinni/test/Color;)V"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkEnum) },
+    { const_cast<char*>("tokenId"), const_cast<char*>("(Lcom/dropbox/djinni/test/Token;)Lcom/dropbox/djinni/test/Token;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_tokenId) },
+    { const_cast<char*>("createCppToken"), const_cast<char*>("()Lcom/dropbox/djinni/test/Token;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_createCppToken) },
+    { const_cast<char*>("checkCppToken"), const_cast<char*>("(Lcom/dropbox/djinni/test/Token;)V"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkCppToken) },
+    { const_cast<char*>("cppTokenId"), const_cast<char*>("(Lcom/dropbox/djinni/test/Token;)J"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_cppTokenId) },
+    { const_cast<char*>("checkTokenType"), const_cast<char*>("(Lcom/dropbox/djinni/test/Token;Ljava/lang/String;)V"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_checkTokenType) },
+    { const_cast<char*>("returnNone"), const_cast<char*>("()Ljava/lang/Integer;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_returnNone) },
+    { const_cast<char*>("assortedPrimitivesId"), const_cast<char*>("(Lcom/dropbox/djinni/test/AssortedPrimitives;)Lcom/dropbox/djinni/test/AssortedPrimitives;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_assortedPrimitivesId) },
+    { const_cast<char*>("idBinary"), const_cast<char*>("([B)[B"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_TestHelpers_idBinary) },
+};
+static const ::djinni::JniNativeMethods s_staticNatives_registration("com/dropbox/djinni/test/TestHelpers", s_staticNatives);
+
 }  // namespace djinni_generated
@@ -23,15 +23,7 @@ std::string NativeToken::JavaProxy::whoami() {
     return ::djinni::String::toCpp(jniEnv, jret);
 }
 
-CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_Token_00024CppProxy_nativeDestroy(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
-{
-    try {
-        DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
-        delete reinterpret_cast<djinni::CppProxyHandle<::Token>*>(nativeRef);
-    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
-}
-
-CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_Token_00024CppProxy_native_1whoami(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
+static jstring JNICALL Java_com_dropbox_djinni_test_Token_00024CppProxy_native_1whoami(JNIEnv* jniEnv, jobject /*this*/, jlong nativeRef)
 {
     try {
         DJINNI_FUNCTION_PROLOGUE1(jniEnv, nativeRef);
@@ -41,4 +33,9 @@ CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_Token_00024CppProxy_nati
     } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0 /* value doesn't matter */)
 }
 
+static const JNINativeMethod s_cppProxyNatives[] = {
+    { const_cast<char*>("native_whoami"), const_cast<char*>("(J)Ljava/lang/String;"), reinterpret_cast<void*>(&Java_com_dropbox_djinni_test_Token_00024CppProxy_native_1whoami) },
+};
+static const ::djinni::JniNativeMethods s_cppProxyNatives_registration("com/dropbox/djinni/test/Token$CppProxy", s_cppProxyNatives);
+
 }  // namespace djinni_generated
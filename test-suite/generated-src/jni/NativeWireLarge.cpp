@@ -0,0 +1,60 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#include "NativeWireLarge.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeWireMedium.hpp"
+#include "NativeWireSmall.hpp"
+
+namespace djinni_generated {
+
+NativeWireLarge::NativeWireLarge() = default;
+
+NativeWireLarge::~NativeWireLarge() = default;
+
+auto NativeWireLarge::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeWireLarge>::get());
+}
+
+auto NativeWireLarge::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeWireLarge& data) -> ::djinni::LocalRef<JniType> {
+    ::djinni::WireWriter writer;
+    writeWire(writer, c);
+    auto message = ::djinni::jniWireMessage(jniEnv, writer);
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->CallStaticObjectMethod(data.clazz.get(), data.method_fromWire, message.get())};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeWireLarge::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeWireLarge>::get());
+}
+
+auto NativeWireLarge::toCpp(JNIEnv* jniEnv, JniType j, const NativeWireLarge& data) -> CppType {
+    assert(j != nullptr);
+    auto message = ::djinni::LocalRef<jbyteArray>(jniEnv, static_cast<jbyteArray>(jniEnv->CallObjectMethod(j, data.method_toWire)));
+    ::djinni::jniExceptionCheck(jniEnv);
+    return ::djinni::jniWireRead<NativeWireLarge>(jniEnv, message.get());
+}
+
+void NativeWireLarge::writeWire(::djinni::WireWriter& w, const CppType& c) {
+    ::djinni::Wire<::djinni_generated::NativeWireMedium>::write(w, c.header);
+    ::djinni::Wire<::djinni::List<::djinni_generated::NativeWireSmall>>::write(w, c.items);
+    ::djinni::Wire<::djinni::Map<::djinni::String, ::djinni::I32>>::write(w, c.attributes);
+    ::djinni::Wire<::djinni::Set<::djinni::I64>>::write(w, c.members);
+    ::djinni::Wire<::djinni::Binary>::write(w, c.payload);
+    ::djinni::Wire<::djinni::Array<::djinni::F64>>::write(w, c.weights);
+    ::djinni::Wire<::djinni::Optional<std::experimental::optional, ::djinni::String>>::write(w, c.note);
+}
+
+auto NativeWireLarge::readWire(::djinni::WireReader& r) -> CppType {
+    return {::djinni::Wire<::djinni_generated::NativeWireMedium>::read(r),
+            ::djinni::Wire<::djinni::List<::djinni_generated::NativeWireSmall>>::read(r),
+            ::djinni::Wire<::djinni::Map<::djinni::String, ::djinni::I32>>::read(r),
+            ::djinni::Wire<::djinni::Set<::djinni::I64>>::read(r),
+            ::djinni::Wire<::djinni::Binary>::read(r),
+            ::djinni::Wire<::djinni::Array<::djinni::F64>>::read(r),
+            ::djinni::Wire<::djinni::Optional<std::experimental::optional, ::djinni::String>>::read(r)};
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,39 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "djinni_wire.hpp"
+#include "wire_large.hpp"
+
+namespace djinni_generated {
+
+class NativeWireLarge final : public ::djinni::JniRecord<NativeWireLarge> {
+public:
+    using CppType = ::WireLarge;
+    using JniType = jobject;
+
+    using Boxed = NativeWireLarge;
+
+    static constexpr jint kLocalRefsPerRecord = 2;
+
+    ~NativeWireLarge();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeWireLarge& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeWireLarge& data);
+    static void writeWire(::djinni::WireWriter& w, const CppType& c);
+    static CppType readWire(::djinni::WireReader& r);
+
+private:
+    NativeWireLarge();
+    friend ::djinni::JniClass<NativeWireLarge>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/WireLarge") };
+    const jmethodID method_toWire { ::djinni::jniGetMethodID(clazz.get(), "toWire", "()[B") };
+    const jmethodID method_fromWire { ::djinni::jniGetStaticMethodID(clazz.get(), "fromWire", "([B)Lcom/dropbox/djinni/test/WireLarge;") };
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,57 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#include "NativeWireMedium.hpp"  // my header
+#include "Marshal.hpp"
+#include "NativeColor.hpp"
+
+namespace djinni_generated {
+
+NativeWireMedium::NativeWireMedium() = default;
+
+NativeWireMedium::~NativeWireMedium() = default;
+
+auto NativeWireMedium::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeWireMedium>::get());
+}
+
+auto NativeWireMedium::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeWireMedium& data) -> ::djinni::LocalRef<JniType> {
+    ::djinni::WireWriter writer;
+    writeWire(writer, c);
+    auto message = ::djinni::jniWireMessage(jniEnv, writer);
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->CallStaticObjectMethod(data.clazz.get(), data.method_fromWire, message.get())};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeWireMedium::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeWireMedium>::get());
+}
+
+auto NativeWireMedium::toCpp(JNIEnv* jniEnv, JniType j, const NativeWireMedium& data) -> CppType {
+    assert(j != nullptr);
+    auto message = ::djinni::LocalRef<jbyteArray>(jniEnv, static_cast<jbyteArray>(jniEnv->CallObjectMethod(j, data.method_toWire)));
+    ::djinni::jniExceptionCheck(jniEnv);
+    return ::djinni::jniWireRead<NativeWireMedium>(jniEnv, message.get());
+}
+
+void NativeWireMedium::writeWire(::djinni::WireWriter& w, const CppType& c) {
+    ::djinni::Wire<::djinni::I64>::write(w, c.serial);
+    ::djinni::Wire<::djinni::String>::write(w, c.name);
+    ::djinni::Wire<::djinni::List<::djinni::String>>::write(w, c.tags);
+    ::djinni::Wire<::djinni::Optional<std::experimental::optional, ::djinni::F32>>::write(w, c.rating);
+    ::djinni::Wire<::djinni_generated::NativeColor>::write(w, c.shade);
+    ::djinni::Wire<::djinni::Date>::write(w, c.created);
+}
+
+auto NativeWireMedium::readWire(::djinni::WireReader& r) -> CppType {
+    return {::djinni::Wire<::djinni::I64>::read(r),
+            ::djinni::Wire<::djinni::String>::read(r),
+            ::djinni::Wire<::djinni::List<::djinni::String>>::read(r),
+            ::djinni::Wire<::djinni::Optional<std::experimental::optional, ::djinni::F32>>::read(r),
+            ::djinni::Wire<::djinni_generated::NativeColor>::read(r),
+            ::djinni::Wire<::djinni::Date>::read(r)};
+}
+
+}  // namespace djinni_generated
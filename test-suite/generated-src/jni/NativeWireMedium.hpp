@@ -0,0 +1,39 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "djinni_wire.hpp"
+#include "wire_medium.hpp"
+
+namespace djinni_generated {
+
+class NativeWireMedium final : public ::djinni::JniRecord<NativeWireMedium> {
+public:
+    using CppType = ::WireMedium;
+    using JniType = jobject;
+
+    using Boxed = NativeWireMedium;
+
+    static constexpr jint kLocalRefsPerRecord = 2;
+
+    ~NativeWireMedium();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeWireMedium& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeWireMedium& data);
+    static void writeWire(::djinni::WireWriter& w, const CppType& c);
+    static CppType readWire(::djinni::WireReader& r);
+
+private:
+    NativeWireMedium();
+    friend ::djinni::JniClass<NativeWireMedium>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/WireMedium") };
+    const jmethodID method_toWire { ::djinni::jniGetMethodID(clazz.get(), "toWire", "()[B") };
+    const jmethodID method_fromWire { ::djinni::jniGetStaticMethodID(clazz.get(), "fromWire", "([B)Lcom/dropbox/djinni/test/WireMedium;") };
+};
+
+}  // namespace djinni_generated
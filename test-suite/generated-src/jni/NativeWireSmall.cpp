@@ -0,0 +1,50 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#include "NativeWireSmall.hpp"  // my header
+#include "Marshal.hpp"
+
+namespace djinni_generated {
+
+NativeWireSmall::NativeWireSmall() = default;
+
+NativeWireSmall::~NativeWireSmall() = default;
+
+auto NativeWireSmall::fromCpp(JNIEnv* jniEnv, const CppType& c) -> ::djinni::LocalRef<JniType> {
+    return fromCpp(jniEnv, c, ::djinni::JniClass<NativeWireSmall>::get());
+}
+
+auto NativeWireSmall::fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeWireSmall& data) -> ::djinni::LocalRef<JniType> {
+    ::djinni::WireWriter writer;
+    writeWire(writer, c);
+    auto message = ::djinni::jniWireMessage(jniEnv, writer);
+    auto r = ::djinni::LocalRef<JniType>{jniEnv->CallStaticObjectMethod(data.clazz.get(), data.method_fromWire, message.get())};
+    ::djinni::jniExceptionCheck(jniEnv);
+    return r;
+}
+
+auto NativeWireSmall::toCpp(JNIEnv* jniEnv, JniType j) -> CppType {
+    ::djinni::JniLocalScope jscope(jniEnv, kLocalRefsPerRecord);
+    return toCpp(jniEnv, j, ::djinni::JniClass<NativeWireSmall>::get());
+}
+
+auto NativeWireSmall::toCpp(JNIEnv* jniEnv, JniType j, const NativeWireSmall& data) -> CppType {
+    assert(j != nullptr);
+    auto message = ::djinni::LocalRef<jbyteArray>(jniEnv, static_cast<jbyteArray>(jniEnv->CallObjectMethod(j, data.method_toWire)));
+    ::djinni::jniExceptionCheck(jniEnv);
+    return ::djinni::jniWireRead<NativeWireSmall>(jniEnv, message.get());
+}
+
+void NativeWireSmall::writeWire(::djinni::WireWriter& w, const CppType& c) {
+    ::djinni::Wire<::djinni::I64>::write(w, c.serial);
+    ::djinni::Wire<::djinni::String>::write(w, c.label);
+    ::djinni::Wire<::djinni::F64>::write(w, c.score);
+}
+
+auto NativeWireSmall::readWire(::djinni::WireReader& r) -> CppType {
+    return {::djinni::Wire<::djinni::I64>::read(r),
+            ::djinni::Wire<::djinni::String>::read(r),
+            ::djinni::Wire<::djinni::F64>::read(r)};
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,39 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#pragma once
+
+#include "djinni_support.hpp"
+#include "djinni_wire.hpp"
+#include "wire_small.hpp"
+
+namespace djinni_generated {
+
+class NativeWireSmall final : public ::djinni::JniRecord<NativeWireSmall> {
+public:
+    using CppType = ::WireSmall;
+    using JniType = jobject;
+
+    using Boxed = NativeWireSmall;
+
+    static constexpr jint kLocalRefsPerRecord = 2;
+
+    ~NativeWireSmall();
+
+    static CppType toCpp(JNIEnv* jniEnv, JniType j);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c);
+    static CppType toCpp(JNIEnv* jniEnv, JniType j, const NativeWireSmall& data);
+    static ::djinni::LocalRef<JniType> fromCpp(JNIEnv* jniEnv, const CppType& c, const NativeWireSmall& data);
+    static void writeWire(::djinni::WireWriter& w, const CppType& c);
+    static CppType readWire(::djinni::WireReader& r);
+
+private:
+    NativeWireSmall();
+    friend ::djinni::JniClass<NativeWireSmall>;
+
+    const ::djinni::GlobalRef<jclass> clazz { ::djinni::jniFindClass("com/dropbox/djinni/test/WireSmall") };
+    const jmethodID method_toWire { ::djinni::jniGetMethodID(clazz.get(), "toWire", "()[B") };
+    const jmethodID method_fromWire { ::djinni::jniGetStaticMethodID(clazz.get(), "fromWire", "([B)Lcom/dropbox/djinni/test/WireSmall;") };
+};
+
+}  // namespace djinni_generated
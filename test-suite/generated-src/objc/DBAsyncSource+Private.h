@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+#include "async_source.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@protocol DBAsyncSource;
+
+namespace djinni_generated {
+
+class AsyncSource
+{
+public:
+    using CppType = std::shared_ptr<::AsyncSource>;
+    using ObjcType = id<DBAsyncSource>;
+
+    using Boxed = AsyncSource;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+#import "DBAsyncSource+Private.h"
+#import "DBAsyncSource.h"
+#import "DJIMarshal+Private.h"
+#import "DJIObjcWrapperCache+Private.h"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+namespace djinni_generated {
+
+class AsyncSource::ObjcProxy final
+: public ::AsyncSource
+, public ::djinni::DbxObjcWrapperCache<ObjcProxy>::Handle
+{
+public:
+    using Handle::Handle;
+    ::djinni::SharedFuture<std::string> fetch(const std::string & c_key) override
+    {
+        @autoreleasepool {
+            auto r = [(ObjcType)Handle::get() fetch:(::djinni::String::fromCpp(c_key))];
+            return ::djinni::Future<::djinni::String>::toCpp(r);
+        }
+    }
+};
+
+}  // namespace djinni_generated
+
+namespace djinni_generated {
+
+auto AsyncSource::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return ::djinni::DbxObjcWrapperCache<ObjcProxy>::getInstance()->get(objc);
+}
+
+auto AsyncSource::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return dynamic_cast<ObjcProxy&>(*cpp).Handle::get();
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,12 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+#import "DJIFuture.h"
+#import <Foundation/Foundation.h>
+
+
+@protocol DBAsyncSource
+
+- (nonnull DJIFuture *)fetch:(nonnull NSString *)key;
+
+@end
@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+#include "async_worker.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBAsyncWorker;
+
+namespace djinni_generated {
+
+class AsyncWorker
+{
+public:
+    using CppType = std::shared_ptr<::AsyncWorker>;
+    using ObjcType = DBAsyncWorker*;
+
+    using Boxed = AsyncWorker;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
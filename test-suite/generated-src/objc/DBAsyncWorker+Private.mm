@@ -0,0 +1,88 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+#import "DBAsyncWorker+Private.h"
+#import "DBAsyncWorker.h"
+#import "DBAsyncSource+Private.h"
+#import "DBAsyncWorker+Private.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBAsyncWorker ()
+
+@property (nonatomic, readonly) ::djinni::DbxCppWrapperCache<::AsyncWorker>::Handle cppRef;
+
+- (id)initWithCpp:(const std::shared_ptr<::AsyncWorker>&)cppRef;
+
+@end
+
+@implementation DBAsyncWorker
+
+- (id)initWithCpp:(const std::shared_ptr<::AsyncWorker>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRef.assign(cppRef);
+    }
+    return self;
+}
+
++ (nullable DBAsyncWorker *)create {
+    try {
+        auto r = ::AsyncWorker::create();
+        return ::djinni_generated::AsyncWorker::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (nonnull DJIFuture *)add:(int64_t)a
+                         b:(int64_t)b {
+    try {
+        auto r = _cppRef.get()->add(::djinni::I64::toCpp(a),
+                                    ::djinni::I64::toCpp(b));
+        return ::djinni::Future<::djinni::I64>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (nonnull DJIFuture *)reverse:(nonnull NSString *)s {
+    try {
+        auto r = _cppRef.get()->reverse(::djinni::String::toCpp(s));
+        return ::djinni::Future<::djinni::String>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (nonnull DJIFuture *)measure:(nullable id<DBAsyncSource>)source
+                           key:(nonnull NSString *)key {
+    try {
+        auto r = _cppRef.get()->measure(::djinni_generated::AsyncSource::toCpp(source),
+                                        ::djinni::String::toCpp(key));
+        return ::djinni::Future<::djinni::I32>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+@end
+
+namespace djinni_generated {
+
+auto AsyncWorker::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc.cppRef.get();
+}
+
+auto AsyncWorker::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::DbxCppWrapperCache<::AsyncWorker>::getInstance()->get(cpp, [] (const CppType& p) {
+        return [[DBAsyncWorker alloc] initWithCpp:p];
+    });
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,26 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from future.djinni
+
+#import "DJIFuture.h"
+#import <Foundation/Foundation.h>
+@class DBAsyncWorker;
+@protocol DBAsyncSource;
+
+
+/** Completes the futures it returns on a native worker thread, in the order they were made. */
+@interface DBAsyncWorker : NSObject
+
++ (nullable DBAsyncWorker *)create;
+
+/** Completes with a + b. */
+- (nonnull DJIFuture *)add:(int64_t)a
+                         b:(int64_t)b;
+
+/** Completes with s reversed, or fails if s is empty. */
+- (nonnull DJIFuture *)reverse:(nonnull NSString *)s;
+
+/** Completes with the length of what source.fetch(key) completes with, without waiting for it. */
+- (nonnull DJIFuture *)measure:(nullable id<DBAsyncSource>)source
+                           key:(nonnull NSString *)key;
+
+@end
@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from oneway.djinni
+
+#include "event_sink.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@protocol DBEventSink;
+
+namespace djinni_generated {
+
+class EventSink
+{
+public:
+    using CppType = std::shared_ptr<::EventSink>;
+    using ObjcType = id<DBEventSink>;
+
+    using Boxed = EventSink;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from oneway.djinni
+
+#import "DBEventSink+Private.h"
+#import "DBEventSink.h"
+#import "DJIMarshal+Private.h"
+#import "DJIObjcWrapperCache+Private.h"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+namespace djinni_generated {
+
+class EventSink::ObjcProxy final
+: public ::EventSink
+, public ::djinni::DbxObjcWrapperCache<ObjcProxy>::Handle
+{
+public:
+    using Handle::Handle;
+    void on_event(const std::string & c_source, int32_t c_value) override
+    {
+        @autoreleasepool {
+            [(ObjcType)Handle::get() onEvent:(::djinni::String::fromCpp(c_source))
+                                       value:(::djinni::I32::fromCpp(c_value))];
+        }
+    }
+};
+
+}  // namespace djinni_generated
+
+namespace djinni_generated {
+
+auto EventSink::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return ::djinni::DbxObjcWrapperCache<ObjcProxy>::getInstance()->get(objc);
+}
+
+auto EventSink::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return dynamic_cast<ObjcProxy&>(*cpp).Handle::get();
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,14 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from oneway.djinni
+
+#import <Foundation/Foundation.h>
+
+
+/** Receives events from C++ without holding up the threads that produce them. */
+@protocol DBEventSink
+
+/** Java gets these on the djinni dispatcher thread, in the order each C++ thread made them. */
+- (void)onEvent:(nonnull NSString *)source
+          value:(int32_t)value;
+
+@end
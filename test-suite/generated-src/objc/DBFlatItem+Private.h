@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#import "DBFlatItem.h"
+#include "flat_item.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBFlatItem;
+
+namespace djinni_generated {
+
+struct FlatItem
+{
+    using CppType = ::FlatItem;
+    using ObjcType = DBFlatItem*;
+
+    using Boxed = FlatItem;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,37 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#import "DBFlatItem+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto FlatItem::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni::I64::toCpp(obj.serial),
+            ::djinni::Bool::toCpp(obj.flag),
+            ::djinni::I16::toCpp(obj.rank),
+            ::djinni::Enum<::color, DBColor>::toCpp(obj.shade),
+            ::djinni::String::toCpp(obj.name),
+            ::djinni::Optional<std::experimental::optional, ::djinni::F64>::toCpp(obj.score),
+            ::djinni::Date::toCpp(obj.created),
+            ::djinni::Binary::toCpp(obj.thumbnail),
+            ::djinni::List<::djinni::String>::toCpp(obj.tags)};
+}
+
+auto FlatItem::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[DBFlatItem alloc] initWithSerial:(::djinni::I64::fromCpp(cpp.serial))
+                                         flag:(::djinni::Bool::fromCpp(cpp.flag))
+                                         rank:(::djinni::I16::fromCpp(cpp.rank))
+                                        shade:(::djinni::Enum<::color, DBColor>::fromCpp(cpp.shade))
+                                         name:(::djinni::String::fromCpp(cpp.name))
+                                        score:(::djinni::Optional<std::experimental::optional, ::djinni::F64>::fromCpp(cpp.score))
+                                      created:(::djinni::Date::fromCpp(cpp.created))
+                                    thumbnail:(::djinni::Binary::fromCpp(cpp.thumbnail))
+                                         tags:(::djinni::List<::djinni::String>::fromCpp(cpp.tags))];
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,46 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#import "DBColor.h"
+#import <Foundation/Foundation.h>
+
+/** Laid out flat for snapshots that are read in place; see FlatRecordTest. */
+@interface DBFlatItem : NSObject
+- (nonnull instancetype)initWithSerial:(int64_t)serial
+                                  flag:(BOOL)flag
+                                  rank:(int16_t)rank
+                                 shade:(DBColor)shade
+                                  name:(nonnull NSString *)name
+                                 score:(nullable NSNumber *)score
+                               created:(nonnull NSDate *)created
+                             thumbnail:(nonnull NSData *)thumbnail
+                                  tags:(nonnull NSArray *)tags;
++ (nonnull instancetype)flatItemWithSerial:(int64_t)serial
+                                      flag:(BOOL)flag
+                                      rank:(int16_t)rank
+                                     shade:(DBColor)shade
+                                      name:(nonnull NSString *)name
+                                     score:(nullable NSNumber *)score
+                                   created:(nonnull NSDate *)created
+                                 thumbnail:(nonnull NSData *)thumbnail
+                                      tags:(nonnull NSArray *)tags;
+
+@property (nonatomic, readonly) int64_t serial;
+
+@property (nonatomic, readonly) BOOL flag;
+
+@property (nonatomic, readonly) int16_t rank;
+
+@property (nonatomic, readonly) DBColor shade;
+
+@property (nonatomic, readonly, nonnull) NSString * name;
+
+@property (nonatomic, readonly, nullable) NSNumber * score;
+
+@property (nonatomic, readonly, nonnull) NSDate * created;
+
+@property (nonatomic, readonly, nonnull) NSData * thumbnail;
+
+@property (nonatomic, readonly, nonnull) NSArray * tags;
+
+@end
@@ -0,0 +1,54 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#import "DBFlatItem.h"
+
+
+@implementation DBFlatItem
+
+- (nonnull instancetype)initWithSerial:(int64_t)serial
+                                  flag:(BOOL)flag
+                                  rank:(int16_t)rank
+                                 shade:(DBColor)shade
+                                  name:(nonnull NSString *)name
+                                 score:(nullable NSNumber *)score
+                               created:(nonnull NSDate *)created
+                             thumbnail:(nonnull NSData *)thumbnail
+                                  tags:(nonnull NSArray *)tags
+{
+    if (self = [super init]) {
+        _serial = serial;
+        _flag = flag;
+        _rank = rank;
+        _shade = shade;
+        _name = name;
+        _score = score;
+        _created = created;
+        _thumbnail = thumbnail;
+        _tags = tags;
+    }
+    return self;
+}
+
++ (nonnull instancetype)flatItemWithSerial:(int64_t)serial
+                                      flag:(BOOL)flag
+                                      rank:(int16_t)rank
+                                     shade:(DBColor)shade
+                                      name:(nonnull NSString *)name
+                                     score:(nullable NSNumber *)score
+                                   created:(nonnull NSDate *)created
+                                 thumbnail:(nonnull NSData *)thumbnail
+                                      tags:(nonnull NSArray *)tags
+{
+    return [[self alloc] initWithSerial:serial
+                                   flag:flag
+                                   rank:rank
+                                  shade:shade
+                                   name:name
+                                  score:score
+                                created:created
+                              thumbnail:thumbnail
+                                   tags:tags];
+}
+
+@end
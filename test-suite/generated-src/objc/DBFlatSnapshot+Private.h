@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#import "DBFlatSnapshot.h"
+#include "flat_snapshot.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBFlatSnapshot;
+
+namespace djinni_generated {
+
+struct FlatSnapshot
+{
+    using CppType = ::FlatSnapshot;
+    using ObjcType = DBFlatSnapshot*;
+
+    using Boxed = FlatSnapshot;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
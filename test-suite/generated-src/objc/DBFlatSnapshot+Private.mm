@@ -0,0 +1,34 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#import "DBFlatSnapshot+Private.h"
+#import "DBFlatItem+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto FlatSnapshot::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni::I32::toCpp(obj.version),
+            ::djinni::List<::djinni_generated::FlatItem>::toCpp(obj.items),
+            ::djinni::Map<::djinni::String, ::djinni::I64>::toCpp(obj.byName),
+            ::djinni::Set<::djinni::I64>::toCpp(obj.ids),
+            ::djinni::List<::djinni::F32>::toCpp(obj.weights),
+            ::djinni::Optional<std::experimental::optional, ::djinni_generated::FlatItem>::toCpp(obj.featured),
+            ::djinni::Optional<std::experimental::optional, ::djinni::String>::toCpp(obj.note)};
+}
+
+auto FlatSnapshot::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[DBFlatSnapshot alloc] initWithVersion:(::djinni::I32::fromCpp(cpp.version))
+                                             items:(::djinni::List<::djinni_generated::FlatItem>::fromCpp(cpp.items))
+                                            byName:(::djinni::Map<::djinni::String, ::djinni::I64>::fromCpp(cpp.by_name))
+                                               ids:(::djinni::Set<::djinni::I64>::fromCpp(cpp.ids))
+                                           weights:(::djinni::List<::djinni::F32>::fromCpp(cpp.weights))
+                                          featured:(::djinni::Optional<std::experimental::optional, ::djinni_generated::FlatItem>::fromCpp(cpp.featured))
+                                              note:(::djinni::Optional<std::experimental::optional, ::djinni::String>::fromCpp(cpp.note))];
+}
+
+}  // namespace djinni_generated
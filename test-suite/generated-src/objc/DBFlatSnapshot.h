@@ -0,0 +1,37 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#import "DBFlatItem.h"
+#import <Foundation/Foundation.h>
+
+@interface DBFlatSnapshot : NSObject
+- (nonnull instancetype)initWithVersion:(int32_t)version
+                                  items:(nonnull NSArray *)items
+                                 byName:(nonnull NSDictionary *)byName
+                                    ids:(nonnull NSSet *)ids
+                                weights:(nonnull NSArray *)weights
+                               featured:(nullable DBFlatItem *)featured
+                                   note:(nullable NSString *)note;
++ (nonnull instancetype)flatSnapshotWithVersion:(int32_t)version
+                                          items:(nonnull NSArray *)items
+                                         byName:(nonnull NSDictionary *)byName
+                                            ids:(nonnull NSSet *)ids
+                                        weights:(nonnull NSArray *)weights
+                                       featured:(nullable DBFlatItem *)featured
+                                           note:(nullable NSString *)note;
+
+@property (nonatomic, readonly) int32_t version;
+
+@property (nonatomic, readonly, nonnull) NSArray * items;
+
+@property (nonatomic, readonly, nonnull) NSDictionary * byName;
+
+@property (nonatomic, readonly, nonnull) NSSet * ids;
+
+@property (nonatomic, readonly, nonnull) NSArray * weights;
+
+@property (nonatomic, readonly, nullable) DBFlatItem * featured;
+
+@property (nonatomic, readonly, nullable) NSString * note;
+
+@end
@@ -0,0 +1,46 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from flat_record.djinni
+
+#import "DBFlatSnapshot.h"
+
+
+@implementation DBFlatSnapshot
+
+- (nonnull instancetype)initWithVersion:(int32_t)version
+                                  items:(nonnull NSArray *)items
+                                 byName:(nonnull NSDictionary *)byName
+                                    ids:(nonnull NSSet *)ids
+                                weights:(nonnull NSArray *)weights
+                               featured:(nullable DBFlatItem *)featured
+                                   note:(nullable NSString *)note
+{
+    if (self = [super init]) {
+        _version = version;
+        _items = items;
+        _byName = byName;
+        _ids = ids;
+        _weights = weights;
+        _featured = featured;
+        _note = note;
+    }
+    return self;
+}
+
++ (nonnull instancetype)flatSnapshotWithVersion:(int32_t)version
+                                          items:(nonnull NSArray *)items
+                                         byName:(nonnull NSDictionary *)byName
+                                            ids:(nonnull NSSet *)ids
+                                        weights:(nonnull NSArray *)weights
+                                       featured:(nullable DBFlatItem *)featured
+                                           note:(nullable NSString *)note
+{
+    return [[self alloc] initWithVersion:version
+                                   items:items
+                                  byName:byName
+                                     ids:ids
+                                 weights:weights
+                                featured:featured
+                                    note:note];
+}
+
+@end
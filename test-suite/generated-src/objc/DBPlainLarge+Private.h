@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBPlainLarge.h"
+#include "plain_large.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBPlainLarge;
+
+namespace djinni_generated {
+
+struct PlainLarge
+{
+    using CppType = ::PlainLarge;
+    using ObjcType = DBPlainLarge*;
+
+    using Boxed = PlainLarge;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
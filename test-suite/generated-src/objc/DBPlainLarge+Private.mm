@@ -0,0 +1,35 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBPlainLarge+Private.h"
+#import "DBPlainMedium+Private.h"
+#import "DBPlainSmall+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto PlainLarge::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni_generated::PlainMedium::toCpp(obj.header),
+            ::djinni::List<::djinni_generated::PlainSmall>::toCpp(obj.items),
+            ::djinni::Map<::djinni::String, ::djinni::I32>::toCpp(obj.attributes),
+            ::djinni::Set<::djinni::I64>::toCpp(obj.members),
+            ::djinni::Binary::toCpp(obj.payload),
+            ::djinni::List<::djinni::F64>::toCpp(obj.weights),
+            ::djinni::Optional<std::experimental::optional, ::djinni::String>::toCpp(obj.note)};
+}
+
+auto PlainLarge::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[DBPlainLarge alloc] initWithHeader:(::djinni_generated::PlainMedium::fromCpp(cpp.header))
+                                          items:(::djinni::List<::djinni_generated::PlainSmall>::fromCpp(cpp.items))
+                                     attributes:(::djinni::Map<::djinni::String, ::djinni::I32>::fromCpp(cpp.attributes))
+                                        members:(::djinni::Set<::djinni::I64>::fromCpp(cpp.members))
+                                        payload:(::djinni::Binary::fromCpp(cpp.payload))
+                                        weights:(::djinni::List<::djinni::F64>::fromCpp(cpp.weights))
+                                           note:(::djinni::Optional<std::experimental::optional, ::djinni::String>::fromCpp(cpp.note))];
+}
+
+}  // namespace djinni_generated
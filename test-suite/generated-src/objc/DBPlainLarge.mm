@@ -0,0 +1,46 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBPlainLarge.h"
+
+
+@implementation DBPlainLarge
+
+- (nonnull instancetype)initWithHeader:(nonnull DBPlainMedium *)header
+                                 items:(nonnull NSArray *)items
+                            attributes:(nonnull NSDictionary *)attributes
+                               members:(nonnull NSSet *)members
+                               payload:(nonnull NSData *)payload
+                               weights:(nonnull NSArray *)weights
+                                  note:(nullable NSString *)note
+{
+    if (self = [super init]) {
+        _header = header;
+        _items = items;
+        _attributes = attributes;
+        _members = members;
+        _payload = payload;
+        _weights = weights;
+        _note = note;
+    }
+    return self;
+}
+
++ (nonnull instancetype)plainLargeWithHeader:(nonnull DBPlainMedium *)header
+                                       items:(nonnull NSArray *)items
+                                  attributes:(nonnull NSDictionary *)attributes
+                                     members:(nonnull NSSet *)members
+                                     payload:(nonnull NSData *)payload
+                                     weights:(nonnull NSArray *)weights
+                                        note:(nullable NSString *)note
+{
+    return [[self alloc] initWithHeader:header
+                                  items:items
+                             attributes:attributes
+                                members:members
+                                payload:payload
+                                weights:weights
+                                   note:note];
+}
+
+@end
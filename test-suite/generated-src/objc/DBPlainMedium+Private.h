@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBPlainMedium.h"
+#include "plain_medium.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBPlainMedium;
+
+namespace djinni_generated {
+
+struct PlainMedium
+{
+    using CppType = ::PlainMedium;
+    using ObjcType = DBPlainMedium*;
+
+    using Boxed = PlainMedium;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
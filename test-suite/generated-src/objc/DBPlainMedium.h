@@ -0,0 +1,33 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBColor.h"
+#import <Foundation/Foundation.h>
+
+@interface DBPlainMedium : NSObject
+- (nonnull instancetype)initWithSerial:(int64_t)serial
+                                  name:(nonnull NSString *)name
+                                  tags:(nonnull NSArray *)tags
+                                rating:(nullable NSNumber *)rating
+                                 shade:(DBColor)shade
+                               created:(nonnull NSDate *)created;
++ (nonnull instancetype)plainMediumWithSerial:(int64_t)serial
+                                         name:(nonnull NSString *)name
+                                         tags:(nonnull NSArray *)tags
+                                       rating:(nullable NSNumber *)rating
+                                        shade:(DBColor)shade
+                                      created:(nonnull NSDate *)created;
+
+@property (nonatomic, readonly) int64_t serial;
+
+@property (nonatomic, readonly, nonnull) NSString * name;
+
+@property (nonatomic, readonly, nonnull) NSArray * tags;
+
+@property (nonatomic, readonly, nullable) NSNumber * rating;
+
+@property (nonatomic, readonly) DBColor shade;
+
+@property (nonatomic, readonly, nonnull) NSDate * created;
+
+@end
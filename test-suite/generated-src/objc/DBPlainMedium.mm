@@ -0,0 +1,42 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBPlainMedium.h"
+
+
+@implementation DBPlainMedium
+
+- (nonnull instancetype)initWithSerial:(int64_t)serial
+                                  name:(nonnull NSString *)name
+                                  tags:(nonnull NSArray *)tags
+                                rating:(nullable NSNumber *)rating
+                                 shade:(DBColor)shade
+                               created:(nonnull NSDate *)created
+{
+    if (self = [super init]) {
+        _serial = serial;
+        _name = name;
+        _tags = tags;
+        _rating = rating;
+        _shade = shade;
+        _created = created;
+    }
+    return self;
+}
+
++ (nonnull instancetype)plainMediumWithSerial:(int64_t)serial
+                                         name:(nonnull NSString *)name
+                                         tags:(nonnull NSArray *)tags
+                                       rating:(nullable NSNumber *)rating
+                                        shade:(DBColor)shade
+                                      created:(nonnull NSDate *)created
+{
+    return [[self alloc] initWithSerial:serial
+                                   name:name
+                                   tags:tags
+                                 rating:rating
+                                  shade:shade
+                                created:created];
+}
+
+@end
@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBPlainSmall.h"
+#include "plain_small.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBPlainSmall;
+
+namespace djinni_generated {
+
+struct PlainSmall
+{
+    using CppType = ::PlainSmall;
+    using ObjcType = DBPlainSmall*;
+
+    using Boxed = PlainSmall;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
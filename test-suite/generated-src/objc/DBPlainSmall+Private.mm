@@ -0,0 +1,25 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBPlainSmall+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto PlainSmall::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni::I64::toCpp(obj.serial),
+            ::djinni::String::toCpp(obj.label),
+            ::djinni::F64::toCpp(obj.score)};
+}
+
+auto PlainSmall::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[DBPlainSmall alloc] initWithSerial:(::djinni::I64::fromCpp(cpp.serial))
+                                          label:(::djinni::String::fromCpp(cpp.label))
+                                          score:(::djinni::F64::fromCpp(cpp.score))];
+}
+
+}  // namespace djinni_generated
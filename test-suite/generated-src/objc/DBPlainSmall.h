@@ -0,0 +1,20 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import <Foundation/Foundation.h>
+
+@interface DBPlainSmall : NSObject
+- (nonnull instancetype)initWithSerial:(int64_t)serial
+                                 label:(nonnull NSString *)label
+                                 score:(double)score;
++ (nonnull instancetype)plainSmallWithSerial:(int64_t)serial
+                                       label:(nonnull NSString *)label
+                                       score:(double)score;
+
+@property (nonatomic, readonly) int64_t serial;
+
+@property (nonatomic, readonly, nonnull) NSString * label;
+
+@property (nonatomic, readonly) double score;
+
+@end
@@ -0,0 +1,30 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBPlainSmall.h"
+
+
+@implementation DBPlainSmall
+
+- (nonnull instancetype)initWithSerial:(int64_t)serial
+                                 label:(nonnull NSString *)label
+                                 score:(double)score
+{
+    if (self = [super init]) {
+        _serial = serial;
+        _label = label;
+        _score = score;
+    }
+    return self;
+}
+
++ (nonnull instancetype)plainSmallWithSerial:(int64_t)serial
+                                       label:(nonnull NSString *)label
+                                       score:(double)score
+{
+    return [[self alloc] initWithSerial:serial
+                                  label:label
+                                  score:score];
+}
+
+@end
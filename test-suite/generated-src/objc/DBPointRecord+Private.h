@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_list.djinni
+
+#import "DBPointRecord.h"
+#include "point_record.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBPointRecord;
+
+namespace djinni_generated {
+
+struct PointRecord
+{
+    using CppType = ::PointRecord;
+    using ObjcType = DBPointRecord*;
+
+    using Boxed = PointRecord;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_list.djinni
+
+#import "DBPointRecord+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto PointRecord::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni::I32::toCpp(obj.x),
+            ::djinni::I32::toCpp(obj.y),
+            ::djinni::I64::toCpp(obj.key),
+            ::djinni::F64::toCpp(obj.weight),
+            ::djinni::Bool::toCpp(obj.visible)};
+}
+
+auto PointRecord::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[DBPointRecord alloc] initWithX:(::djinni::I32::fromCpp(cpp.x))
+                                          y:(::djinni::I32::fromCpp(cpp.y))
+                                        key:(::djinni::I64::fromCpp(cpp.key))
+                                     weight:(::djinni::F64::fromCpp(cpp.weight))
+                                    visible:(::djinni::Bool::fromCpp(cpp.visible))];
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_list.djinni
+
+#import <Foundation/Foundation.h>
+
+/** Only primitive fields, so lists of these cross JNI as one array per field. */
+@interface DBPointRecord : NSObject
+- (nonnull instancetype)initWithX:(int32_t)x
+                                y:(int32_t)y
+                              key:(int64_t)key
+                           weight:(double)weight
+                          visible:(BOOL)visible;
++ (nonnull instancetype)pointRecordWithX:(int32_t)x
+                                       y:(int32_t)y
+                                     key:(int64_t)key
+                                  weight:(double)weight
+                                 visible:(BOOL)visible;
+
+@property (nonatomic, readonly) int32_t x;
+
+@property (nonatomic, readonly) int32_t y;
+
+@property (nonatomic, readonly) int64_t key;
+
+@property (nonatomic, readonly) double weight;
+
+@property (nonatomic, readonly) BOOL visible;
+
+@end
@@ -0,0 +1,38 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_list.djinni
+
+#import "DBPointRecord.h"
+
+
+@implementation DBPointRecord
+
+- (nonnull instancetype)initWithX:(int32_t)x
+                                y:(int32_t)y
+                              key:(int64_t)key
+                           weight:(double)weight
+                          visible:(BOOL)visible
+{
+    if (self = [super init]) {
+        _x = x;
+        _y = y;
+        _key = key;
+        _weight = weight;
+        _visible = visible;
+    }
+    return self;
+}
+
++ (nonnull instancetype)pointRecordWithX:(int32_t)x
+                                       y:(int32_t)y
+                                     key:(int64_t)key
+                                  weight:(double)weight
+                                 visible:(BOOL)visible
+{
+    return [[self alloc] initWithX:x
+                                 y:y
+                               key:key
+                            weight:weight
+                           visible:visible];
+}
+
+@end
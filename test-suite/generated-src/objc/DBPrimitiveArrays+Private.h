@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_array.djinni
+
+#import "DBPrimitiveArrays.h"
+#include "primitive_arrays.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBPrimitiveArrays;
+
+namespace djinni_generated {
+
+struct PrimitiveArrays
+{
+    using CppType = ::PrimitiveArrays;
+    using ObjcType = DBPrimitiveArrays*;
+
+    using Boxed = PrimitiveArrays;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,27 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_array.djinni
+
+#import "DBPrimitiveArrays+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto PrimitiveArrays::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni::List<::djinni::I32>::toCpp(obj.ints),
+            ::djinni::List<::djinni::I64>::toCpp(obj.longs),
+            ::djinni::List<::djinni::F64>::toCpp(obj.doubles),
+            ::djinni::List<::djinni::Bool>::toCpp(obj.flags)};
+}
+
+auto PrimitiveArrays::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[DBPrimitiveArrays alloc] initWithInts:(::djinni::List<::djinni::I32>::fromCpp(cpp.ints))
+                                             longs:(::djinni::List<::djinni::I64>::fromCpp(cpp.longs))
+                                           doubles:(::djinni::List<::djinni::F64>::fromCpp(cpp.doubles))
+                                             flags:(::djinni::List<::djinni::Bool>::fromCpp(cpp.flags))];
+}
+
+}  // namespace djinni_generated
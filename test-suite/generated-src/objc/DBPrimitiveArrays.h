@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_array.djinni
+
+#import <Foundation/Foundation.h>
+
+@interface DBPrimitiveArrays : NSObject
+- (nonnull instancetype)initWithInts:(nonnull NSArray *)ints
+                               longs:(nonnull NSArray *)longs
+                             doubles:(nonnull NSArray *)doubles
+                               flags:(nonnull NSArray *)flags;
++ (nonnull instancetype)primitiveArraysWithInts:(nonnull NSArray *)ints
+                                          longs:(nonnull NSArray *)longs
+                                        doubles:(nonnull NSArray *)doubles
+                                          flags:(nonnull NSArray *)flags;
+
+@property (nonatomic, readonly, nonnull) NSArray * ints;
+
+@property (nonatomic, readonly, nonnull) NSArray * longs;
+
+@property (nonatomic, readonly, nonnull) NSArray * doubles;
+
+@property (nonatomic, readonly, nonnull) NSArray * flags;
+
+@end
@@ -0,0 +1,34 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from primitive_array.djinni
+
+#import "DBPrimitiveArrays.h"
+
+
+@implementation DBPrimitiveArrays
+
+- (nonnull instancetype)initWithInts:(nonnull NSArray *)ints
+                               longs:(nonnull NSArray *)longs
+                             doubles:(nonnull NSArray *)doubles
+                               flags:(nonnull NSArray *)flags
+{
+    if (self = [super init]) {
+        _ints = ints;
+        _longs = longs;
+        _doubles = doubles;
+        _flags = flags;
+    }
+    return self;
+}
+
++ (nonnull instancetype)primitiveArraysWithInts:(nonnull NSArray *)ints
+                                          longs:(nonnull NSArray *)longs
+                                        doubles:(nonnull NSArray *)doubles
+                                          flags:(nonnull NSArray *)flags
+{
+    return [[self alloc] initWithInts:ints
+                                longs:longs
+                              doubles:doubles
+                                flags:flags];
+}
+
+@end
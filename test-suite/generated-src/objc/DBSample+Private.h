@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#import "DBSample.h"
+#include "sample.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBSample;
+
+namespace djinni_generated {
+
+struct Sample
+{
+    using CppType = ::Sample;
+    using ObjcType = DBSample*;
+
+    using Boxed = Sample;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
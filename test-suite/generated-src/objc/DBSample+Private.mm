@@ -0,0 +1,27 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#import "DBSample+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto Sample::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni::I64::toCpp(obj.time),
+            ::djinni::F64::toCpp(obj.value),
+            ::djinni::F32::toCpp(obj.weight),
+            ::djinni::Bool::toCpp(obj.valid)};
+}
+
+auto Sample::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[DBSample alloc] initWithTime:(::djinni::I64::fromCpp(cpp.time))
+                                    value:(::djinni::F64::fromCpp(cpp.value))
+                                   weight:(::djinni::F32::fromCpp(cpp.weight))
+                                    valid:(::djinni::Bool::fromCpp(cpp.valid))];
+}
+
+}  // namespace djinni_generated
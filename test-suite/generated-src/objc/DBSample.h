@@ -0,0 +1,25 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#import <Foundation/Foundation.h>
+
+/** Only a few primitive fields, so sample_filter passes these across JNI as separate primitives. */
+@interface DBSample : NSObject
+- (nonnull instancetype)initWithTime:(int64_t)time
+                               value:(double)value
+                              weight:(float)weight
+                               valid:(BOOL)valid;
++ (nonnull instancetype)sampleWithTime:(int64_t)time
+                                 value:(double)value
+                                weight:(float)weight
+                                 valid:(BOOL)valid;
+
+@property (nonatomic, readonly) int64_t time;
+
+@property (nonatomic, readonly) double value;
+
+@property (nonatomic, readonly) float weight;
+
+@property (nonatomic, readonly) BOOL valid;
+
+@end
@@ -0,0 +1,34 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#import "DBSample.h"
+
+
+@implementation DBSample
+
+- (nonnull instancetype)initWithTime:(int64_t)time
+                               value:(double)value
+                              weight:(float)weight
+                               valid:(BOOL)valid
+{
+    if (self = [super init]) {
+        _time = time;
+        _value = value;
+        _weight = weight;
+        _valid = valid;
+    }
+    return self;
+}
+
++ (nonnull instancetype)sampleWithTime:(int64_t)time
+                                 value:(double)value
+                                weight:(float)weight
+                                 valid:(BOOL)valid
+{
+    return [[self alloc] initWithTime:time
+                                value:value
+                               weight:weight
+                                valid:valid];
+}
+
+@end
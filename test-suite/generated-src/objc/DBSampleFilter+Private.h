@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#include "sample_filter.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBSampleFilter;
+
+namespace djinni_generated {
+
+class SampleFilter
+{
+public:
+    using CppType = std::shared_ptr<::SampleFilter>;
+    using ObjcType = DBSampleFilter*;
+
+    using Boxed = SampleFilter;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
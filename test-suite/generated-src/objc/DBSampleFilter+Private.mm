@@ -0,0 +1,79 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#import "DBSampleFilter+Private.h"
+#import "DBSampleFilter.h"
+#import "DBSample+Private.h"
+#import "DBSampleFilter+Private.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBSampleFilter ()
+
+@property (nonatomic, readonly) ::djinni::DbxCppWrapperCache<::SampleFilter>::Handle cppRef;
+
+- (id)initWithCpp:(const std::shared_ptr<::SampleFilter>&)cppRef;
+
+@end
+
+@implementation DBSampleFilter
+
+- (id)initWithCpp:(const std::shared_ptr<::SampleFilter>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRef.assign(cppRef);
+    }
+    return self;
+}
+
++ (nullable DBSampleFilter *)create {
+    try {
+        auto r = ::SampleFilter::create();
+        return ::djinni_generated::SampleFilter::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (nonnull DBSample *)scale:(nonnull DBSample *)s
+                     factor:(double)factor {
+    try {
+        auto r = _cppRef.get()->scale(::djinni_generated::Sample::toCpp(s),
+                                      ::djinni::F64::toCpp(factor));
+        return ::djinni_generated::Sample::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (double)weighted:(nonnull DBSample *)s {
+    try {
+        auto r = _cppRef.get()->weighted(::djinni_generated::Sample::toCpp(s));
+        return ::djinni::F64::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+@end
+
+namespace djinni_generated {
+
+auto SampleFilter::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc.cppRef.get();
+}
+
+auto SampleFilter::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::DbxCppWrapperCache<::SampleFilter>::getInstance()->get(cpp, [] (const CppType& p) {
+        return [[DBSampleFilter alloc] initWithCpp:p];
+    });
+}
+
+}  // namespace djinni_generated
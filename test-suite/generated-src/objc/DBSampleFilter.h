@@ -0,0 +1,19 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from scalar_record.djinni
+
+#import "DBSample.h"
+#import <Foundation/Foundation.h>
+@class DBSampleFilter;
+
+
+@interface DBSampleFilter : NSObject
+
++ (nullable DBSampleFilter *)create;
+
+/** Multiplies value and weight by factor, and clears valid if either is no longer finite. */
+- (nonnull DBSample *)scale:(nonnull DBSample *)s
+                     factor:(double)factor;
+
+- (double)weighted:(nonnull DBSample *)s;
+
+@end
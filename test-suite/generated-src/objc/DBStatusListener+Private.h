@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from coalesce.djinni
+
+#include "status_listener.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@protocol DBStatusListener;
+
+namespace djinni_generated {
+
+class StatusListener
+{
+public:
+    using CppType = std::shared_ptr<::StatusListener>;
+    using ObjcType = id<DBStatusListener>;
+
+    using Boxed = StatusListener;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
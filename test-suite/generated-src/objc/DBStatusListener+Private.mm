@@ -0,0 +1,48 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from coalesce.djinni
+
+#import "DBStatusListener+Private.h"
+#import "DBStatusListener.h"
+#import "DJIMarshal+Private.h"
+#import "DJIObjcWrapperCache+Private.h"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+namespace djinni_generated {
+
+class StatusListener::ObjcProxy final
+: public ::StatusListener
+, public ::djinni::DbxObjcWrapperCache<ObjcProxy>::Handle
+{
+public:
+    using Handle::Handle;
+    void on_status(const std::string & c_phase, int32_t c_progress) override
+    {
+        @autoreleasepool {
+            [(ObjcType)Handle::get() onStatus:(::djinni::String::fromCpp(c_phase))
+                                     progress:(::djinni::I32::fromCpp(c_progress))];
+        }
+    }
+};
+
+}  // namespace djinni_generated
+
+namespace djinni_generated {
+
+auto StatusListener::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return ::djinni::DbxObjcWrapperCache<ObjcProxy>::getInstance()->get(objc);
+}
+
+auto StatusListener::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return dynamic_cast<ObjcProxy&>(*cpp).Handle::get();
+}
+
+}  // namespace djinni_generated
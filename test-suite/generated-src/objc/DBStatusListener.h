@@ -0,0 +1,14 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from coalesce.djinni
+
+#import <Foundation/Foundation.h>
+
+
+/** Receives status updates from C++, which may come faster than Java can handle them. */
+@protocol DBStatusListener
+
+/** An update made while another is waiting replaces it, so Java only sees the newest. */
+- (void)onStatus:(nonnull NSString *)phase
+        progress:(int32_t)progress;
+
+@end
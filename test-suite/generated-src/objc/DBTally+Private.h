@@ -0,0 +1,29 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+#include "tally.hpp"
+#include <memory>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBTally;
+
+namespace djinni_generated {
+
+class Tally
+{
+public:
+    using CppType = std::shared_ptr<::Tally>;
+    using ObjcType = DBTally*;
+
+    using Boxed = Tally;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+
+private:
+    class ObjcProxy;
+};
+
+}  // namespace djinni_generated
+
@@ -0,0 +1,97 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+#import "DBTally+Private.h"
+#import "DBTally.h"
+#import "DBTally+Private.h"
+#import "DBWireSmall+Private.h"
+#import "DJICppWrapperCache+Private.h"
+#import "DJIError.h"
+#import "DJIMarshal+Private.h"
+#include <exception>
+#include <utility>
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@interface DBTally ()
+
+@property (nonatomic, readonly) ::djinni::DbxCppWrapperCache<::Tally>::Handle cppRef;
+
+- (id)initWithCpp:(const std::shared_ptr<::Tally>&)cppRef;
+
+@end
+
+@implementation DBTally
+
+- (id)initWithCpp:(const std::shared_ptr<::Tally>&)cppRef
+{
+    if (self = [super init]) {
+        _cppRef.assign(cppRef);
+    }
+    return self;
+}
+
++ (nullable DBTally *)create {
+    try {
+        auto r = ::Tally::create();
+        return ::djinni_generated::Tally::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (int64_t)add:(int64_t)amount {
+    try {
+        auto r = _cppRef.get()->add(::djinni::I64::toCpp(amount));
+        return ::djinni::I64::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (int32_t)remember:(nonnull DBWireSmall *)item {
+    try {
+        auto r = _cppRef.get()->remember(::djinni_generated::WireSmall::toCpp(item));
+        return ::djinni::I32::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (nonnull NSArray *)labels {
+    try {
+        auto r = _cppRef.get()->labels();
+        return ::djinni::List<::djinni::String>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (void)clear {
+    try {
+        _cppRef.get()->clear();
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+- (nullable DBTally *)fork {
+    try {
+        auto r = _cppRef.get()->fork();
+        return ::djinni_generated::Tally::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
+@end
+
+namespace djinni_generated {
+
+auto Tally::toCpp(ObjcType objc) -> CppType
+{
+    if (!objc) {
+        return nullptr;
+    }
+    return objc.cppRef.get();
+}
+
+auto Tally::fromCpp(const CppType& cpp) -> ObjcType
+{
+    if (!cpp) {
+        return nil;
+    }
+    return ::djinni::DbxCppWrapperCache<::Tally>::getInstance()->get(cpp, [] (const CppType& p) {
+        return [[DBTally alloc] initWithCpp:p];
+    });
+}
+
+}  // namespace djinni_generated
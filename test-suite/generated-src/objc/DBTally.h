@@ -0,0 +1,27 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from batch.djinni
+
+#import "DBWireSmall.h"
+#import <Foundation/Foundation.h>
+@class DBTally;
+
+
+/** Keeps a running total and a list of labels. BatchTest records its calls with Tally.Batch. */
+@interface DBTally : NSObject
+
++ (nullable DBTally *)create;
+
+/** Adds amount to the total and returns the new total. Throws if amount is negative. */
+- (int64_t)add:(int64_t)amount;
+
+/** Keeps the item's label, and returns how many labels are kept. */
+- (int32_t)remember:(nonnull DBWireSmall *)item;
+
+- (nonnull NSArray *)labels;
+
+- (void)clear;
+
+/** Returns a new tally with the same contents. Not in Tally.Batch, which can't return interfaces. */
+- (nullable DBTally *)fork;
+
+@end
@@ -7,6 +7,7 @@
 #import "DBClientInterface+Private.h"
 #import "DBMapListRecord+Private.h"
 #import "DBNestedCollection+Private.h"
+#import "DBPrimitiveArrays+Private.h"
 #import "DBPrimitiveList+Private.h"
 #import "DBSetRecord+Private.h"
 #import "DBToken+Private.h"
@@ -64,6 +65,56 @@ static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for th
     } DJINNI_TRANSLATE_EXCEPTIONS()
 }
 
++ (nonnull DBPrimitiveArrays *)getPrimitiveArrays {
+    try {
+        auto r = ::TestHelpers::get_primitive_arrays();
+        return ::djinni_generated::PrimitiveArrays::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (BOOL)checkPrimitiveArrays:(nonnull DBPrimitiveArrays *)pa {
+    try {
+        auto r = ::TestHelpers::check_primitive_arrays(::djinni_generated::PrimitiveArrays::toCpp(pa));
+        return ::djinni::Bool::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSArray *)reverseI64Array:(nonnull NSArray *)a {
+    try {
+        auto r = ::TestHelpers::reverse_i64_array(::djinni::List<::djinni::I64>::toCpp(a));
+        return ::djinni::List<::djinni::I64>::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (nonnull NSData *)makeBuffer:(int32_t)size {
+    try {
+        auto r = ::TestHelpers::make_buffer(::djinni::I32::toCpp(size));
+        return ::djinni::Buffer::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (int64_t)sumBuffer:(nonnull NSData *)b {
+    try {
+        auto r = ::TestHelpers::sum_buffer(::djinni::Buffer::toCpp(b));
+        return ::djinni::I64::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (void)fillBuffer:(nonnull NSData *)b
+             value:(int8_t)value {
+    try {
+        ::TestHelpers::fill_buffer(::djinni::Buffer::toCpp(b),
+                                   ::djinni::I8::toCpp(value));
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
++ (int32_t)liveBufferCount {
+    try {
+        auto r = ::TestHelpers::live_buffer_count();
+        return ::djinni::I32::fromCpp(r);
+    } DJINNI_TRANSLATE_EXCEPTIONS()
+}
+
 + (nonnull DBNestedCollection *)getNestedCollection {
     try {
         auto r = ::TestHelpers::get_nested_collection();
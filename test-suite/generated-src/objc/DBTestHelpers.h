@@ -5,6 +5,7 @@
 #import "DBColor.h"
 #import "DBMapListRecord.h"
 #import "DBNestedCollection.h"
+#import "DBPrimitiveArrays.h"
 #import "DBPrimitiveList.h"
 #import "DBSetRecord.h"
 #import <Foundation/Foundation.h>
@@ -22,6 +23,22 @@
 
 + (BOOL)checkPrimitiveList:(nonnull DBPrimitiveList *)pl;
 
++ (nonnull DBPrimitiveArrays *)getPrimitiveArrays;
+
++ (BOOL)checkPrimitiveArrays:(nonnull DBPrimitiveArrays *)pa;
+
++ (nonnull NSArray *)reverseI64Array:(nonnull NSArray *)a;
+
+/** C++ memory is filled with i % 256, and counted by live_buffer_count() until freed */
++ (nonnull NSData *)makeBuffer:(int32_t)size;
+
++ (int64_t)sumBuffer:(nonnull NSData *)b;
+
++ (void)fillBuffer:(nonnull NSData *)b
+             value:(int8_t)value;
+
++ (int32_t)liveBufferCount;
+
 + (nonnull DBNestedCollection *)getNestedCollection;
 
 + (BOOL)checkNestedCollection:(nonnull DBNestedCollection *)nc;
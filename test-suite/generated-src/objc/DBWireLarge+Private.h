@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBWireLarge.h"
+#include "wire_large.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBWireLarge;
+
+namespace djinni_generated {
+
+struct WireLarge
+{
+    using CppType = ::WireLarge;
+    using ObjcType = DBWireLarge*;
+
+    using Boxed = WireLarge;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
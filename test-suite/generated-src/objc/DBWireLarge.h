@@ -0,0 +1,38 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBWireMedium.h"
+#import "DBWireSmall.h"
+#import <Foundation/Foundation.h>
+
+@interface DBWireLarge : NSObject
+- (nonnull instancetype)initWithHeader:(nonnull DBWireMedium *)header
+                                 items:(nonnull NSArray *)items
+                            attributes:(nonnull NSDictionary *)attributes
+                               members:(nonnull NSSet *)members
+                               payload:(nonnull NSData *)payload
+                               weights:(nonnull NSArray *)weights
+                                  note:(nullable NSString *)note;
++ (nonnull instancetype)wireLargeWithHeader:(nonnull DBWireMedium *)header
+                                      items:(nonnull NSArray *)items
+                                 attributes:(nonnull NSDictionary *)attributes
+                                    members:(nonnull NSSet *)members
+                                    payload:(nonnull NSData *)payload
+                                    weights:(nonnull NSArray *)weights
+                                       note:(nullable NSString *)note;
+
+@property (nonatomic, readonly, nonnull) DBWireMedium * header;
+
+@property (nonatomic, readonly, nonnull) NSArray * items;
+
+@property (nonatomic, readonly, nonnull) NSDictionary * attributes;
+
+@property (nonatomic, readonly, nonnull) NSSet * members;
+
+@property (nonatomic, readonly, nonnull) NSData * payload;
+
+@property (nonatomic, readonly, nonnull) NSArray * weights;
+
+@property (nonatomic, readonly, nullable) NSString * note;
+
+@end
@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBWireMedium.h"
+#include "wire_medium.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBWireMedium;
+
+namespace djinni_generated {
+
+struct WireMedium
+{
+    using CppType = ::WireMedium;
+    using ObjcType = DBWireMedium*;
+
+    using Boxed = WireMedium;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
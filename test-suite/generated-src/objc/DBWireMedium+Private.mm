@@ -0,0 +1,31 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBWireMedium+Private.h"
+#import "DJIMarshal+Private.h"
+#include <cassert>
+
+namespace djinni_generated {
+
+auto WireMedium::toCpp(ObjcType obj) -> CppType
+{
+    assert(obj);
+    return {::djinni::I64::toCpp(obj.serial),
+            ::djinni::String::toCpp(obj.name),
+            ::djinni::List<::djinni::String>::toCpp(obj.tags),
+            ::djinni::Optional<std::experimental::optional, ::djinni::F32>::toCpp(obj.rating),
+            ::djinni::Enum<::color, DBColor>::toCpp(obj.shade),
+            ::djinni::Date::toCpp(obj.created)};
+}
+
+auto WireMedium::fromCpp(const CppType& cpp) -> ObjcType
+{
+    return [[DBWireMedium alloc] initWithSerial:(::djinni::I64::fromCpp(cpp.serial))
+                                           name:(::djinni::String::fromCpp(cpp.name))
+                                           tags:(::djinni::List<::djinni::String>::fromCpp(cpp.tags))
+                                         rating:(::djinni::Optional<std::experimental::optional, ::djinni::F32>::fromCpp(cpp.rating))
+                                          shade:(::djinni::Enum<::color, DBColor>::fromCpp(cpp.shade))
+                                        created:(::djinni::Date::fromCpp(cpp.created))];
+}
+
+}  // namespace djinni_generated
@@ -0,0 +1,24 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import "DBWireSmall.h"
+#include "wire_small.hpp"
+
+static_assert(__has_feature(objc_arc), "Djinni requires ARC to be enabled for this file");
+
+@class DBWireSmall;
+
+namespace djinni_generated {
+
+struct WireSmall
+{
+    using CppType = ::WireSmall;
+    using ObjcType = DBWireSmall*;
+
+    using Boxed = WireSmall;
+
+    static CppType toCpp(ObjcType objc);
+    static ObjcType fromCpp(const CppType& cpp);
+};
+
+}  // namespace djinni_generated
@@ -0,0 +1,21 @@
+// AUTOGENERATED FILE - DO NOT MODIFY!
+// This file generated by Djinni from wire_record.djinni
+
+#import <Foundation/Foundation.h>
+
+/** Crosses JNI as a single byte array; the plain_ records below have the same fields and are marshalled field by field. */
+@interface DBWireSmall : NSObject
+- (nonnull instancetype)initWithSerial:(int64_t)serial
+                                 label:(nonnull NSString *)label
+                                 score:(double)score;
++ (nonnull instancetype)wireSmallWithSerial:(int64_t)serial
+                                      label:(nonnull NSString *)label
+                                      score:(double)score;
+
+@property (nonatomic, readonly) int64_t serial;
+
+@property (nonatomic, readonly, nonnull) NSString * label;
+
+@property (nonatomic, readonly) double score;
+
+@end
@@ -0,0 +1,57 @@
+#include "allocation_counter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+static int64_t block_size(void * p) { return static_cast<int64_t>(malloc_size(p)); }
+#elif defined(__GLIBC__)
+#include <malloc.h>
+static int64_t block_size(void * p) { return static_cast<int64_t>(malloc_usable_size(p)); }
+#else
+static int64_t block_size(void *) { return 0; }
+#endif
+
+static std::atomic<int64_t> s_allocations { 0 };
+static std::atomic<int64_t> s_bytes { 0 };
+
+int64_t allocation_count() {
+    return s_allocations.load(std::memory_order_relaxed);
+}
+
+int64_t allocated_bytes() {
+    return s_bytes.load(std::memory_order_relaxed);
+}
+
+void * operator new(std::size_t size) {
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void * p = std::malloc(size ? size : 1)) {
+        s_bytes.fetch_add(block_size(p), std::memory_order_relaxed);
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void * p) noexcept {
+    if (p) {
+        s_bytes.fetch_sub(block_size(p), std::memory_order_relaxed);
+    }
+    std::free(p);
+}
+
+void operator delete(void * p, std::size_t) noexcept {
+    operator delete(p);
+}
+
+void * operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete[](void * p) noexcept {
+    operator delete(p);
+}
+
+void operator delete[](void * p, std::size_t) noexcept {
+    operator delete(p);
+}
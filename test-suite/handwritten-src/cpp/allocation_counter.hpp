@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+// Number of calls to global operator new made so far by the test library. Used by the
+// benchmarks to report allocations per call.
+int64_t allocation_count();
+
+// Size of the heap blocks currently allocated through global operator new, including what the
+// allocator rounds requests up to (where it can tell us). Used by the memory benchmarks.
+int64_t allocated_bytes();
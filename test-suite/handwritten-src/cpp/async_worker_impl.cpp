@@ -0,0 +1,115 @@
+#include "async_worker.hpp"
+#include "async_source.hpp"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+// Runs tasks in order on one thread, which finishes the queued ones before it exits.
+class WorkQueue {
+public:
+    WorkQueue() : m_thread([this] { run(); }) {}
+
+    ~WorkQueue() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_one();
+        m_thread.join();
+    }
+
+    void post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.push_back(std::move(task));
+        }
+        m_wake.notify_one();
+    }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_wake.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+            if (m_tasks.empty()) {
+                return;
+            }
+            const auto task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::deque<std::function<void()>> m_tasks;
+    bool m_stopping = false;
+    std::thread m_thread; // Last, so the thread starts once the rest is constructed.
+};
+
+// Completes promise with what compute returns, or with what it throws.
+template <typename T, typename F>
+void settle(const djinni::Promise<T> & promise, F compute) {
+    try {
+        promise.setValue(compute());
+    } catch (const std::exception &) {
+        promise.setException(std::current_exception());
+    }
+}
+
+class AsyncWorkerImpl : public AsyncWorker {
+public:
+    djinni::SharedFuture<int64_t> add(int64_t a, int64_t b) override {
+        djinni::Promise<int64_t> promise;
+        m_queue->post([promise, a, b] { promise.setValue(a + b); });
+        return promise.getFuture();
+    }
+
+    djinni::SharedFuture<std::string> reverse(const std::string & s) override {
+        djinni::Promise<std::string> promise;
+        m_queue->post([promise, s] {
+            settle(promise, [&] {
+                if (s.empty()) {
+                    throw std::invalid_argument("cannot reverse an empty string");
+                }
+                return std::string(s.rbegin(), s.rend());
+            });
+        });
+        return promise.getFuture();
+    }
+
+    djinni::SharedFuture<int32_t> measure(const std::shared_ptr<AsyncSource> & source,
+                                          const std::string & key) override {
+        djinni::Promise<int32_t> promise;
+        // The source completes its future on a thread of its own; hop back onto ours from
+        // there, unless this worker has been released in the meantime.
+        const std::weak_ptr<WorkQueue> queue = m_queue;
+        source->fetch(key).then([promise, queue] (const djinni::SharedFuture<std::string> & fetched) {
+            const auto q = queue.lock();
+            if (!q) {
+                promise.setException(std::make_exception_ptr(std::runtime_error("worker released")));
+                return;
+            }
+            q->post([promise, fetched] {
+                settle(promise, [&] { return static_cast<int32_t>(fetched.get().size()); });
+            });
+        });
+        return promise.getFuture();
+    }
+
+private:
+    const std::shared_ptr<WorkQueue> m_queue = std::make_shared<WorkQueue>();
+};
+
+} // namespace
+
+std::shared_ptr<AsyncWorker> AsyncWorker::create() {
+    return std::make_shared<AsyncWorkerImpl>();
+}
@@ -0,0 +1,71 @@
+// Native half of BulkCollectionTest.java: round trips collections through the List, Set and
+// Map marshallers, which take the bulk path above kBulkCollectionThreshold elements.
+
+#include "djinni_support.hpp"
+#include "Marshal.hpp"
+#include "NativePointRecord.hpp"
+#include "NativeRecordWithDerivings.hpp"
+
+using StringList = djinni::List<djinni::String>;
+using StringSet = djinni::Set<djinni::String>;
+using StringLongMap = djinni::Map<djinni::String, djinni::I64>;
+using IntList = djinni::List<djinni::I32>;
+using RecordList = djinni::List<djinni_generated::NativeRecordWithDerivings>;
+using PointList = djinni::List<djinni_generated::NativePointRecord>;
+using StringRecordMap = djinni::Map<djinni::String, djinni_generated::NativeRecordWithDerivings>;
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_BulkCollectionTest_nativeListRoundTrip(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_list)
+{
+    try {
+        return StringList::fromCpp(jniEnv, StringList::toCpp(jniEnv, j_list)).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_BulkCollectionTest_nativeSetRoundTrip(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_set)
+{
+    try {
+        return StringSet::fromCpp(jniEnv, StringSet::toCpp(jniEnv, j_set)).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_BulkCollectionTest_nativeMapRoundTrip(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_map)
+{
+    try {
+        return StringLongMap::fromCpp(jniEnv, StringLongMap::toCpp(jniEnv, j_map)).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_BulkCollectionTest_nativeIntListRoundTrip(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_list)
+{
+    try {
+        return IntList::fromCpp(jniEnv, IntList::toCpp(jniEnv, j_list)).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_BulkCollectionTest_nativeRecordListRoundTrip(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_list)
+{
+    try {
+        return RecordList::fromCpp(jniEnv, RecordList::toCpp(jniEnv, j_list)).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_BulkCollectionTest_nativeRecordMapRoundTrip(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_map)
+{
+    try {
+        return StringRecordMap::fromCpp(jniEnv, StringRecordMap::toCpp(jniEnv, j_map)).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_BulkCollectionTest_nativePointListRoundTrip(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_list)
+{
+    try {
+        return PointList::fromCpp(jniEnv, PointList::toCpp(jniEnv, j_list)).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
@@ -0,0 +1,219 @@
+// Native half of CollectionBenchmark.java: converts collections in a loop, either with the
+// current marshallers or element by element, as they did before the bulk collection path.
+
+#include "djinni_support.hpp"
+#include "Marshal.hpp"
+#include "NativePointRecord.hpp"
+#include "NativeRecordWithDerivings.hpp"
+
+using djinni::JniClass;
+using djinni::LocalRef;
+using IntList = djinni::List<djinni::I32>;
+using StringLongMap = djinni::Map<djinni::String, djinni::I64>;
+using Record = djinni_generated::NativeRecordWithDerivings;
+using RecordList = djinni::List<Record>;
+using Point = djinni_generated::NativePointRecord;
+using PointList = djinni::List<Point>;
+
+namespace {
+
+std::vector<int32_t> legacy_list_to_cpp(JNIEnv * env, jobject j) {
+    const auto & data = JniClass<djinni::ListJniInfo>::get();
+    const jint size = env->CallIntMethod(j, data.method_size);
+    std::vector<int32_t> c;
+    c.reserve(size);
+    for (jint i = 0; i < size; ++i) {
+        LocalRef<jobject> je(env, env->CallObjectMethod(j, data.method_get, i));
+        djinni::jniExceptionCheck(env);
+        c.push_back(djinni::I32::Boxed::toCpp(env, je.get()));
+    }
+    return c;
+}
+
+LocalRef<jobject> legacy_list_from_cpp(JNIEnv * env, const std::vector<int32_t> & c) {
+    const auto & data = JniClass<djinni::ListJniInfo>::get();
+    LocalRef<jobject> j(env, env->NewObject(data.clazz.get(), data.constructor,
+                                            static_cast<jint>(c.size())));
+    djinni::jniExceptionCheck(env);
+    for (const auto & ce : c) {
+        auto je = djinni::I32::Boxed::fromCpp(env, ce);
+        env->CallBooleanMethod(j.get(), data.method_add, je.get());
+        djinni::jniExceptionCheck(env);
+    }
+    return j;
+}
+
+StringLongMap::CppType legacy_map_to_cpp(JNIEnv * env, jobject j) {
+    const auto & data = JniClass<djinni::MapJniInfo>::get();
+    const auto & entrySetData = JniClass<djinni::EntrySetJniInfo>::get();
+    const auto & entryData = JniClass<djinni::EntryJniInfo>::get();
+    const auto & iteData = JniClass<djinni::IteratorJniInfo>::get();
+    const jint size = env->CallIntMethod(j, data.method_size);
+    LocalRef<jobject> entrySet(env, env->CallObjectMethod(j, data.method_entrySet));
+    LocalRef<jobject> it(env, env->CallObjectMethod(entrySet.get(), entrySetData.method_iterator));
+    StringLongMap::CppType c;
+    c.reserve(size);
+    for (jint i = 0; i < size; ++i) {
+        LocalRef<jobject> je(env, env->CallObjectMethod(it.get(), iteData.method_next));
+        LocalRef<jobject> jKey(env, env->CallObjectMethod(je.get(), entryData.method_getKey));
+        LocalRef<jobject> jValue(env, env->CallObjectMethod(je.get(), entryData.method_getValue));
+        djinni::jniExceptionCheck(env);
+        c.emplace(djinni::String::toCpp(env, static_cast<jstring>(jKey.get())),
+                  djinni::I64::Boxed::toCpp(env, jValue.get()));
+    }
+    return c;
+}
+
+LocalRef<jobject> legacy_map_from_cpp(JNIEnv * env, const StringLongMap::CppType & c) {
+    const auto & data = JniClass<djinni::MapJniInfo>::get();
+    LocalRef<jobject> j(env, env->NewObject(data.clazz.get(), data.constructor,
+                                            djinni::jniHashCapacity(c.size())));
+    djinni::jniExceptionCheck(env);
+    for (const auto & ce : c) {
+        auto jKey = djinni::String::fromCpp(env, ce.first);
+        auto jValue = djinni::I64::Boxed::fromCpp(env, ce.second);
+        LocalRef<jobject> old(env, env->CallObjectMethod(j.get(), data.method_put,
+                                                         jKey.get(), jValue.get()));
+        djinni::jniExceptionCheck(env);
+    }
+    return j;
+}
+
+// The bulk path as it was before records were converted by range: a local frame and a class
+// lookup for every record.
+RecordList::CppType legacy_record_list_to_cpp(JNIEnv * env, jobject j) {
+    auto array = djinni::jniCollectionToArray(env, djinni::BulkCollection::List, j);
+    const jint size = env->GetArrayLength(array.get());
+    RecordList::CppType c;
+    c.reserve(size);
+    for (jint i = 0; i < size; ++i) {
+        LocalRef<jobject> je(env, env->GetObjectArrayElement(array.get(), i));
+        c.push_back(Record::toCpp(env, je.get()));
+    }
+    return c;
+}
+
+LocalRef<jobject> legacy_record_list_from_cpp(JNIEnv * env, const RecordList::CppType & c) {
+    const auto & data = JniClass<djinni::ObjectJniInfo>::get();
+    const auto size = static_cast<jint>(c.size());
+    LocalRef<jobjectArray> array(env, env->NewObjectArray(size, data.clazz.get(), nullptr));
+    djinni::jniExceptionCheck(env);
+    for (jint i = 0; i < size; ++i) {
+        auto je = Record::fromCpp(env, c[i]);
+        env->SetObjectArrayElement(array.get(), i, je.get());
+    }
+    return djinni::jniCollectionFromArray(env, djinni::BulkCollection::List, array.get());
+}
+
+// Lists of primitive-only records as they were converted before they went across as columns.
+PointList::CppType legacy_point_list_to_cpp(JNIEnv * env, jobject j) {
+    auto array = djinni::jniCollectionToArray(env, djinni::BulkCollection::List, j);
+    PointList::CppType c;
+    Point::toCppRange(env, array.get(), 0, 1, env->GetArrayLength(array.get()),
+                      [&](Point::CppType && e) { c.push_back(std::move(e)); });
+    return c;
+}
+
+LocalRef<jobject> legacy_point_list_from_cpp(JNIEnv * env, const PointList::CppType & c) {
+    const auto & data = JniClass<djinni::ObjectJniInfo>::get();
+    const auto size = static_cast<jint>(c.size());
+    LocalRef<jobjectArray> array(env, env->NewObjectArray(size, data.clazz.get(), nullptr));
+    djinni::jniExceptionCheck(env);
+    auto it = c.begin();
+    Point::fromCppRange(env, size, [&]() -> const Point::CppType & { return *it++; },
+                        array.get(), 0, 1);
+    return djinni::jniCollectionFromArray(env, djinni::BulkCollection::List, array.get());
+}
+
+} // namespace
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CollectionBenchmark_nativeListToCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_list, jint iterations, jboolean legacy)
+{
+    try {
+        for (jint i = 0; i < iterations; ++i) {
+            const auto c = legacy ? legacy_list_to_cpp(jniEnv, j_list)
+                                  : IntList::toCpp(jniEnv, j_list);
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CollectionBenchmark_nativeListFromCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_list, jint iterations, jboolean legacy)
+{
+    try {
+        const auto c = IntList::toCpp(jniEnv, j_list);
+        for (jint i = 0; i < iterations; ++i) {
+            const auto j = legacy ? legacy_list_from_cpp(jniEnv, c) : IntList::fromCpp(jniEnv, c);
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CollectionBenchmark_nativeMapToCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_map, jint iterations, jboolean legacy)
+{
+    try {
+        for (jint i = 0; i < iterations; ++i) {
+            const auto c = legacy ? legacy_map_to_cpp(jniEnv, j_map)
+                                  : StringLongMap::toCpp(jniEnv, j_map);
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CollectionBenchmark_nativeMapFromCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_map, jint iterations, jboolean legacy)
+{
+    try {
+        const auto c = StringLongMap::toCpp(jniEnv, j_map);
+        for (jint i = 0; i < iterations; ++i) {
+            const auto j = legacy ? legacy_map_from_cpp(jniEnv, c)
+                                  : StringLongMap::fromCpp(jniEnv, c);
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CollectionBenchmark_nativeRecordListToCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_list, jint iterations, jboolean legacy)
+{
+    try {
+        for (jint i = 0; i < iterations; ++i) {
+            const auto c = legacy ? legacy_record_list_to_cpp(jniEnv, j_list)
+                                  : RecordList::toCpp(jniEnv, j_list);
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CollectionBenchmark_nativeRecordListFromCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_list, jint iterations, jboolean legacy)
+{
+    try {
+        const auto c = RecordList::toCpp(jniEnv, j_list);
+        for (jint i = 0; i < iterations; ++i) {
+            const auto j = legacy ? legacy_record_list_from_cpp(jniEnv, c)
+                                  : RecordList::fromCpp(jniEnv, c);
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CollectionBenchmark_nativePointListToCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_list, jint iterations, jboolean legacy)
+{
+    try {
+        for (jint i = 0; i < iterations; ++i) {
+            const auto c = legacy ? legacy_point_list_to_cpp(jniEnv, j_list)
+                                  : PointList::toCpp(jniEnv, j_list);
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_CollectionBenchmark_nativePointListFromCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_list, jint iterations, jboolean legacy)
+{
+    try {
+        const auto c = PointList::toCpp(jniEnv, j_list);
+        for (jint i = 0; i < iterations; ++i) {
+            const auto j = legacy ? legacy_point_list_from_cpp(jniEnv, c)
+                                  : PointList::fromCpp(jniEnv, c);
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
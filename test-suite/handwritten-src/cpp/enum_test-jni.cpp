@@ -0,0 +1,13 @@
+// Native half of EnumTest.testRoundTrip.
+
+#include "djinni_support.hpp"
+#include "NativeColor.hpp"
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_EnumTest_nativeRoundTrip(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_color)
+{
+    try {
+        const auto c = ::djinni_generated::NativeColor::toCpp(jniEnv, j_color);
+        return ::djinni::release(::djinni_generated::NativeColor::fromCpp(jniEnv, c));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
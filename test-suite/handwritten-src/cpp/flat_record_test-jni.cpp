@@ -0,0 +1,114 @@
+// Native half of FlatRecordTest.java.
+
+#include "djinni_support.hpp"
+#include "Marshal.hpp"
+#include "NativeFlatSnapshot.hpp"
+#include "flat_snapshot.hpp"
+#include <fcntl.h>
+#include <fstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// A read-only mapping of (a prefix of) a file, as a snapshot would be loaded at startup.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string & path, int64_t limit = -1) {
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("cannot open " + path);
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            throw std::runtime_error("cannot stat " + path);
+        }
+        m_size = static_cast<size_t>(limit >= 0 && limit < st.st_size ? limit : st.st_size);
+        m_data = m_size > 0 ? mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+        close(fd);
+        if (m_data == MAP_FAILED) {
+            throw std::runtime_error("cannot map " + path);
+        }
+    }
+
+    ~MappedFile() {
+        if (m_data) {
+            munmap(m_data, m_size);
+        }
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    FlatSnapshotView root() const { return FlatSnapshotView::root(m_data, m_size); }
+
+private:
+    void * m_data;
+    size_t m_size;
+};
+
+} // namespace
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_FlatRecordTest_nativeWrite(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_snapshot, jstring j_path)
+{
+    try {
+        const auto bytes = FlatSnapshotBuilder::build(
+            djinni_generated::NativeFlatSnapshot::toCpp(jniEnv, j_snapshot));
+        std::ofstream out(djinni::jniUTF8FromString(jniEnv, j_path), std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+        if (!out) {
+            throw std::runtime_error("cannot write snapshot");
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_FlatRecordTest_nativeRead(
+        JNIEnv* jniEnv, jclass /*clazz*/, jstring j_path)
+{
+    try {
+        const MappedFile file(djinni::jniUTF8FromString(jniEnv, j_path));
+        return djinni_generated::NativeFlatSnapshot::fromCpp(jniEnv, file.root().toCpp()).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_FlatRecordTest_nativeFindByName(
+        JNIEnv* jniEnv, jclass /*clazz*/, jstring j_path, jstring j_name)
+{
+    try {
+        const MappedFile file(djinni::jniUTF8FromString(jniEnv, j_path));
+        const auto byName = file.root().by_name();
+        const size_t i = byName.find(djinni::jniUTF8FromString(jniEnv, j_name));
+        return i == byName.size() ? -1 : byName.value(i);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0)
+}
+
+CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_FlatRecordTest_nativeContainsId(
+        JNIEnv* jniEnv, jclass /*clazz*/, jstring j_path, jlong j_id)
+{
+    try {
+        const MappedFile file(djinni::jniUTF8FromString(jniEnv, j_path));
+        return file.root().ids().contains(j_id);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, false)
+}
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_FlatRecordTest_nativeItemName(
+        JNIEnv* jniEnv, jclass /*clazz*/, jstring j_path, jint j_index)
+{
+    try {
+        const MappedFile file(djinni::jniUTF8FromString(jniEnv, j_path));
+        return djinni::jniStringFromUTF8(jniEnv, file.root().items()[j_index].name().toCpp());
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_FlatRecordTest_nativeReadPrefix(
+        JNIEnv* jniEnv, jclass /*clazz*/, jstring j_path, jlong j_size)
+{
+    try {
+        const MappedFile file(djinni::jniUTF8FromString(jniEnv, j_path), j_size);
+        return djinni_generated::NativeFlatSnapshot::fromCpp(jniEnv, file.root().toCpp()).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
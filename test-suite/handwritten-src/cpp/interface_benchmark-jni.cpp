@@ -0,0 +1,103 @@
+// Native half of InterfaceBenchmark.java: interface round trips, the checks JniInterface
+// uses to recognize objects that are already proxies, old and new, and a method call that
+// passes a record as an object, as generated code did before --java-scalar-records.
+
+#include "djinni_support.hpp"
+#include "Marshal.hpp"
+#include "NativeClientInterface.hpp"
+#include "NativeSample.hpp"
+#include "NativeToken.hpp"
+#include "sample_filter.hpp"
+#include <memory>
+#include <string>
+#include <typeinfo>
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_InterfaceBenchmark_nativeJavaRoundTrip(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_client, jint iterations)
+{
+    try {
+        for (jint i = 0; i < iterations; ++i) {
+            const auto c = ::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_client);
+            const auto j = ::djinni_generated::NativeClientInterface::fromCpp(jniEnv, c);
+            DJINNI_ASSERT(jniEnv->IsSameObject(j.get(), j_client), jniEnv);
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_InterfaceBenchmark_nativeCppRoundTrip(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_token, jint iterations)
+{
+    try {
+        for (jint i = 0; i < iterations; ++i) {
+            const auto c = ::djinni_generated::NativeToken::toCpp(jniEnv, j_token);
+            const auto j = ::djinni_generated::NativeToken::fromCpp(jniEnv, c);
+            DJINNI_ASSERT(jniEnv->IsSameObject(j.get(), j_token), jniEnv);
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_InterfaceBenchmark_nativeCheckCppProxy(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_obj, jint iterations, jboolean legacy)
+{
+    try {
+        static const ::djinni::GlobalRef<jclass> s_proxyClass =
+            ::djinni::jniFindClass("com/dropbox/djinni/test/Token$CppProxy");
+        jint hits = 0;
+        for (jint i = 0; i < iterations; ++i) {
+            if (legacy) {
+                // What _fromJava used to do, minus the local reference it leaked.
+                const ::djinni::LocalRef<jclass> cls(jniEnv, jniEnv->GetObjectClass(j_obj));
+                hits += jniEnv->IsSameObject(cls.get(), s_proxyClass.get());
+            } else {
+                hits += jniEnv->IsInstanceOf(j_obj, s_proxyClass.get());
+            }
+        }
+        return hits;
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0)
+}
+
+namespace {
+class BenchToken : public Token {
+    std::string whoami() override { return "C++"; }
+};
+
+// Shaped like a generated JavaProxy.
+class FakeProxyBase {
+public:
+    virtual ~FakeProxyBase() = default;
+};
+class FakeJavaProxy final : FakeProxyBase, public Token {
+    std::string whoami() override { return "Java"; }
+};
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_InterfaceBenchmark_nativeCheckJavaProxy(
+        JNIEnv* jniEnv, jclass /*clazz*/, jboolean isProxy, jint iterations, jboolean legacy)
+{
+    try {
+        const std::shared_ptr<Token> token = isProxy ? std::shared_ptr<Token>(std::make_shared<FakeJavaProxy>())
+                                                     : std::shared_ptr<Token>(std::make_shared<BenchToken>());
+        // Keep the compiler from hoisting the check out of the loop.
+        Token * volatile obj = token.get();
+        jint hits = 0;
+        for (jint i = 0; i < iterations; ++i) {
+            if (legacy) {
+                hits += dynamic_cast<FakeJavaProxy *>(obj) != nullptr;
+            } else {
+                hits += typeid(*obj) == typeid(FakeJavaProxy);
+            }
+        }
+        return hits;
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_InterfaceBenchmark_nativeLegacyScale(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_s, jdouble j_factor)
+{
+    try {
+        static const auto s_filter = SampleFilter::create();
+        auto r = s_filter->scale(::djinni_generated::NativeSample::toCpp(jniEnv, j_s),
+                                 ::djinni::F64::toCpp(jniEnv, j_factor));
+        return ::djinni::release(::djinni_generated::NativeSample::fromCpp(jniEnv, r));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
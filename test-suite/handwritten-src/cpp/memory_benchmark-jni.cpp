@@ -0,0 +1,59 @@
+// Native half of MemoryBenchmark.java: a set of C++ objects to hand to Java one at a time.
+
+#include "djinni_support.hpp"
+#include "allocation_counter.hpp"
+#include "NativeToken.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+class BenchToken : public Token {
+    std::string whoami() override { return "C++"; }
+};
+
+std::vector<std::shared_ptr<Token>> s_tokens;
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_MemoryBenchmark_nativeCreateTokens(
+        JNIEnv* jniEnv, jclass /*clazz*/, jint count)
+{
+    try {
+        s_tokens.clear();
+        s_tokens.reserve(static_cast<size_t>(count));
+        for (jint i = 0; i < count; ++i) {
+            s_tokens.push_back(std::make_shared<BenchToken>());
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_MemoryBenchmark_nativeReleaseTokens(
+        JNIEnv* jniEnv, jclass /*clazz*/)
+{
+    try {
+        std::vector<std::shared_ptr<Token>>().swap(s_tokens);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_MemoryBenchmark_nativeGetToken(
+        JNIEnv* jniEnv, jclass /*clazz*/, jint index)
+{
+    try {
+        return ::djinni::release(::djinni_generated::NativeToken::fromCpp(
+            jniEnv, s_tokens.at(static_cast<size_t>(index))));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_MemoryBenchmark_nativeHandleBlockSize(
+        JNIEnv* /*jniEnv*/, jclass /*clazz*/)
+{
+    return static_cast<jint>(sizeof(::djinni::CppProxyHandle<Token>));
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_MemoryBenchmark_nativeAllocatedBytes(
+        JNIEnv* jniEnv, jclass /*clazz*/)
+{
+    try {
+        return allocated_bytes();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0)
+}
@@ -0,0 +1,101 @@
+// Native half of NativeThreadTest.java: calls Java objects from threads the JVM didn't create.
+
+#include "djinni_support.hpp"
+#include "Marshal.hpp"
+#include "NativeClientInterface.hpp"
+#include <exception>
+#include <string>
+#include <thread>
+
+namespace {
+
+// Only ever used from a native thread, so with lazy class initialization that's where the
+// class gets looked up.
+struct NativeThreadTestJniInfo {
+    const djinni::GlobalRef<jclass> clazz {
+        djinni::jniFindClass("com/dropbox/djinni/test/NativeThreadTest")
+    };
+    const jmethodID method_twice {
+        djinni::jniGetStaticMethodID(clazz.get(), "twice", "(I)I")
+    };
+};
+
+} // namespace
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_NativeThreadTest_nativeReturnStrOnNewThread(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_client, jint calls)
+{
+    try {
+        auto client = ::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_client);
+        std::string result;
+        std::exception_ptr error;
+        std::thread thread([&] {
+            try {
+                for (jint i = 0; i < calls; ++i) {
+                    result += client->return_str();
+                }
+                // Drop the last reference here, so the proxy's global ref is deleted on this
+                // thread too.
+                client.reset();
+            } catch (...) {
+                error = std::current_exception();
+            }
+        });
+        thread.join();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return ::djinni::release(::djinni::String::fromCpp(jniEnv, result));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jint JNICALL Java_com_dropbox_djinni_test_NativeThreadTest_nativeCallStaticOnNewThread(
+        JNIEnv* jniEnv, jclass /*clazz*/, jint value)
+{
+    try {
+        jint result = 0;
+        std::exception_ptr error;
+        std::thread thread([&] {
+            try {
+                JNIEnv * const env = djinni::jniGetThreadEnv();
+                const auto & data = djinni::JniClass<NativeThreadTestJniInfo>::get();
+                result = env->CallStaticIntMethod(data.clazz.get(), data.method_twice, value);
+                djinni::jniExceptionCheck(env);
+            } catch (...) {
+                error = std::current_exception();
+            }
+        });
+        thread.join();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return result;
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0)
+}
+
+CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_NativeThreadTest_nativeReleaseOnDetachedThread(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_client)
+{
+    try {
+        JavaVM * jvm = nullptr;
+        DJINNI_ASSERT(jniEnv->GetJavaVM(&jvm) == JNI_OK, jniEnv);
+        auto client = ::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_client);
+        bool stayedDetached = false;
+        std::thread thread([&] {
+            // Releasing the last reference must neither attach this thread nor need a JNIEnv;
+            // the proxy's global ref is left for the next attached thread to delete.
+            client.reset();
+            JNIEnv * env = nullptr;
+            stayedDetached =
+                jvm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) == JNI_EDETACHED;
+        });
+        thread.join();
+        return stayedDetached ? JNI_TRUE : JNI_FALSE;
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, JNI_FALSE)
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_NativeThreadTest_nativeDrainDeferredRefs(
+        JNIEnv* jniEnv, jclass /*clazz*/)
+{
+    djinni::JniDeferredGlobalRefs::drain(jniEnv);
+}
@@ -0,0 +1,66 @@
+// Native half of OnewayTest.java: makes oneway and coalesce calls from threads the JVM doesn't
+// know about.
+
+#include "djinni_support.hpp"
+#include "NativeEventSink.hpp"
+#include "NativeStatusListener.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_OnewayTest_nativeEmitOnNewThreads(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_sink, jint threadCount, jint count)
+{
+    try {
+        JavaVM * jvm = nullptr;
+        DJINNI_ASSERT(jniEnv->GetJavaVM(&jvm) == JNI_OK, jniEnv);
+        const auto sink = ::djinni_generated::NativeEventSink::toCpp(jniEnv, j_sink);
+        std::atomic<bool> stayedDetached { true };
+        std::vector<std::thread> threads;
+        for (jint t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&, t] {
+                const std::string source = "t" + std::to_string(t);
+                for (jint i = 0; i < count; ++i) {
+                    sink->on_event(source, i);
+                }
+                // Posting a oneway call must not have attached this thread.
+                JNIEnv * env = nullptr;
+                if (jvm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) != JNI_EDETACHED) {
+                    stayedDetached = false;
+                }
+            });
+        }
+        for (auto & thread : threads) {
+            thread.join();
+        }
+        return stayedDetached ? JNI_TRUE : JNI_FALSE;
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, JNI_FALSE)
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_OnewayTest_nativeUpdateOnNewThread(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_listener, jint count)
+{
+    try {
+        const auto listener = ::djinni_generated::NativeStatusListener::toCpp(jniEnv, j_listener);
+        std::thread([&] {
+            for (jint i = 1; i <= count; ++i) {
+                listener->on_status(i < count ? "running" : "done", i);
+            }
+        }).join();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_OnewayTest_nativeFlush(
+        JNIEnv* jniEnv, jclass /*clazz*/)
+{
+    try {
+        djinni::JniOnewayQueue::flush();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_OnewayTest_nativeDroppedCount(
+        JNIEnv* /*jniEnv*/, jclass /*clazz*/)
+{
+    return static_cast<jlong>(djinni::JniOnewayQueue::droppedCount());
+}
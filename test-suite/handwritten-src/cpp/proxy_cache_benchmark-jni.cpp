@@ -0,0 +1,41 @@
+// Native half of ProxyCacheBenchmark.java: repeated interface conversions in both directions.
+
+#include "djinni_support.hpp"
+#include "NativeClientInterface.hpp"
+#include "NativeToken.hpp"
+#include <memory>
+#include <string>
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_ProxyCacheBenchmark_nativeFromJava(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_client, jint iterations)
+{
+    try {
+        // Keep one proxy alive, so that every conversion below is a cache hit.
+        const auto first = ::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_client);
+        for (jint i = 0; i < iterations; ++i) {
+            const auto client = ::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_client);
+            DJINNI_ASSERT(client == first, jniEnv);
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+namespace {
+class BenchToken : public Token {
+    std::string whoami() override { return "C++"; }
+};
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_ProxyCacheBenchmark_nativeToJava(
+        JNIEnv* jniEnv, jclass /*clazz*/, jboolean shared, jint iterations)
+{
+    try {
+        static const std::shared_ptr<Token> s_token = std::make_shared<BenchToken>();
+        const std::shared_ptr<Token> token = shared ? s_token : std::make_shared<BenchToken>();
+        // Keep one proxy alive, so that every conversion below is a cache hit.
+        const auto first = ::djinni_generated::NativeToken::fromCpp(jniEnv, token);
+        for (jint i = 0; i < iterations; ++i) {
+            const auto proxy = ::djinni_generated::NativeToken::fromCpp(jniEnv, token);
+            DJINNI_ASSERT(jniEnv->IsSameObject(proxy.get(), first.get()), jniEnv);
+        }
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
@@ -0,0 +1,53 @@
+// Native half of ProxyCacheTest.java.
+
+#include "djinni_support.hpp"
+#include "NativeClientInterface.hpp"
+#include "NativeToken.hpp"
+#include <memory>
+#include <string>
+
+CJNIEXPORT jboolean JNICALL Java_com_dropbox_djinni_test_ProxyCacheTest_nativeSameJavaProxy(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_a, jobject j_b)
+{
+    try {
+        const auto a = ::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_a);
+        const auto b = ::djinni_generated::NativeClientInterface::toCpp(jniEnv, j_b);
+        return a == b;
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, false)
+}
+
+namespace {
+class SharedToken : public Token {
+    std::string whoami() override { return "C++"; }
+};
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_ProxyCacheTest_nativeSharedCppToken(
+        JNIEnv* jniEnv, jclass /*clazz*/)
+{
+    try {
+        static const std::shared_ptr<Token> s_token = std::make_shared<SharedToken>();
+        return ::djinni::release(::djinni_generated::NativeToken::fromCpp(jniEnv, s_token));
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jlongArray JNICALL Java_com_dropbox_djinni_test_ProxyCacheTest_nativeCacheStats(
+        JNIEnv* jniEnv, jclass /*clazz*/)
+{
+    try {
+        const djinni::JniProxyCacheStats stats = djinni::jniProxyCacheStats();
+        const jlong values[] = {
+            static_cast<jlong>(stats.cppProxies),
+            static_cast<jlong>(stats.cppProxiesHighWater),
+            static_cast<jlong>(stats.cppProxiesSwept),
+            static_cast<jlong>(stats.javaProxies),
+            static_cast<jlong>(stats.javaProxiesHighWater),
+        };
+        const jsize count = sizeof(values) / sizeof(values[0]);
+        jlongArray res = jniEnv->NewLongArray(count);
+        DJINNI_ASSERT(res, jniEnv);
+        jniEnv->SetLongArrayRegion(res, 0, count, values);
+        djinni::jniExceptionCheck(jniEnv);
+        return res;
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
@@ -0,0 +1,23 @@
+#include "sample_filter.hpp"
+#include <cmath>
+
+namespace {
+
+class SampleFilterImpl : public SampleFilter {
+public:
+    Sample scale(const Sample & s, double factor) override {
+        const double value = s.value * factor;
+        const float weight = static_cast<float>(s.weight * factor);
+        return {s.time, value, weight, s.valid && std::isfinite(value) && std::isfinite(weight)};
+    }
+
+    double weighted(const Sample & s) override {
+        return s.valid ? s.value * s.weight : 0.0;
+    }
+};
+
+} // namespace
+
+std::shared_ptr<SampleFilter> SampleFilter::create() {
+    return std::make_shared<SampleFilterImpl>();
+}
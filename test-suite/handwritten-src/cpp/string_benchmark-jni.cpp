@@ -0,0 +1,67 @@
+// Native half of StringBenchmark.java: runs string conversions in a loop and reports how many
+// C++ allocations they made, for the current marshalling code and for the previous one.
+
+#include "allocation_counter.hpp"
+#include "djinni_support.hpp"
+#include "djinni_utf.hpp"
+#include "Marshal.hpp"
+#include <memory>
+#include <string>
+
+namespace {
+
+// jniUTF8FromString as it used to be: copy out of GetStringChars into a std::u16string,
+// then transcode into an estimated-size std::string.
+std::string legacy_utf8_from_string(JNIEnv * env, jstring jstr) {
+    const jsize length = env->GetStringLength(jstr);
+    const auto deleter = [env, jstr] (const jchar * c) { env->ReleaseStringChars(jstr, c); };
+    std::unique_ptr<const jchar, decltype(deleter)> ptr(env->GetStringChars(jstr, nullptr),
+                                                        deleter);
+    std::u16string str(reinterpret_cast<const char16_t *>(ptr.get()), length);
+    std::string out(str.length() * 3, '\0');
+    out.resize(djinni::utfReferenceTranscoder().utf16_to_utf8(str.data(), str.length(), &out[0]));
+    return out;
+}
+
+// String::fromCpp as it used to be: a temporary std::string from c_str(), then a
+// std::u16string handed to NewString.
+jstring legacy_string_from_utf8(JNIEnv * env, const std::string & c) {
+    const std::string str = c.c_str();
+    std::u16string utf16(str.length(), u'\0');
+    utf16.resize(djinni::utfReferenceTranscoder().utf8_to_utf16(str.data(), str.length(), &utf16[0]));
+    jstring res = env->NewString(reinterpret_cast<const jchar *>(utf16.data()), utf16.length());
+    DJINNI_ASSERT(res, env);
+    return res;
+}
+
+} // namespace
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_StringBenchmark_nativeToCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jstring j_str, jint iterations, jboolean legacy)
+{
+    try {
+        const int64_t before = allocation_count();
+        for (jint i = 0; i < iterations; ++i) {
+            const std::string str = legacy ? legacy_utf8_from_string(jniEnv, j_str)
+                                           : ::djinni::String::toCpp(jniEnv, j_str);
+        }
+        return allocation_count() - before;
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0)
+}
+
+CJNIEXPORT jlong JNICALL Java_com_dropbox_djinni_test_StringBenchmark_nativeFromCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jstring j_str, jint iterations, jboolean legacy)
+{
+    try {
+        const std::string str = ::djinni::String::toCpp(jniEnv, j_str);
+        const int64_t before = allocation_count();
+        for (jint i = 0; i < iterations; ++i) {
+            if (legacy) {
+                jniEnv->DeleteLocalRef(legacy_string_from_utf8(jniEnv, str));
+            } else {
+                ::djinni::String::fromCpp(jniEnv, str);
+            }
+        }
+        return allocation_count() - before;
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, 0)
+}
@@ -0,0 +1,43 @@
+#include "tally.hpp"
+#include <stdexcept>
+
+namespace {
+
+class TallyImpl : public Tally {
+public:
+    int64_t add(int64_t amount) override {
+        if (amount < 0) {
+            throw std::invalid_argument("amount is negative");
+        }
+        m_total += amount;
+        return m_total;
+    }
+
+    int32_t remember(const WireSmall & item) override {
+        m_labels.push_back(item.label);
+        return static_cast<int32_t>(m_labels.size());
+    }
+
+    std::vector<std::string> labels() override {
+        return m_labels;
+    }
+
+    void clear() override {
+        m_total = 0;
+        m_labels.clear();
+    }
+
+    std::shared_ptr<Tally> fork() override {
+        return std::make_shared<TallyImpl>(*this);
+    }
+
+private:
+    int64_t m_total = 0;
+    std::vector<std::string> m_labels;
+};
+
+} // namespace
+
+std::shared_ptr<Tally> Tally::create() {
+    return std::make_shared<TallyImpl>();
+}
@@ -2,6 +2,8 @@
 #include "client_returned_record.hpp"
 #include "client_interface.hpp"
 #include "token.hpp"
+#include <algorithm>
+#include <atomic>
 #include <exception>
 
 SetRecord TestHelpers::get_set_record() {
@@ -26,6 +28,59 @@ bool TestHelpers::check_primitive_list(const PrimitiveList & pl) {
     return pl.list == cPrimitiveList.list;
 }
 
+static const PrimitiveArrays cPrimitiveArrays {
+    {1, -2, 3, 2147483647},
+    {1, 2, -4294967296, 9223372036854775807LL},
+    {0.5, -1.25, 1e300},
+    {true, false, false, true, true}
+};
+
+PrimitiveArrays TestHelpers::get_primitive_arrays() {
+    return cPrimitiveArrays;
+}
+
+bool TestHelpers::check_primitive_arrays(const PrimitiveArrays & pa) {
+    return pa.ints == cPrimitiveArrays.ints
+        && pa.longs == cPrimitiveArrays.longs
+        && pa.doubles == cPrimitiveArrays.doubles
+        && pa.flags == cPrimitiveArrays.flags;
+}
+
+std::vector<int64_t> TestHelpers::reverse_i64_array(const std::vector<int64_t> & a) {
+    return std::vector<int64_t>(a.rbegin(), a.rend());
+}
+
+static std::atomic<int32_t> s_liveBuffers { 0 };
+
+::djinni::SharedBuffer TestHelpers::make_buffer(int32_t size) {
+    std::shared_ptr<uint8_t> bytes(new uint8_t[size], [] (uint8_t * p) {
+        delete[] p;
+        --s_liveBuffers;
+    });
+    ++s_liveBuffers;
+    for (int32_t i = 0; i < size; ++i) {
+        bytes.get()[i] = static_cast<uint8_t>(i % 256);
+    }
+    uint8_t * const data = bytes.get();
+    return ::djinni::SharedBuffer(std::move(bytes), data, static_cast<size_t>(size));
+}
+
+int64_t TestHelpers::sum_buffer(const ::djinni::SharedBuffer & b) {
+    int64_t sum = 0;
+    for (uint8_t byte : b) {
+        sum += byte;
+    }
+    return sum;
+}
+
+void TestHelpers::fill_buffer(const ::djinni::SharedBuffer & b, int8_t value) {
+    std::fill(b.begin(), b.end(), static_cast<uint8_t>(value));
+}
+
+int32_t TestHelpers::live_buffer_count() {
+    return s_liveBuffers;
+}
+
 inline NestedCollection cNestedCollection() {
 	NestedCollection c;
 	std::unordered_set<std::string> s1 = { "String1", "String2" };
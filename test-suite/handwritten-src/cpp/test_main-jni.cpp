@@ -0,0 +1,19 @@
+// JNI_OnLoad for the test library, used instead of support-lib/jni/djinni_main.cpp so that the
+// tests and StartupBenchmark can run with lazy class initialization as well.
+
+#include "djinni_support.hpp"
+#include <cstdlib>
+#include <cstring>
+
+CJNIEXPORT jint JNICALL JNI_OnLoad(JavaVM * jvm, void * /*reserved*/) {
+    djinni::JniInitOptions options;
+    options.attachNativeThreads = true;
+    const char * lazy = std::getenv("DJINNI_TEST_LAZY_CLASS_INIT");
+    options.lazyClassInit = lazy && std::strcmp(lazy, "1") == 0;
+    djinni::jniInit(jvm, options);
+    return JNI_VERSION_1_6;
+}
+
+CJNIEXPORT void JNICALL JNI_OnUnload(JavaVM * /*jvm*/, void * /*reserved*/) {
+    djinni::jniShutdown();
+}
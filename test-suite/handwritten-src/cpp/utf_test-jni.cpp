@@ -0,0 +1,142 @@
+// Native half of UtfTest.java: compares every available UTF transcoder against the
+// miniutf reference, and exposes the string marshalling entry points directly.
+
+#include "djinni_support.hpp"
+#include "djinni_utf.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using djinni::UtfTranscoder;
+
+namespace {
+
+// Byte sequences that exercise every branch of the UTF-8 decoder.
+const std::vector<std::string> s_utf8_pieces {
+    "a", "\x7f", "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", // valid
+    "\x80", "\xbf", "\xc0\x80", "\xc1\xbf", "\xe0\x80\x80",        // stray continuation, overlong
+    "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xf8", "\xff",            // surrogate, out of range
+    "\xc3", "\xe2\x82", "\xf0\x9f\x98", std::string(1, '\0'),      // truncated, NUL
+};
+
+std::string make_utf8(std::mt19937 & rng, size_t len) {
+    std::string out;
+    const bool mostly_ascii = rng() % 2;
+    while (out.size() < len) {
+        if (mostly_ascii && rng() % 8) {
+            out += static_cast<char>(rng() % 0x80);
+        } else if (rng() % 4 == 0) {
+            out += static_cast<char>(rng());
+        } else {
+            out += s_utf8_pieces[rng() % s_utf8_pieces.size()];
+        }
+    }
+    return out;
+}
+
+std::u16string make_utf16(std::mt19937 & rng, size_t len) {
+    std::u16string out;
+    const bool mostly_ascii = rng() % 2;
+    for (size_t i = 0; i < len; ++i) {
+        const uint32_t r = rng() % 16;
+        if (mostly_ascii ? r < 14 : r < 6) {
+            out += static_cast<char16_t>(rng() % 0x80);
+        } else if (r < 15) {
+            out += static_cast<char16_t>(0xD800 + rng() % 0x800); // paired or not
+        } else {
+            out += static_cast<char16_t>(rng());
+        }
+    }
+    return out;
+}
+
+std::string describe(const UtfTranscoder & t, const char * direction, size_t len) {
+    return std::string(t.name) + " " + direction + " differs from reference at length "
+         + std::to_string(len);
+}
+
+// Returns an empty string on success. Output buffers are only as large as the documented
+// capacity (plus one, so that empty buffers have a valid pointer).
+std::string check_transcoders(uint32_t seed, int iterations) {
+    const auto transcoders = djinni::utfAvailableTranscoders();
+    const UtfTranscoder & reference = djinni::utfReferenceTranscoder();
+    std::mt19937 rng(seed);
+
+    for (int i = 0; i < iterations; ++i) {
+        // Mostly short strings, so that every block-boundary length gets hit.
+        const size_t len = (i % 4 == 0) ? rng() % 1024 : rng() % 80;
+
+        const std::string utf8 = make_utf8(rng, len);
+        std::vector<char16_t> expected16(utf8.size() + 1);
+        const size_t n16 = reference.utf8_to_utf16(utf8.data(), utf8.size(), expected16.data());
+        for (const UtfTranscoder * t : transcoders) {
+            std::vector<char16_t> actual(utf8.size() + 1);
+            const size_t n = t->utf8_to_utf16(utf8.data(), utf8.size(), actual.data());
+            if (n != n16 || !std::equal(actual.begin(), actual.begin() + n, expected16.begin())) {
+                return describe(*t, "utf8_to_utf16", utf8.size());
+            }
+        }
+
+        const std::u16string utf16 = make_utf16(rng, len);
+        std::vector<char> expected8(utf16.size() * 3 + 1);
+        const size_t n8 = reference.utf16_to_utf8(utf16.data(), utf16.size(), expected8.data());
+        if (djinni::utf16ToUtf8Length(utf16.data(), utf16.size()) != n8) {
+            return "utf16ToUtf8Length differs from reference at length " + std::to_string(len);
+        }
+        for (const UtfTranscoder * t : transcoders) {
+            // Exactly as large as the result, which must also be enough.
+            std::vector<char> actual(n8 + 1);
+            const size_t n = t->utf16_to_utf8(utf16.data(), utf16.size(), actual.data());
+            if (n != n8 || !std::equal(actual.begin(), actual.begin() + n, expected8.begin())) {
+                return describe(*t, "utf16_to_utf8", utf16.size());
+            }
+        }
+
+        const size_t prefix = reference.ascii_prefix(utf8.data(), utf8.size());
+        for (const UtfTranscoder * t : transcoders) {
+            if (t->ascii_prefix(utf8.data(), utf8.size()) != prefix) {
+                return describe(*t, "ascii_prefix", utf8.size());
+            }
+        }
+    }
+    return {};
+}
+
+} // namespace
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_UtfTest_nativeCheckTranscoders(
+        JNIEnv* jniEnv, jclass /*clazz*/, jint seed, jint iterations)
+{
+    try {
+        const std::string err = check_transcoders(static_cast<uint32_t>(seed), iterations);
+        return err.empty() ? nullptr : djinni::jniStringFromUTF8(jniEnv, err);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jstring JNICALL Java_com_dropbox_djinni_test_UtfTest_nativeFromUtf8(
+        JNIEnv* jniEnv, jclass /*clazz*/, jbyteArray j_bytes)
+{
+    try {
+        const jsize length = jniEnv->GetArrayLength(j_bytes);
+        std::string str(static_cast<size_t>(length), '\0');
+        jniEnv->GetByteArrayRegion(j_bytes, 0, length, reinterpret_cast<jbyte *>(&str[0]));
+        djinni::jniExceptionCheck(jniEnv);
+        return djinni::jniStringFromUTF8(jniEnv, str);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jbyteArray JNICALL Java_com_dropbox_djinni_test_UtfTest_nativeToUtf8(
+        JNIEnv* jniEnv, jclass /*clazz*/, jstring j_str)
+{
+    try {
+        const std::string str = djinni::jniUTF8FromString(jniEnv, j_str);
+        const jsize length = static_cast<jsize>(str.size());
+        jbyteArray res = jniEnv->NewByteArray(length);
+        DJINNI_ASSERT(res, jniEnv);
+        jniEnv->SetByteArrayRegion(res, 0, length, reinterpret_cast<const jbyte *>(str.data()));
+        djinni::jniExceptionCheck(jniEnv);
+        return res;
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
@@ -0,0 +1,96 @@
+// Native half of WireRecordBenchmark.java: converts a record in a loop, either field by field
+// or as a single serialized message.
+
+#include "djinni_support.hpp"
+#include "NativePlainLarge.hpp"
+#include "NativePlainMedium.hpp"
+#include "NativePlainSmall.hpp"
+#include "NativeWireLarge.hpp"
+#include "NativeWireMedium.hpp"
+#include "NativeWireSmall.hpp"
+
+using namespace djinni_generated;
+
+namespace {
+
+template <class Wire, class Plain>
+void to_cpp(JNIEnv * env, jobject j_wire, jobject j_plain, jint iterations, jboolean field_by_field) {
+    for (jint i = 0; i < iterations; ++i) {
+        if (field_by_field) {
+            const auto c = Plain::toCpp(env, j_plain);
+        } else {
+            const auto c = Wire::toCpp(env, j_wire);
+        }
+    }
+}
+
+template <class Wire, class Plain>
+void from_cpp(JNIEnv * env, jobject j_wire, jobject j_plain, jint iterations, jboolean field_by_field) {
+    if (field_by_field) {
+        const auto c = Plain::toCpp(env, j_plain);
+        for (jint i = 0; i < iterations; ++i) {
+            const auto j = Plain::fromCpp(env, c);
+        }
+    } else {
+        const auto c = Wire::toCpp(env, j_wire);
+        for (jint i = 0; i < iterations; ++i) {
+            const auto j = Wire::fromCpp(env, c);
+        }
+    }
+}
+
+} // namespace
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_WireRecordBenchmark_nativeSmallToCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_wire, jobject j_plain, jint iterations,
+        jboolean field_by_field)
+{
+    try {
+        to_cpp<NativeWireSmall, NativePlainSmall>(jniEnv, j_wire, j_plain, iterations, field_by_field);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_WireRecordBenchmark_nativeSmallFromCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_wire, jobject j_plain, jint iterations,
+        jboolean field_by_field)
+{
+    try {
+        from_cpp<NativeWireSmall, NativePlainSmall>(jniEnv, j_wire, j_plain, iterations, field_by_field);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_WireRecordBenchmark_nativeMediumToCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_wire, jobject j_plain, jint iterations,
+        jboolean field_by_field)
+{
+    try {
+        to_cpp<NativeWireMedium, NativePlainMedium>(jniEnv, j_wire, j_plain, iterations, field_by_field);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_WireRecordBenchmark_nativeMediumFromCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_wire, jobject j_plain, jint iterations,
+        jboolean field_by_field)
+{
+    try {
+        from_cpp<NativeWireMedium, NativePlainMedium>(jniEnv, j_wire, j_plain, iterations, field_by_field);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_WireRecordBenchmark_nativeLargeToCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_wire, jobject j_plain, jint iterations,
+        jboolean field_by_field)
+{
+    try {
+        to_cpp<NativeWireLarge, NativePlainLarge>(jniEnv, j_wire, j_plain, iterations, field_by_field);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
+
+CJNIEXPORT void JNICALL Java_com_dropbox_djinni_test_WireRecordBenchmark_nativeLargeFromCpp(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_wire, jobject j_plain, jint iterations,
+        jboolean field_by_field)
+{
+    try {
+        from_cpp<NativeWireLarge, NativePlainLarge>(jniEnv, j_wire, j_plain, iterations, field_by_field);
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, )
+}
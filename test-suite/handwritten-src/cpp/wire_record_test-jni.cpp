@@ -0,0 +1,94 @@
+// Native half of WireRecordTest.java.
+
+#include "djinni_support.hpp"
+#include "Marshal.hpp"
+#include "NativePlainLarge.hpp"
+#include "NativeWireLarge.hpp"
+#include "NativeWireSmall.hpp"
+#include <chrono>
+#include <limits>
+
+using WireSmallList = djinni::List<djinni_generated::NativeWireSmall>;
+
+namespace {
+
+PlainSmall to_plain(const WireSmall & s) {
+    return {s.serial, s.label, s.score};
+}
+
+PlainMedium to_plain(const WireMedium & m) {
+    return {m.serial, m.name, m.tags, m.rating, m.shade, m.created};
+}
+
+PlainLarge to_plain(const WireLarge & l) {
+    std::vector<PlainSmall> items;
+    for (const auto & item : l.items) {
+        items.push_back(to_plain(item));
+    }
+    return {to_plain(l.header), std::move(items), l.attributes, l.members, l.payload, l.weights,
+            l.note};
+}
+
+// The same record as WireRecordTest.makeLarge().
+WireLarge make_large() {
+    WireMedium header {
+        -42, "header \xe2\x98\x83", {"", "caf\xc3\xa9", "\xf0\x9f\x98\x80", "tag"}, 1.5f,
+        color::INDIGO,
+        std::chrono::system_clock::from_time_t(0) + std::chrono::milliseconds(1234567890123),
+    };
+    std::vector<WireSmall> items;
+    for (int i = 0; i < 3; ++i) {
+        items.push_back({std::numeric_limits<int64_t>::max() - i, "item " + std::to_string(i),
+                         -0.25 * i});
+    }
+    std::vector<uint8_t> payload;
+    for (int i = 0; i < 300; ++i) {
+        payload.push_back(static_cast<uint8_t>(i));
+    }
+    return {
+        std::move(header),
+        std::move(items),
+        {{"min", std::numeric_limits<int32_t>::min()}, {"max", std::numeric_limits<int32_t>::max()}},
+        {std::numeric_limits<int64_t>::min(), 0, 300},
+        std::move(payload),
+        {std::numeric_limits<double>::max(), -0.0, std::numeric_limits<double>::denorm_min()},
+        {},
+    };
+}
+
+} // namespace
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_WireRecordTest_nativeLargeRoundTrip(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_record)
+{
+    try {
+        const auto c = djinni_generated::NativeWireLarge::toCpp(jniEnv, j_record);
+        return djinni_generated::NativeWireLarge::fromCpp(jniEnv, c).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_WireRecordTest_nativeSmallListRoundTrip(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_list)
+{
+    try {
+        const auto c = WireSmallList::toCpp(jniEnv, j_list);
+        return WireSmallList::fromCpp(jniEnv, c).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_WireRecordTest_nativeLargeToPlain(
+        JNIEnv* jniEnv, jclass /*clazz*/, jobject j_record)
+{
+    try {
+        const auto c = djinni_generated::NativeWireLarge::toCpp(jniEnv, j_record);
+        return djinni_generated::NativePlainLarge::fromCpp(jniEnv, to_plain(c)).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
+
+CJNIEXPORT jobject JNICALL Java_com_dropbox_djinni_test_WireRecordTest_nativeMakeLarge(
+        JNIEnv* jniEnv, jclass /*clazz*/)
+{
+    try {
+        return djinni_generated::NativeWireLarge::fromCpp(jniEnv, make_large()).release();
+    } JNI_TRANSLATE_EXCEPTIONS_RETURN(jniEnv, nullptr)
+}
@@ -0,0 +1,19 @@
+package com.dropbox.djinni.test;
+
+public class AllBenchmarks {
+
+    public static void main(String[] args) throws Exception {
+        StringBenchmark.run();
+        ProxyCacheBenchmark.run();
+        InterfaceBenchmark.run();
+        MemoryBenchmark.run();
+        CollectionBenchmark.run();
+        WireRecordBenchmark.run();
+        StartupBenchmark.run();
+    }
+
+    static {
+        System.loadLibrary("DjinniTestNative");
+    }
+
+}
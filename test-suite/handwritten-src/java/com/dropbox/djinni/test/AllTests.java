@@ -11,6 +11,7 @@ public class AllTests extends TestSuite {
         mySuite.addTestSuite(NestedCollectionTest.class);
         mySuite.addTestSuite(MapRecordTest.class);
         mySuite.addTestSuite(PrimitiveListTest.class);
+        mySuite.addTestSuite(PrimitiveArrayTest.class);
         mySuite.addTestSuite(RecordWithDerivingsTest.class);
         mySuite.addTestSuite(CppExceptionTest.class);
         mySuite.addTestSuite(ClientInterfaceTest.class);
@@ -18,6 +19,17 @@ public class AllTests extends TestSuite {
         mySuite.addTestSuite(PrimitivesTest.class);
         mySuite.addTestSuite(TokenTest.class);
 		mySuite.addTestSuite(DurationTest.class);
+        mySuite.addTestSuite(UtfTest.class);
+        mySuite.addTestSuite(NativeThreadTest.class);
+        mySuite.addTestSuite(ProxyCacheTest.class);
+        mySuite.addTestSuite(BulkCollectionTest.class);
+        mySuite.addTestSuite(BufferTest.class);
+        mySuite.addTestSuite(ScalarRecordTest.class);
+        mySuite.addTestSuite(WireRecordTest.class);
+        mySuite.addTestSuite(FlatRecordTest.class);
+        mySuite.addTestSuite(FutureTest.class);
+        mySuite.addTestSuite(OnewayTest.class);
+        mySuite.addTestSuite(BatchTest.class);
         return mySuite;
     }
 
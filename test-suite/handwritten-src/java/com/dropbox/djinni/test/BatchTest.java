@@ -0,0 +1,76 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+import com.dropbox.djinni.CallBatch;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+
+public class BatchTest extends TestCase {
+
+    private Tally tally;
+
+    @Override
+    protected void setUp()
+    {
+        tally = Tally.create();
+    }
+
+    public void testCallsRunInOrder()
+    {
+        Tally.Batch batch = new Tally.Batch(tally);
+        CallBatch.Result<Long> first = batch.add(2);
+        CallBatch.Result<Integer> remembered = batch.remember(new WireSmall(1, "one", 1.0));
+        batch.remember(new WireSmall(2, "two", 2.0));
+        CallBatch.Result<Long> second = batch.add(3);
+        CallBatch.Result<ArrayList<String>> labels = batch.labels();
+        assertEquals(5, batch.size());
+        assertFalse(first.isDone());
+        try {
+            first.get();
+            fail("expected the result to be unavailable before execute()");
+        } catch (IllegalStateException e) {
+        }
+
+        batch.execute();
+        assertEquals(0, batch.size());
+        assertEquals(2L, (long)first.get());
+        assertEquals(1, (int)remembered.get());
+        assertEquals(5L, (long)second.get());
+        assertEquals(Arrays.asList("one", "two"), labels.get());
+        // The calls went to the same object as direct calls do.
+        assertEquals(6L, tally.add(1));
+    }
+
+    public void testReuse()
+    {
+        Tally.Batch batch = new Tally.Batch(tally);
+        batch.add(1);
+        batch.execute();
+        batch.clear();
+        CallBatch.Result<Long> total = batch.add(4);
+        batch.execute();
+        assertEquals(4L, (long)total.get());
+        // Nothing is recorded, so this doesn't call into native code.
+        batch.execute();
+    }
+
+    public void testExceptionStopsBatch()
+    {
+        Tally.Batch batch = new Tally.Batch(tally);
+        CallBatch.Result<Long> before = batch.add(1);
+        batch.add(-1);
+        batch.add(10);
+        try {
+            batch.execute();
+            fail("expected the negative amount to throw");
+        } catch (RuntimeException e) {
+            assertEquals("amount is negative", e.getMessage());
+        }
+        assertFalse(before.isDone());
+        assertEquals(0, batch.size());
+        // The call before the one that threw was made, and the one after it wasn't.
+        assertEquals(2L, tally.add(1));
+    }
+}
@@ -0,0 +1,101 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+import com.dropbox.djinni.NativeBuffers;
+
+import java.nio.ByteBuffer;
+
+public class BufferTest extends TestCase {
+
+    public void testCppBufferToJava()
+    {
+        ByteBuffer b = TestHelpers.makeBuffer(1000);
+        assertTrue(b.isDirect());
+        assertEquals(1000, b.capacity());
+        for (int i = 0; i < b.capacity(); ++i) {
+            assertEquals((byte)(i % 256), b.get(i));
+        }
+        NativeBuffers.release(b);
+    }
+
+    public void testJavaBufferToCppIsNotCopied()
+    {
+        ByteBuffer b = ByteBuffer.allocateDirect(300);
+        for (int i = 0; i < b.capacity(); ++i) {
+            b.put(i, (byte)1);
+        }
+        assertEquals(300, TestHelpers.sumBuffer(b));
+
+        // Writes from C++ land in the Java buffer's own memory.
+        TestHelpers.fillBuffer(b, (byte)7);
+        for (int i = 0; i < b.capacity(); ++i) {
+            assertEquals(7, b.get(i));
+        }
+    }
+
+    public void testOnlyPositionToLimitIsPassed()
+    {
+        ByteBuffer b = ByteBuffer.allocateDirect(300);
+        for (int i = 0; i < b.capacity(); ++i) {
+            b.put(i, (byte)1);
+        }
+        b.position(100);
+        b.limit(250);
+        assertEquals(150, TestHelpers.sumBuffer(b));
+
+        TestHelpers.fillBuffer(b.duplicate(), (byte)7);
+        for (int i = 0; i < b.capacity(); ++i) {
+            assertEquals(i >= 100 && i < 250 ? 7 : 1, b.get(i));
+        }
+        ByteBuffer empty = b.slice();
+        empty.position(empty.limit());
+        assertEquals(0, TestHelpers.sumBuffer(empty));
+    }
+
+    public void testRoundTripSharesMemory()
+    {
+        ByteBuffer b = TestHelpers.makeBuffer(256);
+        TestHelpers.fillBuffer(b, (byte)2);
+        assertEquals(2, b.get(255));
+        assertEquals(512, TestHelpers.sumBuffer(b));
+        NativeBuffers.release(b);
+    }
+
+    public void testHeapBufferIsRejected()
+    {
+        try {
+            TestHelpers.sumBuffer(ByteBuffer.allocate(16));
+            fail("expected an error for a non-direct buffer");
+        } catch (Error e) {
+            // expected
+        }
+    }
+
+    public void testExplicitRelease()
+    {
+        int before = TestHelpers.liveBufferCount();
+        ByteBuffer b = TestHelpers.makeBuffer(64);
+        assertEquals(before + 1, TestHelpers.liveBufferCount());
+        NativeBuffers.release(b);
+        assertEquals(before, TestHelpers.liveBufferCount());
+        // Releasing twice, or releasing a buffer that didn't come from C++, does nothing.
+        NativeBuffers.release(b);
+        NativeBuffers.release(ByteBuffer.allocateDirect(8));
+        assertEquals(before, TestHelpers.liveBufferCount());
+    }
+
+    public void testReleasedWhenCollected() throws InterruptedException
+    {
+        int before = TestHelpers.liveBufferCount();
+        for (int i = 0; i < 100; ++i) {
+            TestHelpers.makeBuffer(1024);
+        }
+        // Released asynchronously, once the GC has noticed.
+        for (int tries = 0; tries < 100 && TestHelpers.liveBufferCount() > before; ++tries) {
+            System.gc();
+            Thread.sleep(20);
+        }
+        assertEquals(before, TestHelpers.liveBufferCount());
+    }
+}
@@ -0,0 +1,104 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.HashSet;
+
+public class BulkCollectionTest extends TestCase {
+
+    // Either side of the support library's bulk transfer threshold, and well past it.
+    // Records are converted in chunks of 64, so 1000 also ends on a partial chunk.
+    private static final int[] SIZES = { 0, 1, 15, 16, 17, 1000 };
+
+    // Each converts its argument to C++ and back.
+    private static native ArrayList<String> nativeListRoundTrip(ArrayList<String> list);
+    private static native HashSet<String> nativeSetRoundTrip(HashSet<String> set);
+    private static native HashMap<String, Long> nativeMapRoundTrip(HashMap<String, Long> map);
+    private static native ArrayList<Integer> nativeIntListRoundTrip(ArrayList<Integer> list);
+    private static native ArrayList<RecordWithDerivings> nativeRecordListRoundTrip(ArrayList<RecordWithDerivings> list);
+    private static native HashMap<String, RecordWithDerivings> nativeRecordMapRoundTrip(HashMap<String, RecordWithDerivings> map);
+    private static native ArrayList<PointRecord> nativePointListRoundTrip(ArrayList<PointRecord> list);
+
+    public void testList() {
+        for (int size : SIZES) {
+            ArrayList<String> list = new ArrayList<String>();
+            for (int i = 0; i < size; ++i) {
+                list.add("item " + i);
+            }
+            assertEquals("size " + size, list, nativeListRoundTrip(list));
+        }
+    }
+
+    public void testPrimitiveList() {
+        for (int size : SIZES) {
+            ArrayList<Integer> list = new ArrayList<Integer>();
+            for (int i = 0; i < size; ++i) {
+                list.add(i * 7);
+            }
+            assertEquals("size " + size, list, nativeIntListRoundTrip(list));
+        }
+    }
+
+    public void testSet() {
+        for (int size : SIZES) {
+            HashSet<String> set = new HashSet<String>();
+            for (int i = 0; i < size; ++i) {
+                set.add("item " + i);
+            }
+            assertEquals("size " + size, set, nativeSetRoundTrip(set));
+        }
+    }
+
+    public void testMap() {
+        for (int size : SIZES) {
+            HashMap<String, Long> map = new HashMap<String, Long>();
+            for (int i = 0; i < size; ++i) {
+                map.put("key " + i, (long)i << 32);
+            }
+            assertEquals("size " + size, map, nativeMapRoundTrip(map));
+        }
+    }
+
+    public void testRecordList() {
+        for (int size : SIZES) {
+            ArrayList<RecordWithDerivings> list = new ArrayList<RecordWithDerivings>();
+            for (int i = 0; i < size; ++i) {
+                list.add(new RecordWithDerivings(i, "item " + i));
+            }
+            assertEquals("size " + size, list, nativeRecordListRoundTrip(list));
+        }
+    }
+
+    public void testRecordMap() {
+        for (int size : SIZES) {
+            HashMap<String, RecordWithDerivings> map = new HashMap<String, RecordWithDerivings>();
+            for (int i = 0; i < size; ++i) {
+                map.put("key " + i, new RecordWithDerivings(-i, "value " + i));
+            }
+            assertEquals("size " + size, map, nativeRecordMapRoundTrip(map));
+        }
+    }
+
+    public void testPrimitiveRecordList() {
+        for (int size : SIZES) {
+            ArrayList<PointRecord> list = new ArrayList<PointRecord>();
+            for (int i = 0; i < size; ++i) {
+                list.add(new PointRecord(i, -i, (long)i << 33, i * 0.5, i % 3 == 0));
+            }
+            // PointRecord has no equals(), so compare field by field.
+            ArrayList<PointRecord> result = nativePointListRoundTrip(list);
+            assertEquals("size " + size, size, result.size());
+            for (int i = 0; i < size; ++i) {
+                PointRecord expected = list.get(i);
+                PointRecord actual = result.get(i);
+                assertEquals(expected.getX(), actual.getX());
+                assertEquals(expected.getY(), actual.getY());
+                assertEquals(expected.getKey(), actual.getKey());
+                assertEquals(expected.getWeight(), actual.getWeight(), 0.0);
+                assertEquals(expected.getVisible(), actual.getVisible());
+            }
+        }
+    }
+}
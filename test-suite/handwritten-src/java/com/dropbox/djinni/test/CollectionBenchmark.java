@@ -0,0 +1,105 @@
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+
+public class CollectionBenchmark {
+
+    private static final int ELEMENTS_PER_RUN = 2000000;
+
+    // Each converts its argument to C++ (and back, for the fromCpp half) iterations times,
+    // element by element if legacy is set, otherwise with the current marshallers.
+    private static native void nativeListToCpp(ArrayList<Integer> list, int iterations, boolean legacy);
+    private static native void nativeListFromCpp(ArrayList<Integer> list, int iterations, boolean legacy);
+    private static native void nativeMapToCpp(HashMap<String, Long> map, int iterations, boolean legacy);
+    private static native void nativeMapFromCpp(HashMap<String, Long> map, int iterations, boolean legacy);
+    // For lists of records, legacy converts each element of the bulk array with its own local
+    // frame and class lookup.
+    private static native void nativeRecordListToCpp(ArrayList<RecordWithDerivings> list, int iterations, boolean legacy);
+    private static native void nativeRecordListFromCpp(ArrayList<RecordWithDerivings> list, int iterations, boolean legacy);
+    // For lists of primitive-only records, legacy passes one object per element rather than
+    // one array per field.
+    private static native void nativePointListToCpp(ArrayList<PointRecord> list, int iterations, boolean legacy);
+    private static native void nativePointListFromCpp(ArrayList<PointRecord> list, int iterations, boolean legacy);
+
+    private interface Body {
+        void run(int iterations, boolean legacy);
+    }
+
+    private static void measure(String label, int size, Body body) {
+        int iterations = Math.max(1, ELEMENTS_PER_RUN / size);
+        for (boolean legacy : new boolean[] { true, false }) {
+            String variant = legacy ? "per-element" : "current    ";
+            body.run(iterations, legacy); // warm up
+            long start = System.nanoTime();
+            body.run(iterations, legacy);
+            long nanos = System.nanoTime() - start;
+            System.out.println(String.format("  %-14s %5d elements  %s  %6.1f ns per element",
+                label, size, variant, (double)nanos / ((long)iterations * size)));
+        }
+    }
+
+    public static void run() {
+        System.out.println("Collection marshalling:");
+        for (int size : new int[] { 16, 256, 4096 }) {
+            final ArrayList<Integer> list = new ArrayList<Integer>();
+            final HashMap<String, Long> map = new HashMap<String, Long>();
+            final ArrayList<RecordWithDerivings> records = new ArrayList<RecordWithDerivings>();
+            final ArrayList<PointRecord> points = new ArrayList<PointRecord>();
+            for (int i = 0; i < size; ++i) {
+                list.add(i);
+                map.put("key " + i, (long)i);
+                records.add(new RecordWithDerivings(i, "record " + i));
+                points.add(new PointRecord(i, i * 2, i, i * 0.25, true));
+            }
+            measure("list toCpp", size, new Body() {
+                @Override
+                public void run(int iterations, boolean legacy) {
+                    nativeListToCpp(list, iterations, legacy);
+                }
+            });
+            measure("list fromCpp", size, new Body() {
+                @Override
+                public void run(int iterations, boolean legacy) {
+                    nativeListFromCpp(list, iterations, legacy);
+                }
+            });
+            measure("map toCpp", size, new Body() {
+                @Override
+                public void run(int iterations, boolean legacy) {
+                    nativeMapToCpp(map, iterations, legacy);
+                }
+            });
+            measure("map fromCpp", size, new Body() {
+                @Override
+                public void run(int iterations, boolean legacy) {
+                    nativeMapFromCpp(map, iterations, legacy);
+                }
+            });
+            measure("records toCpp", size, new Body() {
+                @Override
+                public void run(int iterations, boolean legacy) {
+                    nativeRecordListToCpp(records, iterations, legacy);
+                }
+            });
+            measure("records fromCpp", size, new Body() {
+                @Override
+                public void run(int iterations, boolean legacy) {
+                    nativeRecordListFromCpp(records, iterations, legacy);
+                }
+            });
+            measure("points toCpp", size, new Body() {
+                @Override
+                public void run(int iterations, boolean legacy) {
+                    nativePointListToCpp(points, iterations, legacy);
+                }
+            });
+            measure("points fromCpp", size, new Body() {
+                @Override
+                public void run(int iterations, boolean legacy) {
+                    nativePointListFromCpp(points, iterations, legacy);
+                }
+            });
+        }
+    }
+}
@@ -6,6 +6,14 @@ import java.util.HashMap;
 
 public class EnumTest extends TestCase {
 
+    private static native Color nativeRoundTrip(Color c);
+
+    public void testRoundTrip() {
+        for (Color c : Color.values()) {
+            assertSame(c, nativeRoundTrip(c));
+        }
+    }
+
     public void testEnumKey() {
         HashMap<Color, String> m = new HashMap<Color, String>();
         m.put(Color.RED, "red");
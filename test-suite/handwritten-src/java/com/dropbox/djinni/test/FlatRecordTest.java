@@ -0,0 +1,126 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+import java.io.File;
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Date;
+import java.util.HashMap;
+import java.util.HashSet;
+
+public class FlatRecordTest extends TestCase {
+
+    // Converts snapshot to C++ and writes it to path in the flat layout.
+    private static native void nativeWrite(FlatSnapshot snapshot, String path);
+    // Each maps the file at path and reads from it in place.
+    private static native FlatSnapshot nativeRead(String path);
+    private static native long nativeFindByName(String path, String name);
+    private static native boolean nativeContainsId(String path, long id);
+    private static native String nativeItemName(String path, int index);
+    // Maps only the first size bytes of the file.
+    private static native FlatSnapshot nativeReadPrefix(String path, long size);
+
+    private File file;
+
+    @Override
+    protected void setUp() throws IOException {
+        file = File.createTempFile("djinni", ".flat");
+    }
+
+    @Override
+    protected void tearDown() {
+        file.delete();
+    }
+
+    private static FlatItem makeItem(long serial) {
+        byte[] thumbnail = new byte[(int) serial % 7];
+        for (int i = 0; i < thumbnail.length; ++i) {
+            thumbnail[i] = (byte) (i * 31);
+        }
+        return new FlatItem(serial, serial % 2 == 0, (short) -serial, Color.values()[(int) serial % Color.values().length],
+                            "item \u2603 " + serial, serial % 3 == 0 ? null : serial / 4.0, new Date(1234567890123L + serial),
+                            thumbnail, new ArrayList<String>(Arrays.asList("tag", Long.toString(serial))));
+    }
+
+    private static FlatSnapshot makeSnapshot(int itemCount) {
+        ArrayList<FlatItem> items = new ArrayList<FlatItem>();
+        HashMap<String, Long> byName = new HashMap<String, Long>();
+        HashSet<Long> ids = new HashSet<Long>();
+        ArrayList<Float> weights = new ArrayList<Float>();
+        for (int i = 0; i < itemCount; ++i) {
+            FlatItem item = makeItem(i * 13L);
+            items.add(item);
+            byName.put(item.getName(), item.getSerial());
+            ids.add(item.getSerial());
+            weights.add(i * 0.5f);
+        }
+        return new FlatSnapshot(7, items, byName, ids, weights, itemCount > 0 ? items.get(0) : null, "snapshot");
+    }
+
+    private static void assertItem(FlatItem expected, FlatItem actual) {
+        assertEquals(expected.getSerial(), actual.getSerial());
+        assertEquals(expected.getFlag(), actual.getFlag());
+        assertEquals(expected.getRank(), actual.getRank());
+        assertEquals(expected.getShade(), actual.getShade());
+        assertEquals(expected.getName(), actual.getName());
+        assertEquals(expected.getScore(), actual.getScore());
+        assertEquals(expected.getCreated(), actual.getCreated());
+        assertTrue(Arrays.equals(expected.getThumbnail(), actual.getThumbnail()));
+        assertEquals(expected.getTags(), actual.getTags());
+    }
+
+    private static void assertSnapshot(FlatSnapshot expected, FlatSnapshot actual) {
+        assertEquals(expected.getVersion(), actual.getVersion());
+        assertEquals(expected.getItems().size(), actual.getItems().size());
+        for (int i = 0; i < expected.getItems().size(); ++i) {
+            assertItem(expected.getItems().get(i), actual.getItems().get(i));
+        }
+        assertEquals(expected.getByName(), actual.getByName());
+        assertEquals(expected.getIds(), actual.getIds());
+        assertEquals(expected.getWeights(), actual.getWeights());
+        if (expected.getFeatured() == null) {
+            assertNull(actual.getFeatured());
+        } else {
+            assertItem(expected.getFeatured(), actual.getFeatured());
+        }
+        assertEquals(expected.getNote(), actual.getNote());
+    }
+
+    public void testRoundTrip() {
+        FlatSnapshot snapshot = makeSnapshot(50);
+        nativeWrite(snapshot, file.getPath());
+        assertSnapshot(snapshot, nativeRead(file.getPath()));
+    }
+
+    public void testEmpty() {
+        FlatSnapshot snapshot = new FlatSnapshot(0, new ArrayList<FlatItem>(), new HashMap<String, Long>(),
+                                                 new HashSet<Long>(), new ArrayList<Float>(), null, null);
+        nativeWrite(snapshot, file.getPath());
+        assertSnapshot(snapshot, nativeRead(file.getPath()));
+        assertEquals(-1L, nativeFindByName(file.getPath(), ""));
+    }
+
+    public void testLookupsInPlace() {
+        FlatSnapshot snapshot = makeSnapshot(200);
+        nativeWrite(snapshot, file.getPath());
+        for (FlatItem item : snapshot.getItems()) {
+            assertEquals(item.getSerial(), nativeFindByName(file.getPath(), item.getName()));
+            assertTrue(nativeContainsId(file.getPath(), item.getSerial()));
+            assertFalse(nativeContainsId(file.getPath(), item.getSerial() + 1));
+        }
+        assertEquals(-1L, nativeFindByName(file.getPath(), "item"));
+        assertEquals(snapshot.getItems().get(123).getName(), nativeItemName(file.getPath(), 123));
+    }
+
+    public void testTruncatedFileIsRejected() {
+        nativeWrite(makeSnapshot(10), file.getPath());
+        try {
+            nativeReadPrefix(file.getPath(), file.length() - 8);
+            fail("expected an error for a truncated snapshot");
+        } catch (RuntimeException e) {
+            // expected
+        }
+    }
+}
@@ -0,0 +1,89 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.TimeUnit;
+
+public class FutureTest extends TestCase {
+
+    private static final long TIMEOUT_SECONDS = 10;
+
+    private AsyncWorker worker;
+
+    @Override
+    protected void setUp()
+    {
+        worker = AsyncWorker.create();
+    }
+
+    public void testAdd() throws Exception
+    {
+        assertEquals(5L, (long)worker.add(2, 3).get(TIMEOUT_SECONDS, TimeUnit.SECONDS));
+    }
+
+    public void testManyInFlight() throws Exception
+    {
+        // Nothing blocks on the native side, so all of these can be outstanding at once.
+        final int count = 10000;
+        @SuppressWarnings("unchecked")
+        CompletableFuture<Long>[] futures = new CompletableFuture[count];
+        for (int i = 0; i < count; ++i) {
+            futures[i] = worker.add(i, 1);
+        }
+        CompletableFuture.allOf(futures).get(TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        for (int i = 0; i < count; ++i) {
+            assertEquals(i + 1L, (long)futures[i].getNow(null));
+        }
+    }
+
+    public void testFailure() throws Exception
+    {
+        assertEquals("cba", worker.reverse("abc").get(TIMEOUT_SECONDS, TimeUnit.SECONDS));
+        try {
+            worker.reverse("").get(TIMEOUT_SECONDS, TimeUnit.SECONDS);
+            fail("expected the future to fail");
+        } catch (ExecutionException e) {
+            assertTrue(e.getCause() instanceof RuntimeException);
+        }
+    }
+
+    public void testJavaFutureCompletedLater() throws Exception
+    {
+        final CompletableFuture<String> fetched = new CompletableFuture<>();
+        CompletableFuture<Integer> measured = worker.measure(new AsyncSource() {
+            @Override
+            public CompletableFuture<String> fetch(String key) {
+                assertEquals("key", key);
+                return fetched;
+            }
+        }, "key");
+
+        Thread.sleep(50);
+        assertFalse(measured.isDone());
+
+        fetched.complete("hello");
+        assertEquals(5, (int)measured.get(TIMEOUT_SECONDS, TimeUnit.SECONDS));
+    }
+
+    public void testJavaFailurePassesThrough() throws Exception
+    {
+        final IllegalStateException error = new IllegalStateException("not found");
+        CompletableFuture<Integer> measured = worker.measure(new AsyncSource() {
+            @Override
+            public CompletableFuture<String> fetch(String key) {
+                CompletableFuture<String> f = new CompletableFuture<>();
+                f.completeExceptionally(error);
+                return f;
+            }
+        }, "key");
+
+        try {
+            measured.get(TIMEOUT_SECONDS, TimeUnit.SECONDS);
+            fail("expected the future to fail");
+        } catch (ExecutionException e) {
+            assertSame(error, e.getCause());
+        }
+    }
+}
@@ -0,0 +1,91 @@
+package com.dropbox.djinni.test;
+
+public class InterfaceBenchmark {
+
+    private static final int ITERATIONS = 1000000;
+
+    // Each converts its argument to C++ and back, iterations times.
+    private static native void nativeJavaRoundTrip(ClientInterface client, int iterations);
+    private static native void nativeCppRoundTrip(Token token, int iterations);
+
+    // Each runs the check for "is this already a proxy" iterations times and returns how many
+    // times it said yes, using either what JniInterface used to do or what it does now.
+    private static native int nativeCheckCppProxy(Object obj, int iterations, boolean legacy);
+    private static native int nativeCheckJavaProxy(boolean isProxy, int iterations, boolean legacy);
+
+    // SampleFilter.scale() as generated without --java-scalar-records, where the record
+    // crosses JNI as an object both ways.
+    private static native Sample nativeLegacyScale(Sample s, double factor);
+
+    private interface Body {
+        void run(int iterations);
+    }
+
+    private static double measure(Body body) {
+        body.run(ITERATIONS / 10); // warm up
+        long start = System.nanoTime();
+        body.run(ITERATIONS);
+        return (double)(System.nanoTime() - start) / ITERATIONS;
+    }
+
+    private static void compare(final String label, final boolean proxy, final boolean cppProxyCheck,
+                                final Object obj) {
+        double[] nanos = new double[2];
+        for (int i = 0; i < 2; ++i) {
+            final boolean legacy = i == 0;
+            nanos[i] = measure(new Body() {
+                @Override
+                public void run(int iterations) {
+                    int hits = cppProxyCheck ? nativeCheckCppProxy(obj, iterations, legacy)
+                                             : nativeCheckJavaProxy(proxy, iterations, legacy);
+                    if (hits != (proxy ? iterations : 0)) {
+                        throw new AssertionError(label + ": wrong result");
+                    }
+                }
+            });
+        }
+        System.out.println(String.format("  %-38s before: %6.1f   after: %6.1f", label, nanos[0], nanos[1]));
+    }
+
+    public static void run() {
+        System.out.println("Interface conversions (ns per call):");
+        final ClientInterface client = new ClientInterfaceImpl();
+        final Token token = TestHelpers.createCppToken();
+        System.out.println(String.format("  Java object -> C++ -> Java  %6.1f", measure(new Body() {
+            @Override
+            public void run(int iterations) {
+                nativeJavaRoundTrip(client, iterations);
+            }
+        })));
+        System.out.println(String.format("  C++ object -> Java -> C++   %6.1f", measure(new Body() {
+            @Override
+            public void run(int iterations) {
+                nativeCppRoundTrip(token, iterations);
+            }
+        })));
+        compare("is CppProxy? (yes)", true, true, token);
+        compare("is CppProxy? (no)", false, true, client);
+        compare("is JavaProxy? (yes)", true, false, null);
+        compare("is JavaProxy? (no)", false, false, null);
+
+        final SampleFilter filter = SampleFilter.create();
+        final Sample sample = new Sample(1, 2.0, 0.5f, true);
+        double legacy = measure(new Body() {
+            @Override
+            public void run(int iterations) {
+                for (int i = 0; i < iterations; ++i) {
+                    nativeLegacyScale(sample, 1.0);
+                }
+            }
+        });
+        double scalar = measure(new Body() {
+            @Override
+            public void run(int iterations) {
+                for (int i = 0; i < iterations; ++i) {
+                    filter.scale(sample, 1.0);
+                }
+            }
+        });
+        System.out.println(String.format("  %-38s before: %6.1f   after: %6.1f", "record argument and result", legacy, scalar));
+    }
+}
@@ -0,0 +1,51 @@
+package com.dropbox.djinni.test;
+
+public class MemoryBenchmark {
+
+    private static final int PROXIES = 200000;
+
+    private static native void nativeCreateTokens(int count);
+    private static native void nativeReleaseTokens();
+    // Returns the CppProxy for the C++ token at index, creating it if needed.
+    private static native Token nativeGetToken(int index);
+    // Heap bytes allocated by the native library, as counted by allocation_counter.cpp.
+    private static native long nativeAllocatedBytes();
+    // Size of the slab block that holds a CppProxyHandle and its proxy cache entry.
+    private static native int nativeHandleBlockSize();
+
+    private static long javaHeapUsed() throws InterruptedException {
+        Runtime runtime = Runtime.getRuntime();
+        for (int i = 0; i < 3; ++i) {
+            System.gc();
+            Thread.sleep(50);
+        }
+        return runtime.totalMemory() - runtime.freeMemory();
+    }
+
+    public static void run() throws InterruptedException {
+        System.out.println("Memory per live CppProxy (bytes, not counting the C++ object itself):");
+        // The C++ objects and the array that holds the proxies are made before the baseline.
+        nativeCreateTokens(PROXIES);
+        Token[] tokens = new Token[PROXIES];
+        long javaBefore = javaHeapUsed();
+        long nativeBefore = nativeAllocatedBytes();
+
+        for (int i = 0; i < PROXIES; ++i) {
+            tokens[i] = nativeGetToken(i);
+        }
+
+        long javaAfter = javaHeapUsed();
+        long nativeAfter = nativeAllocatedBytes();
+        System.out.println(String.format("  Java heap: %6.1f   native heap: %6.1f   (%d proxies)",
+            (double)(javaAfter - javaBefore) / PROXIES,
+            (double)(nativeAfter - nativeBefore) / PROXIES,
+            tokens.length));
+        System.out.println(String.format("  CppProxyHandle block: %d; the rest of the native heap is"
+            + " proxy cache buckets and unused slab space.", nativeHandleBlockSize()));
+        System.out.println("  Native heap excludes the JNI global reference held for each proxy.");
+
+        tokens = null;
+        nativeReleaseTokens();
+        javaHeapUsed();
+    }
+}
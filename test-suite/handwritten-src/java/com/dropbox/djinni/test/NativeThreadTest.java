@@ -0,0 +1,55 @@
+package com.dropbox.djinni.test;
+
+import java.lang.ref.WeakReference;
+
+import junit.framework.TestCase;
+
+public class NativeThreadTest extends TestCase {
+
+    private static native String nativeReturnStrOnNewThread(ClientInterface client, int calls);
+    private static native int nativeCallStaticOnNewThread(int value);
+    private static native boolean nativeReleaseOnDetachedThread(ClientInterface client);
+    private static native void nativeDrainDeferredRefs();
+
+    // Called from nativeCallStaticOnNewThread.
+    private static int twice(int value) {
+        return value * 2;
+    }
+
+    public void testCallFromNativeThread() {
+        assertEquals("test", nativeReturnStrOnNewThread(new ClientInterfaceImpl(), 1));
+    }
+
+    public void testRepeatedCallsFromNativeThread() {
+        assertEquals("testtesttest", nativeReturnStrOnNewThread(new ClientInterfaceImpl(), 3));
+    }
+
+    public void testNativeThreadIsDetached() {
+        int before = Thread.getAllStackTraces().size();
+        for (int i = 0; i < 10; ++i) {
+            nativeReturnStrOnNewThread(new ClientInterfaceImpl(), 1);
+        }
+        assertEquals(before, Thread.getAllStackTraces().size());
+    }
+
+    public void testClassLookupFromNativeThread() {
+        // With lazy class initialization, this is the first time the native side looks up
+        // this class, and it does so from a thread the JVM didn't create.
+        assertEquals(42, nativeCallStaticOnNewThread(21));
+    }
+
+    public void testReleaseOnDetachedThread() throws InterruptedException {
+        ClientInterface client = new ClientInterfaceImpl();
+        WeakReference<ClientInterface> weak = new WeakReference<ClientInterface>(client);
+        assertTrue(nativeReleaseOnDetachedThread(client));
+        client = null;
+
+        // The global ref is only deleted once an attached thread calls back into djinni.
+        nativeDrainDeferredRefs();
+        for (int i = 0; i < 20 && weak.get() != null; ++i) {
+            System.gc();
+            Thread.sleep(10);
+        }
+        assertNull(weak.get());
+    }
+}
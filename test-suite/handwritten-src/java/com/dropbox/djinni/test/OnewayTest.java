@@ -0,0 +1,176 @@
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+
+import junit.framework.TestCase;
+
+public class OnewayTest extends TestCase {
+
+    // The default JniInitOptions::onewayQueueDepth, which the test library doesn't change.
+    private static final int QUEUE_DEPTH = 4096;
+
+    private static native boolean nativeEmitOnNewThreads(EventSink sink, int threads, int count);
+    // Calls listener.onStatus with progress 1 to count, the last one with phase "done".
+    private static native void nativeUpdateOnNewThread(StatusListener listener, int count);
+    private static native void nativeFlush();
+    private static native long nativeDroppedCount();
+
+    // Records the events it gets, per source. If holding, each call first waits for release().
+    private static class RecordingSink extends EventSink {
+        final Map<String, List<Integer>> events = new HashMap<String, List<Integer>>();
+        final CountDownLatch entered = new CountDownLatch(1);
+        private final CountDownLatch gate;
+        Thread thread;
+
+        RecordingSink(boolean holding) {
+            gate = new CountDownLatch(holding ? 1 : 0);
+        }
+
+        void release() {
+            gate.countDown();
+        }
+
+        @Override
+        public void onEvent(String source, int value) {
+            entered.countDown();
+            try {
+                gate.await();
+            } catch (InterruptedException e) {
+                throw new RuntimeException(e);
+            }
+            synchronized (this) {
+                thread = Thread.currentThread();
+                List<Integer> list = events.get(source);
+                if (list == null) {
+                    list = new ArrayList<Integer>();
+                    events.put(source, list);
+                }
+                list.add(value);
+            }
+        }
+
+        synchronized List<Integer> get(String source) {
+            return events.get(source);
+        }
+    }
+
+    private static void assertSequence(List<Integer> values, int count) {
+        assertEquals(count, values.size());
+        for (int i = 0; i < count; ++i) {
+            assertEquals(i, (int)values.get(i));
+        }
+    }
+
+    public void testDeliveredInOrderFromNativeThreads() {
+        RecordingSink sink = new RecordingSink(false);
+        assertTrue(nativeEmitOnNewThreads(sink, 4, 1000));
+        nativeFlush();
+        for (int t = 0; t < 4; ++t) {
+            assertSequence(sink.get("t" + t), 1000);
+        }
+        assertNotSame(Thread.currentThread(), sink.thread);
+    }
+
+    public void testProducersDoNotWaitForJava() throws InterruptedException {
+        RecordingSink sink = new RecordingSink(true);
+        // Returns while the first call is still stuck in Java.
+        assertTrue(nativeEmitOnNewThreads(sink, 1, 10));
+        assertTrue(sink.entered.await(10, TimeUnit.SECONDS));
+        sink.release();
+        nativeFlush();
+        assertSequence(sink.get("t0"), 10);
+    }
+
+    public void testDropsNewestWhenFull() throws InterruptedException {
+        RecordingSink sink = new RecordingSink(true);
+        nativeEmitOnNewThreads(sink, 1, 1);
+        // The dispatcher is now stuck on that call, so nothing more leaves the queue.
+        assertTrue(sink.entered.await(10, TimeUnit.SECONDS));
+        long dropped = nativeDroppedCount();
+        nativeEmitOnNewThreads(sink, 1, QUEUE_DEPTH + 100);
+        assertEquals(dropped + 100, nativeDroppedCount());
+        sink.release();
+        nativeFlush();
+        List<Integer> values = sink.get("t0");
+        assertEquals(1 + QUEUE_DEPTH, values.size());
+        assertEquals(0, (int)values.get(0));
+        assertSequence(values.subList(1, values.size()), QUEUE_DEPTH);
+    }
+
+    public void testExceptionDoesNotStopDelivery() {
+        final List<Integer> values = new ArrayList<Integer>();
+        EventSink sink = new EventSink() {
+            @Override
+            public void onEvent(String source, int value) {
+                synchronized (values) {
+                    values.add(value);
+                }
+                if (value == 0) {
+                    throw new IllegalStateException("expected by OnewayTest");
+                }
+            }
+        };
+        nativeEmitOnNewThreads(sink, 1, 3);
+        nativeFlush();
+        synchronized (values) {
+            assertSequence(values, 3);
+        }
+    }
+
+    // Records the updates it gets. The first call waits for release().
+    private static class RecordingListener extends StatusListener {
+        final List<Integer> progress = new ArrayList<Integer>();
+        final CountDownLatch entered = new CountDownLatch(1);
+        private final CountDownLatch gate = new CountDownLatch(1);
+        String lastPhase;
+
+        @Override
+        public void onStatus(String phase, int progress) {
+            entered.countDown();
+            try {
+                gate.await();
+            } catch (InterruptedException e) {
+                throw new RuntimeException(e);
+            }
+            synchronized (this) {
+                lastPhase = phase;
+                this.progress.add(progress);
+            }
+        }
+    }
+
+    public void testCoalescedUpdatesKeepOnlyNewest() throws InterruptedException {
+        RecordingListener listener = new RecordingListener();
+        long dropped = nativeDroppedCount();
+        // The first update delivered holds up the dispatcher, while the rest replace each other.
+        nativeUpdateOnNewThread(listener, 10000);
+        assertTrue(listener.entered.await(10, TimeUnit.SECONDS));
+        listener.gate.countDown();
+        nativeFlush();
+        synchronized (listener) {
+            assertTrue(listener.progress.size() <= 2);
+            assertEquals(10000, (int)listener.progress.get(listener.progress.size() - 1));
+            assertEquals("done", listener.lastPhase);
+        }
+        // Replaced updates don't count as dropped.
+        assertEquals(dropped, nativeDroppedCount());
+    }
+
+    public void testCoalescedUpdateAfterDelivery() {
+        RecordingListener listener = new RecordingListener();
+        listener.gate.countDown();
+        nativeUpdateOnNewThread(listener, 1);
+        nativeFlush();
+        nativeUpdateOnNewThread(listener, 2);
+        nativeFlush();
+        synchronized (listener) {
+            assertEquals(1, (int)listener.progress.get(0));
+            assertEquals(2, (int)listener.progress.get(listener.progress.size() - 1));
+        }
+    }
+}
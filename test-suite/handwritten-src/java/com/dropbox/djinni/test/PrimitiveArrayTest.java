@@ -0,0 +1,45 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+import java.util.Arrays;
+
+public class PrimitiveArrayTest extends TestCase {
+
+    private PrimitiveArrays jPrimitiveArrays;
+
+    @Override
+    protected void setUp() {
+        jPrimitiveArrays = new PrimitiveArrays(
+            new int[] { 1, -2, 3, Integer.MAX_VALUE },
+            new long[] { 1, 2, -4294967296L, Long.MAX_VALUE },
+            new double[] { 0.5, -1.25, 1e300 },
+            new boolean[] { true, false, false, true, true });
+    }
+
+    public void testJavaPrimitiveArraysToCpp()
+    {
+        assertTrue("checkPrimitiveArrays", TestHelpers.checkPrimitiveArrays(jPrimitiveArrays));
+    }
+
+    public void testCppPrimitiveArraysToJava()
+    {
+        PrimitiveArrays converted = TestHelpers.getPrimitiveArrays();
+        assertTrue(Arrays.equals(converted.getInts(), jPrimitiveArrays.getInts()));
+        assertTrue(Arrays.equals(converted.getLongs(), jPrimitiveArrays.getLongs()));
+        assertTrue(Arrays.equals(converted.getDoubles(), jPrimitiveArrays.getDoubles()));
+        assertTrue(Arrays.equals(converted.getFlags(), jPrimitiveArrays.getFlags()));
+    }
+
+    public void testArrayParameterAndReturn()
+    {
+        long[] a = new long[1000];
+        long[] reversed = new long[a.length];
+        for (int i = 0; i < a.length; ++i) {
+            a[i] = (long)i << 33;
+            reversed[a.length - 1 - i] = a[i];
+        }
+        assertTrue(Arrays.equals(TestHelpers.reverseI64Array(a), reversed));
+        assertEquals(0, TestHelpers.reverseI64Array(new long[0]).length);
+    }
+}
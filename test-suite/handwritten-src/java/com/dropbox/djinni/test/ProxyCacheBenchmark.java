@@ -0,0 +1,81 @@
+package com.dropbox.djinni.test;
+
+public class ProxyCacheBenchmark {
+
+    private static final int ITERATIONS = 200000;
+
+    private static native void nativeFromJava(ClientInterface client, int iterations);
+    private static native void nativeToJava(boolean sharedObject, int iterations);
+
+    private interface Body {
+        void run(int thread);
+    }
+
+    private static long runThreads(int threadCount, final Body body) throws InterruptedException {
+        Thread[] threads = new Thread[threadCount];
+        for (int i = 0; i < threadCount; ++i) {
+            final int index = i;
+            threads[i] = new Thread(new Runnable() {
+                @Override
+                public void run() {
+                    body.run(index);
+                }
+            });
+        }
+        long start = System.nanoTime();
+        for (Thread thread : threads) {
+            thread.start();
+        }
+        for (Thread thread : threads) {
+            thread.join();
+        }
+        return System.nanoTime() - start;
+    }
+
+    private static long measureFromJava(int threadCount, boolean sharedListener)
+            throws InterruptedException {
+        final ClientInterface[] clients = new ClientInterface[threadCount];
+        final ClientInterface shared = new ClientInterfaceImpl();
+        for (int i = 0; i < threadCount; ++i) {
+            clients[i] = sharedListener ? shared : new ClientInterfaceImpl();
+        }
+        return runThreads(threadCount, new Body() {
+            @Override
+            public void run(int thread) {
+                nativeFromJava(clients[thread], ITERATIONS);
+            }
+        });
+    }
+
+    private static long measureToJava(int threadCount, final boolean sharedObject)
+            throws InterruptedException {
+        return runThreads(threadCount, new Body() {
+            @Override
+            public void run(int thread) {
+                nativeToJava(sharedObject, ITERATIONS);
+            }
+        });
+    }
+
+    private static void report(String label, int threadCount, long same, long different) {
+        System.out.println(String.format(
+            "  %s %d threads   same object: %6.1f   different objects: %6.1f",
+            label, threadCount,
+            (double)same / (ITERATIONS * threadCount),
+            (double)different / (ITERATIONS * threadCount)));
+    }
+
+    public static void run() throws InterruptedException {
+        System.out.println("Proxy cache lookups (ns per lookup, all threads together):");
+        measureFromJava(1, true); // warm up
+        measureToJava(1, true);
+        for (int threadCount : new int[] { 1, 2, 4, 8 }) {
+            report("Java -> C++", threadCount,
+                   measureFromJava(threadCount, true), measureFromJava(threadCount, false));
+        }
+        for (int threadCount : new int[] { 1, 2, 4, 8 }) {
+            report("C++ -> Java", threadCount,
+                   measureToJava(threadCount, true), measureToJava(threadCount, false));
+        }
+    }
+}
@@ -0,0 +1,78 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+public class ProxyCacheTest extends TestCase {
+
+    private static native boolean nativeSameJavaProxy(ClientInterface a, ClientInterface b);
+    private static native Token nativeSharedCppToken();
+    // djinni::jniProxyCacheStats(), in the order of the indices below.
+    private static native long[] nativeCacheStats();
+    private static final int CPP_PROXIES = 0;
+    private static final int CPP_PROXIES_HIGH_WATER = 1;
+    private static final int JAVA_PROXIES = 3;
+    private static final int JAVA_PROXIES_HIGH_WATER = 4;
+
+    public void testSameObjectSameProxy() {
+        ClientInterface client = new ClientInterfaceImpl();
+        assertTrue(nativeSameJavaProxy(client, client));
+        // Again, now that the identity hash is cached on the object.
+        assertTrue(nativeSameJavaProxy(client, client));
+    }
+
+    public void testDifferentObjectsDifferentProxies() {
+        ClientInterface[] clients = new ClientInterface[100];
+        for (int i = 0; i < clients.length; ++i) {
+            clients[i] = new ClientInterfaceImpl();
+        }
+        for (int i = 1; i < clients.length; ++i) {
+            assertFalse(nativeSameJavaProxy(clients[i - 1], clients[i]));
+        }
+    }
+
+    public void testSameCppObjectSameProxy() {
+        Token token = nativeSharedCppToken();
+        assertSame(token, nativeSharedCppToken());
+    }
+
+    public void testCppProxyRecreatedAfterCollection() {
+        for (int i = 0; i < 3; ++i) {
+            assertEquals("C++", nativeSharedCppToken().whoami());
+            System.gc();
+            System.runFinalization();
+        }
+        Token token = nativeSharedCppToken();
+        assertSame(token, nativeSharedCppToken());
+    }
+
+    public void testCacheStats() throws InterruptedException {
+        Token[] tokens = new Token[100];
+        for (int i = 0; i < tokens.length; ++i) {
+            tokens[i] = TestHelpers.createCppToken();
+        }
+        long[] stats = nativeCacheStats();
+        assertTrue(stats[CPP_PROXIES] >= tokens.length);
+        assertTrue(stats[CPP_PROXIES_HIGH_WATER] >= stats[CPP_PROXIES]);
+        assertTrue(stats[JAVA_PROXIES_HIGH_WATER] >= stats[JAVA_PROXIES]);
+
+        // Entries go away once their proxies are collected and released.
+        long live = stats[CPP_PROXIES];
+        tokens = null;
+        for (int i = 0; i < 50 && nativeCacheStats()[CPP_PROXIES] > live - 100; ++i) {
+            System.gc();
+            Thread.sleep(20);
+        }
+        assertTrue(nativeCacheStats()[CPP_PROXIES] <= live - 100);
+        assertTrue(nativeCacheStats()[CPP_PROXIES_HIGH_WATER] >= live);
+    }
+
+    public void testClosedCppProxyIsReplaced() {
+        Token token = nativeSharedCppToken();
+        token.close();
+        // Closing twice is harmless.
+        token.close();
+        Token replacement = nativeSharedCppToken();
+        assertNotSame(token, replacement);
+        assertEquals("C++", replacement.whoami());
+    }
+}
@@ -0,0 +1,52 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+public class ScalarRecordTest extends TestCase {
+
+    private SampleFilter filter;
+
+    @Override
+    protected void setUp() {
+        filter = SampleFilter.create();
+    }
+
+    private static void assertSample(Sample expected, Sample actual) {
+        assertEquals(expected.getTime(), actual.getTime());
+        assertEquals(expected.getValue(), actual.getValue(), 0.0);
+        assertEquals(expected.getWeight(), actual.getWeight(), 0.0f);
+        assertEquals(expected.getValid(), actual.getValid());
+    }
+
+    public void testScale() {
+        Sample s = new Sample(-1234567890123L, 2.5, 0.75f, true);
+        assertSample(new Sample(-1234567890123L, 5.0, 1.5f, true), filter.scale(s, 2.0));
+        assertSample(new Sample(-1234567890123L, -2.5, -0.75f, true), filter.scale(s, -1.0));
+    }
+
+    public void testExtremeValues() {
+        Sample s = new Sample(Long.MIN_VALUE, Double.MAX_VALUE, Float.MIN_VALUE, true);
+        assertSample(new Sample(Long.MIN_VALUE, Double.MAX_VALUE, Float.MIN_VALUE, true),
+                     filter.scale(s, 1.0));
+        Sample overflow = filter.scale(s, 2.0);
+        assertEquals(Double.POSITIVE_INFINITY, overflow.getValue(), 0.0);
+        assertFalse(overflow.getValid());
+        Sample nan = filter.scale(new Sample(Long.MAX_VALUE, Double.NaN, -0.0f, true), 1.0);
+        assertEquals(Long.MAX_VALUE, nan.getTime());
+        assertTrue(Double.isNaN(nan.getValue()));
+        assertEquals(Float.floatToRawIntBits(-0.0f), Float.floatToRawIntBits(nan.getWeight()));
+        assertFalse(nan.getValid());
+    }
+
+    public void testWeighted() {
+        assertEquals(3.0, filter.weighted(new Sample(0, 4.0, 0.75f, true)), 0.0);
+        assertEquals(0.0, filter.weighted(new Sample(0, 4.0, 0.75f, false)), 0.0);
+    }
+
+    public void testNestedCalls() {
+        // Each call's result is read out of the slot before the next call overwrites it.
+        Sample s = new Sample(7, 1.0, 1.0f, true);
+        Sample twice = filter.scale(filter.scale(s, 3.0), 2.0);
+        assertSample(new Sample(7, 6.0, 6.0f, true), twice);
+    }
+}
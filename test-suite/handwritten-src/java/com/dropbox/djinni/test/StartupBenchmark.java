@@ -0,0 +1,71 @@
+package com.dropbox.djinni.test;
+
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.InputStreamReader;
+import java.util.Arrays;
+
+/*
+ * Library load time with eager and lazy class initialization. jniInit only runs once per
+ * process, so every sample is a fresh JVM running Child, with the mode picked through the
+ * environment variable read by test_main-jni.cpp.
+ */
+public class StartupBenchmark {
+
+    private static final int RUNS = 15;
+
+    public static class Child {
+        public static void main(String[] args) {
+            long start = System.nanoTime();
+            System.loadLibrary("DjinniTestNative");
+            long loaded = System.nanoTime();
+            // Touches a handful of types, which lazy mode only initializes now.
+            TestHelpers.checkSetRecord(TestHelpers.getSetRecord());
+            long used = System.nanoTime();
+            System.out.println((loaded - start) + " " + (used - loaded));
+        }
+    }
+
+    private static long[] runChild(boolean lazy) throws Exception {
+        ProcessBuilder builder = new ProcessBuilder(
+            System.getProperty("java.home") + File.separator + "bin" + File.separator + "java",
+            "-cp", System.getProperty("java.class.path"),
+            "-Djava.library.path=" + System.getProperty("java.library.path"),
+            Child.class.getName());
+        builder.environment().put("DJINNI_TEST_LAZY_CLASS_INIT", lazy ? "1" : "0");
+        builder.redirectErrorStream(true);
+        Process process = builder.start();
+        BufferedReader reader = new BufferedReader(new InputStreamReader(process.getInputStream()));
+        String line = reader.readLine();
+        if (process.waitFor() != 0 || line == null) {
+            throw new RuntimeException("startup benchmark child failed: " + line);
+        }
+        String[] parts = line.trim().split(" ");
+        return new long[] { Long.parseLong(parts[0]), Long.parseLong(parts[1]) };
+    }
+
+    private static double medianMicros(long[] nanos) {
+        long[] sorted = nanos.clone();
+        Arrays.sort(sorted);
+        return sorted[sorted.length / 2] / 1000.0;
+    }
+
+    public static void run() throws Exception {
+        System.out.println("Library startup (median us over " + RUNS + " processes):");
+        long[][] load = new long[2][RUNS];
+        long[][] firstUse = new long[2][RUNS];
+        // Interleave the modes, so that both see the same machine state.
+        for (int i = 0; i < RUNS; ++i) {
+            for (int mode = 0; mode < 2; ++mode) {
+                long[] sample = runChild(mode == 1);
+                load[mode][i] = sample[0];
+                firstUse[mode][i] = sample[1];
+            }
+        }
+        for (int mode = 0; mode < 2; ++mode) {
+            System.out.println(String.format(
+                "  %s  loadLibrary: %8.1f   first calls: %8.1f",
+                mode == 1 ? "lazy " : "eager", medianMicros(load[mode]), medianMicros(firstUse[mode])));
+        }
+    }
+}
@@ -0,0 +1,47 @@
+package com.dropbox.djinni.test;
+
+public class StringBenchmark {
+
+    private static final int ITERATIONS = 100000;
+
+    // Each returns the number of C++ allocations made over all iterations.
+    private static native long nativeToCpp(String str, int iterations, boolean legacy);
+    private static native long nativeFromCpp(String str, int iterations, boolean legacy);
+
+    private static String repeat(String s, int times) {
+        StringBuilder builder = new StringBuilder();
+        for (int i = 0; i < times; ++i) {
+            builder.append(s);
+        }
+        return builder.toString();
+    }
+
+    private static void measure(String label, String str) {
+        for (boolean legacy : new boolean[] { true, false }) {
+            String variant = legacy ? "previous" : "current ";
+            nativeToCpp(str, ITERATIONS, legacy); // warm up
+            long start = System.nanoTime();
+            long toCppAllocations = nativeToCpp(str, ITERATIONS, legacy);
+            long toCppNanos = System.nanoTime() - start;
+
+            nativeFromCpp(str, ITERATIONS, legacy);
+            start = System.nanoTime();
+            long fromCppAllocations = nativeFromCpp(str, ITERATIONS, legacy);
+            long fromCppNanos = System.nanoTime() - start;
+
+            System.out.println(String.format(
+                "  %-24s %s  toCpp: %.2f allocs, %6d ns   fromCpp: %.2f allocs, %6d ns",
+                label, variant,
+                (double)toCppAllocations / ITERATIONS, toCppNanos / ITERATIONS,
+                (double)fromCppAllocations / ITERATIONS, fromCppNanos / ITERATIONS));
+        }
+    }
+
+    public static void run() {
+        System.out.println("String marshalling (per call):");
+        measure("short ascii", "hello, world");
+        measure("short non-ascii", "caf\u00e9 \u20ac");
+        measure("long ascii", repeat("0123456789abcdef", 64));
+        measure("long non-ascii", repeat("caf\u00e9 \u20ac \ud83d\ude00 ", 64));
+    }
+}
@@ -0,0 +1,74 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+import java.nio.charset.Charset;
+import java.util.Arrays;
+
+public class UtfTest extends TestCase {
+
+    private static final Charset UTF_8 = Charset.forName("UTF-8");
+
+    private static native String nativeCheckTranscoders(int seed, int iterations);
+    private static native String nativeFromUtf8(byte[] bytes);
+    private static native byte[] nativeToUtf8(String str);
+
+    private static byte[] bytes(int... values) {
+        byte[] result = new byte[values.length];
+        for (int i = 0; i < values.length; ++i) {
+            result[i] = (byte)values[i];
+        }
+        return result;
+    }
+
+    private static String repeat(String s, int times) {
+        StringBuilder builder = new StringBuilder();
+        for (int i = 0; i < times; ++i) {
+            builder.append(s);
+        }
+        return builder.toString();
+    }
+
+    public void testTranscodersMatchReference() {
+        for (int seed = 0; seed < 4; ++seed) {
+            assertNull(nativeCheckTranscoders(seed, 20000));
+        }
+    }
+
+    public void testRoundTrip() {
+        // Long strings take different paths than short ones that fit on the stack.
+        String[] strings = {
+            "",
+            "ascii",
+            "a string long enough to cover several full vector blocks of pure ascii text",
+            "caf\u00e9 \u20ac \ud83d\ude00",
+            "0123456789abcdef0123456789abcdef\u00e9 after a full block",
+            "embedded\u0000nul",
+            repeat("long ascii ", 100),
+            repeat("long with nul\u0000", 100),
+            repeat("caf\u00e9 \ud83d\ude00 ", 100),
+        };
+        for (String s : strings) {
+            assertTrue(Arrays.equals(s.getBytes(UTF_8), nativeToUtf8(s)));
+            assertEquals(s, nativeFromUtf8(s.getBytes(UTF_8)));
+        }
+    }
+
+    public void testUnpairedSurrogates() {
+        assertEquals("\ufffd", nativeFromUtf8(nativeToUtf8("\ud800")));
+        assertEquals("\ufffd", nativeFromUtf8(nativeToUtf8("\udc00")));
+        assertEquals("a\ufffdb", nativeFromUtf8(nativeToUtf8("a\ud800b")));
+        assertEquals("\ufffd\ufffd", nativeFromUtf8(nativeToUtf8("\udc00\ud800")));
+    }
+
+    public void testInvalidUtf8() {
+        // Each byte that does not start a valid sequence becomes exactly one U+FFFD.
+        assertEquals("\ufffd", nativeFromUtf8(bytes(0xc3)));
+        assertEquals("\ufffd\ufffd", nativeFromUtf8(bytes(0xe2, 0x82)));
+        assertEquals("\ufffd\ufffd", nativeFromUtf8(bytes(0xc0, 0x80)));
+        assertEquals("\ufffd\ufffd\ufffd\ufffd", nativeFromUtf8(bytes(0xf4, 0x90, 0x80, 0x80)));
+        assertEquals("\ufffdA", nativeFromUtf8(bytes(0xff, 0x41)));
+        // Encoded surrogates are passed through, as miniutf always has.
+        assertEquals("\ud800", nativeFromUtf8(bytes(0xed, 0xa0, 0x80)));
+    }
+}
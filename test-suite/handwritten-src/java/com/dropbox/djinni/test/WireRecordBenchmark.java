@@ -0,0 +1,106 @@
+package com.dropbox.djinni.test;
+
+import java.util.ArrayList;
+import java.util.Date;
+import java.util.HashMap;
+import java.util.HashSet;
+
+public class WireRecordBenchmark {
+
+    // Each converts one of its arguments to C++ (and back, for the fromCpp half) iterations
+    // times: the plain record field by field if fieldByField is set, otherwise the wire record
+    // as a single byte array. Both hold the same values.
+    private static native void nativeSmallToCpp(WireSmall wire, PlainSmall plain, int iterations, boolean fieldByField);
+    private static native void nativeSmallFromCpp(WireSmall wire, PlainSmall plain, int iterations, boolean fieldByField);
+    private static native void nativeMediumToCpp(WireMedium wire, PlainMedium plain, int iterations, boolean fieldByField);
+    private static native void nativeMediumFromCpp(WireMedium wire, PlainMedium plain, int iterations, boolean fieldByField);
+    private static native void nativeLargeToCpp(WireLarge wire, PlainLarge plain, int iterations, boolean fieldByField);
+    private static native void nativeLargeFromCpp(WireLarge wire, PlainLarge plain, int iterations, boolean fieldByField);
+
+    private interface Body {
+        void run(int iterations, boolean fieldByField);
+    }
+
+    private static void measure(String label, int iterations, Body body) {
+        for (boolean fieldByField : new boolean[] { true, false }) {
+            String variant = fieldByField ? "field by field" : "serialized    ";
+            body.run(iterations, fieldByField); // warm up
+            long start = System.nanoTime();
+            body.run(iterations, fieldByField);
+            long nanos = System.nanoTime() - start;
+            System.out.println(String.format("  %-16s %s  %8.1f ns per record",
+                label, variant, (double)nanos / iterations));
+        }
+    }
+
+    private static ArrayList<String> tags(int count) {
+        ArrayList<String> tags = new ArrayList<String>();
+        for (int i = 0; i < count; ++i) {
+            tags.add("tag " + i);
+        }
+        return tags;
+    }
+
+    public static void run() {
+        System.out.println("Record marshalling:");
+
+        final WireSmall wireSmall = new WireSmall(1, "small", 0.5);
+        final PlainSmall plainSmall = new PlainSmall(1, "small", 0.5);
+
+        Date created = new Date(1234567890123L);
+        final WireMedium wireMedium = new WireMedium(2, "medium", tags(8), 4.5f, Color.GREEN, created);
+        final PlainMedium plainMedium = new PlainMedium(2, "medium", tags(8), 4.5f, Color.GREEN, created);
+
+        ArrayList<WireSmall> wireItems = new ArrayList<WireSmall>();
+        ArrayList<PlainSmall> plainItems = new ArrayList<PlainSmall>();
+        HashMap<String, Integer> attributes = new HashMap<String, Integer>();
+        HashSet<Long> members = new HashSet<Long>();
+        for (int i = 0; i < 64; ++i) {
+            wireItems.add(new WireSmall(i, "item " + i, i * 0.25));
+            plainItems.add(new PlainSmall(i, "item " + i, i * 0.25));
+            attributes.put("attribute " + i, i);
+            members.add((long)i * 1000);
+        }
+        byte[] payload = new byte[1024];
+        double[] weights = new double[256];
+        final WireLarge wireLarge = new WireLarge(wireMedium, wireItems, attributes, members, payload, weights, "large");
+        final PlainLarge plainLarge = new PlainLarge(plainMedium, plainItems, attributes, members, payload, weights, "large");
+
+        measure("small toCpp", 200000, new Body() {
+            @Override
+            public void run(int iterations, boolean fieldByField) {
+                nativeSmallToCpp(wireSmall, plainSmall, iterations, fieldByField);
+            }
+        });
+        measure("small fromCpp", 200000, new Body() {
+            @Override
+            public void run(int iterations, boolean fieldByField) {
+                nativeSmallFromCpp(wireSmall, plainSmall, iterations, fieldByField);
+            }
+        });
+        measure("medium toCpp", 50000, new Body() {
+            @Override
+            public void run(int iterations, boolean fieldByField) {
+                nativeMediumToCpp(wireMedium, plainMedium, iterations, fieldByField);
+            }
+        });
+        measure("medium fromCpp", 50000, new Body() {
+            @Override
+            public void run(int iterations, boolean fieldByField) {
+                nativeMediumFromCpp(wireMedium, plainMedium, iterations, fieldByField);
+            }
+        });
+        measure("large toCpp", 2000, new Body() {
+            @Override
+            public void run(int iterations, boolean fieldByField) {
+                nativeLargeToCpp(wireLarge, plainLarge, iterations, fieldByField);
+            }
+        });
+        measure("large fromCpp", 2000, new Body() {
+            @Override
+            public void run(int iterations, boolean fieldByField) {
+                nativeLargeFromCpp(wireLarge, plainLarge, iterations, fieldByField);
+            }
+        });
+    }
+}
@@ -0,0 +1,129 @@
+package com.dropbox.djinni.test;
+
+import junit.framework.TestCase;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Date;
+import java.util.HashMap;
+import java.util.HashSet;
+
+public class WireRecordTest extends TestCase {
+
+    // Each converts its argument to C++ and back.
+    private static native WireLarge nativeLargeRoundTrip(WireLarge record);
+    private static native ArrayList<WireSmall> nativeSmallListRoundTrip(ArrayList<WireSmall> list);
+    // Decodes record from its wire message, then returns it through the field-by-field path.
+    private static native PlainLarge nativeLargeToPlain(WireLarge record);
+    // Returns the record built by makeLarge(), constructed in C++.
+    private static native WireLarge nativeMakeLarge();
+
+    private static WireLarge makeLarge() {
+        ArrayList<String> tags = new ArrayList<String>(Arrays.asList("", "caf\u00e9", "\ud83d\ude00", "tag"));
+        WireMedium header = new WireMedium(-42L, "header \u2603", tags, 1.5f, Color.INDIGO, new Date(1234567890123L));
+        ArrayList<WireSmall> items = new ArrayList<WireSmall>();
+        for (int i = 0; i < 3; ++i) {
+            items.add(new WireSmall(Long.MAX_VALUE - i, "item " + i, -0.25 * i));
+        }
+        HashMap<String, Integer> attributes = new HashMap<String, Integer>();
+        attributes.put("min", Integer.MIN_VALUE);
+        attributes.put("max", Integer.MAX_VALUE);
+        HashSet<Long> members = new HashSet<Long>(Arrays.asList(Long.MIN_VALUE, 0L, 300L));
+        byte[] payload = new byte[300];
+        for (int i = 0; i < payload.length; ++i) {
+            payload[i] = (byte) i;
+        }
+        double[] weights = { Double.MAX_VALUE, -0.0, Double.MIN_VALUE };
+        return new WireLarge(header, items, attributes, members, payload, weights, null);
+    }
+
+    private static void assertMedium(WireMedium expected, WireMedium actual) {
+        assertEquals(expected.getSerial(), actual.getSerial());
+        assertEquals(expected.getName(), actual.getName());
+        assertEquals(expected.getTags(), actual.getTags());
+        assertEquals(expected.getRating(), actual.getRating());
+        assertEquals(expected.getShade(), actual.getShade());
+        assertEquals(expected.getCreated(), actual.getCreated());
+    }
+
+    private static void assertSmall(WireSmall expected, WireSmall actual) {
+        assertEquals(expected.getSerial(), actual.getSerial());
+        assertEquals(expected.getLabel(), actual.getLabel());
+        assertEquals(expected.getScore(), actual.getScore(), 0.0);
+    }
+
+    private static void assertLarge(WireLarge expected, WireLarge actual) {
+        assertMedium(expected.getHeader(), actual.getHeader());
+        assertEquals(expected.getItems().size(), actual.getItems().size());
+        for (int i = 0; i < expected.getItems().size(); ++i) {
+            assertSmall(expected.getItems().get(i), actual.getItems().get(i));
+        }
+        assertEquals(expected.getAttributes(), actual.getAttributes());
+        assertEquals(expected.getMembers(), actual.getMembers());
+        assertTrue(Arrays.equals(expected.getPayload(), actual.getPayload()));
+        assertTrue(Arrays.equals(expected.getWeights(), actual.getWeights()));
+        assertEquals(expected.getNote(), actual.getNote());
+    }
+
+    public void testRoundTrip() {
+        WireLarge record = makeLarge();
+        assertLarge(record, nativeLargeRoundTrip(record));
+    }
+
+    public void testEmptyAndAbsent() {
+        WireMedium header = new WireMedium(0, "", new ArrayList<String>(), null, Color.RED, new Date(0));
+        WireLarge record = new WireLarge(header, new ArrayList<WireSmall>(), new HashMap<String, Integer>(),
+                                         new HashSet<Long>(), new byte[0], new double[0], "note");
+        assertLarge(record, nativeLargeRoundTrip(record));
+    }
+
+    public void testEncodedInCpp() {
+        assertLarge(makeLarge(), nativeMakeLarge());
+    }
+
+    public void testDecodesLikeFieldByField() {
+        WireLarge record = makeLarge();
+        PlainLarge plain = nativeLargeToPlain(record);
+        assertEquals(record.getHeader().getName(), plain.getHeader().getName());
+        assertEquals(record.getHeader().getTags(), plain.getHeader().getTags());
+        assertEquals(record.getHeader().getRating(), plain.getHeader().getRating());
+        assertEquals(record.getHeader().getCreated(), plain.getHeader().getCreated());
+        assertEquals(record.getItems().get(2).getLabel(), plain.getItems().get(2).getLabel());
+        assertEquals(record.getAttributes(), plain.getAttributes());
+        assertEquals(record.getMembers(), plain.getMembers());
+        assertTrue(Arrays.equals(record.getPayload(), plain.getPayload()));
+        assertTrue(Arrays.equals(record.getWeights(), plain.getWeights()));
+    }
+
+    public void testUnpairedSurrogates() {
+        // Replaced the same way as by the string marshaller.
+        ArrayList<WireSmall> list = new ArrayList<WireSmall>();
+        list.add(new WireSmall(1, "a\ud800b", 0));
+        list.add(new WireSmall(2, "\udc00\ud83d", 0));
+        ArrayList<WireSmall> result = nativeSmallListRoundTrip(list);
+        assertEquals("a\ufffdb", result.get(0).getLabel());
+        assertEquals("\ufffd\ufffd", result.get(1).getLabel());
+    }
+
+    public void testList() {
+        // Every element of a list reuses the thread's scratch buffers.
+        ArrayList<WireSmall> list = new ArrayList<WireSmall>();
+        for (int i = 0; i < 1000; ++i) {
+            list.add(new WireSmall(i, "item " + i, i * 0.5));
+        }
+        ArrayList<WireSmall> result = nativeSmallListRoundTrip(list);
+        assertEquals(list.size(), result.size());
+        for (int i = 0; i < list.size(); ++i) {
+            assertSmall(list.get(i), result.get(i));
+        }
+    }
+
+    public void testLargeMessage() {
+        // Grows the scratch buffers past the size they keep between messages.
+        WireLarge record = makeLarge();
+        WireLarge big = new WireLarge(record.getHeader(), record.getItems(), record.getAttributes(),
+                                      record.getMembers(), new byte[3 << 20], record.getWeights(), "big");
+        assertLarge(big, nativeLargeRoundTrip(big));
+        assertLarge(record, nativeLargeRoundTrip(record));
+    }
+}
@@ -64,6 +64,9 @@ fi
     --java-package $java_package \
     --java-nullable-annotation "javax.annotation.CheckForNull" \
     --java-nonnull-annotation "javax.annotation.Nonnull" \
+    --java-batched-release true \
+    --java-scalar-records 4 \
+    --java-call-batches true \
     --ident-java-field mFooBar \
     \
     --cpp-out "$temp_out_relative/cpp" \
@@ -74,6 +77,7 @@ fi
     --jni-out "$temp_out_relative/jni" \
     --ident-jni-class NativeFooBar \
     --ident-jni-file NativeFooBar \
+    --jni-register-natives true \
     \
     --objc-out "$temp_out_relative/objc" \
     --objcpp-out "$temp_out_relative/objc" \
@@ -94,6 +98,9 @@ cp "$base_dir/djinni/yaml-test.djinni" "$temp_out/yaml"
 "$base_dir/../src/run-assume-built" \
     --java-out "$temp_out/java" \
     --java-package $java_package \
+    --java-batched-release true \
+    --java-scalar-records 4 \
+    --java-call-batches true \
     --ident-java-field mFooBar \
     \
     --cpp-out "$temp_out/cpp" \
@@ -104,6 +111,7 @@ cp "$base_dir/djinni/yaml-test.djinni" "$temp_out/yaml"
     --jni-out "$temp_out/jni" \
     --ident-jni-class NativeFooBar \
     --ident-jni-file NativeFooBar \
+    --jni-register-natives true \
     \
     --objc-out "$temp_out/objc" \
     --objcpp-out "$temp_out/objc" \